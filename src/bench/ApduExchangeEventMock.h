@@ -0,0 +1,97 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/* Calypsonet Terminal Calypso */
+#include "ApduExchangeEvent.h"
+
+using namespace calypsonet::terminal::calypso::transaction;
+
+/**
+ * ApduExchangeEvent whose content is provided at construction, the status word being taken from
+ * the response.
+ */
+class ApduExchangeEventMock final : public ApduExchangeEvent {
+public:
+    ApduExchangeEventMock(const Target target,
+                          const Phase phase,
+                          const std::string& commandName,
+                          const std::vector<uint8_t>& apdu,
+                          const std::vector<uint8_t>& response,
+                          const std::chrono::steady_clock::time_point requestTime,
+                          const std::chrono::steady_clock::time_point responseTime)
+    : mTarget(target),
+      mPhase(phase),
+      mCommandName(commandName),
+      mApdu(apdu),
+      mResponse(response),
+      mRequestTime(requestTime),
+      mResponseTime(responseTime) {}
+
+    Target getTarget() const override
+    {
+        return mTarget;
+    }
+
+    Phase getPhase() const override
+    {
+        return mPhase;
+    }
+
+    const std::string& getCommandName() const override
+    {
+        return mCommandName;
+    }
+
+    const std::vector<uint8_t>& getApdu() const override
+    {
+        return mApdu;
+    }
+
+    const std::vector<uint8_t>& getResponse() const override
+    {
+        return mResponse;
+    }
+
+    int getStatusWord() const override
+    {
+        return mResponse.size() < 2 ?
+                   0 :
+                   mResponse[mResponse.size() - 2] << 8 | mResponse[mResponse.size() - 1];
+    }
+
+    std::chrono::steady_clock::time_point getRequestTime() const override
+    {
+        return mRequestTime;
+    }
+
+    std::chrono::steady_clock::time_point getResponseTime() const override
+    {
+        return mResponseTime;
+    }
+
+private:
+    const Target mTarget;
+    const Phase mPhase;
+    const std::string mCommandName;
+    const std::vector<uint8_t> mApdu;
+    const std::vector<uint8_t> mResponse;
+    const std::chrono::steady_clock::time_point mRequestTime;
+    const std::chrono::steady_clock::time_point mResponseTime;
+};
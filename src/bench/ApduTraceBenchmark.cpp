@@ -0,0 +1,112 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+
+#include "benchmark/benchmark.h"
+
+/* Calypsonet Terminal Calypso */
+#include "ApduTraceReader.h"
+#include "ApduTraceRecorder.h"
+#include "ReplayCardReader.h"
+
+/* Mocks */
+#include "ApduExchangeEventMock.h"
+
+using namespace calypsonet::terminal::calypso::sim;
+
+static const int NB_READS = 8;
+
+static const std::vector<uint8_t> READ_RECORD = {0x00, 0xB2, 0x01, 0x3C, 0x1D};
+
+/* A selection followed by NB_READS reads of 29 bytes, each exchange lasting 3 ms */
+static void recordValidation(ApduTraceRecorder& recorder)
+{
+    const std::vector<uint8_t> select = {0x00, 0xA4, 0x04, 0x00, 0x09, 0xA0, 0x00, 0x00,
+                                         0x04, 0x04, 0x01, 0x25, 0x09, 0x01, 0x00};
+    std::vector<uint8_t> record(29, 0x5A);
+    record.push_back(0x90);
+    record.push_back(0x00);
+    auto time = std::chrono::steady_clock::now();
+
+    recorder.onApduExchanged(ApduExchangeEventMock(ApduExchangeEvent::Target::CARD,
+                                                   ApduExchangeEvent::Phase::COMMANDS,
+                                                   "SELECT_APPLICATION",
+                                                   select,
+                                                   record,
+                                                   time,
+                                                   time + std::chrono::milliseconds(3)));
+    for (int i = 0; i < NB_READS; i++) {
+        time += std::chrono::milliseconds(4);
+        recorder.onApduExchanged(ApduExchangeEventMock(ApduExchangeEvent::Target::CARD,
+                                                       ApduExchangeEvent::Phase::COMMANDS,
+                                                       "READ_RECORDS",
+                                                       READ_RECORD,
+                                                       record,
+                                                       time,
+                                                       time + std::chrono::milliseconds(3)));
+    }
+}
+
+static void BM_recordApduExchange(benchmark::State& state)
+{
+    ApduTraceRecorder recorder;
+    const auto time = std::chrono::steady_clock::now();
+    const ApduExchangeEventMock event(ApduExchangeEvent::Target::CARD,
+                                      ApduExchangeEvent::Phase::COMMANDS,
+                                      "READ_RECORDS",
+                                      READ_RECORD,
+                                      std::vector<uint8_t>(31, 0x5A),
+                                      time,
+                                      time + std::chrono::milliseconds(3));
+    std::vector<uint8_t> trace;
+    int exchanges = 0;
+
+    /* The trace is taken regularly, as it would be at the end of each transaction */
+    for (auto _ : state) {
+        recorder.onApduExchanged(event);
+        if (++exchanges == 1024) {
+            recorder.takeTrace(trace);
+            exchanges = 0;
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_recordApduExchange);
+
+static void BM_replayValidation(benchmark::State& state)
+{
+    ApduTraceRecorder recorder;
+    recordValidation(recorder);
+    const std::vector<uint8_t> trace = recorder.getTrace();
+
+    ApduTraceReader reader(trace);
+    ApduTraceReader::Exchange exchange;
+    std::vector<std::vector<uint8_t>> apdus;
+    while (reader.next(exchange)) {
+        apdus.push_back(exchange.apdu.toVector());
+    }
+
+    ReplayCardReader cardReader("card", true, trace, ApduExchangeEvent::Target::CARD);
+    std::vector<uint8_t> response;
+
+    for (auto _ : state) {
+        cardReader.rewind();
+        for (const auto& apdu : apdus) {
+            cardReader.transmitApdu(apdu, response);
+        }
+        benchmark::DoNotOptimize(response.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * apdus.size());
+}
+BENCHMARK(BM_replayValidation);
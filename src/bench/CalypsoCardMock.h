@@ -0,0 +1,263 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+/* Calypsonet Terminal Calypso */
+#include "CalypsoCard.h"
+#include "ElementaryFileIndex.h"
+
+/* Mocks */
+#include "ElementaryFileMock.h"
+#include "SvDebitLogRecordMock.h"
+
+using namespace calypsonet::terminal::calypso;
+using namespace calypsonet::terminal::calypso::card;
+
+/**
+ * CalypsoCard implementation backed by an ElementaryFileIndex, describing a Calypso Prime
+ * Revision 3 card with the extended mode and the SV feature.
+ */
+class CalypsoCardMock final : public CalypsoCard {
+public:
+    CalypsoCardMock()
+    : mProductType(ProductType::PRIME_REVISION_3),
+      mDfName({0xA0, 0x00, 0x00, 0x04, 0x04, 0x01, 0x25, 0x09, 0x01, 0x01}),
+      mSerialNumber({0x00, 0x00, 0x00, 0x00, 0x12, 0x34, 0x56, 0x78}),
+      mStartupInfo({0x0A, 0x3C, 0x2F, 0x05, 0x14, 0x10, 0x01}),
+      mPowerOnData("3B8F8001805A0A0103200311123456788290009A") {}
+
+    ElementaryFileMock& addFile(const uint8_t sfi,
+                                const uint16_t lid,
+                                const ElementaryFile::Type efType,
+                                const int recordsNumber,
+                                const int recordSize)
+    {
+        auto ef = std::make_shared<ElementaryFileMock>(sfi, lid, efType, recordsNumber, recordSize);
+        mIndex.put(ef);
+
+        return *ef;
+    }
+
+    void addSvDebitLogRecord(const std::vector<uint8_t>& rawData)
+    {
+        mSvDebitLogRecords.push_back(std::make_shared<SvDebitLogRecordMock>(rawData));
+    }
+
+    const std::string& getPowerOnData() const override
+    {
+        return mPowerOnData;
+    }
+
+    const std::vector<uint8_t> getSelectApplicationResponse() const override
+    {
+        return std::vector<uint8_t>();
+    }
+
+    const ProductType& getProductType() const override
+    {
+        return mProductType;
+    }
+
+    bool isHce() const override
+    {
+        return false;
+    }
+
+    bool isDfInvalidated() const override
+    {
+        return false;
+    }
+
+    const std::vector<uint8_t>& getDfName() const override
+    {
+        return mDfName;
+    }
+
+    const std::vector<uint8_t> getApplicationSerialNumber() const override
+    {
+        return mSerialNumber;
+    }
+
+    const ByteView getDfNameView() const override
+    {
+        return mDfName;
+    }
+
+    const ByteView getApplicationSerialNumberView() const override
+    {
+        return mSerialNumber;
+    }
+
+    const std::vector<uint8_t>& getStartupInfoRawData() const override
+    {
+        return mStartupInfo;
+    }
+
+    uint8_t getPlatform() const override
+    {
+        return mStartupInfo[2];
+    }
+
+    uint8_t getApplicationType() const override
+    {
+        return mStartupInfo[3];
+    }
+
+    uint8_t getApplicationSubtype() const override
+    {
+        return mStartupInfo[4];
+    }
+
+    uint8_t getSoftwareIssuer() const override
+    {
+        return mStartupInfo[5];
+    }
+
+    uint8_t getSoftwareVersion() const override
+    {
+        return mStartupInfo[6];
+    }
+
+    uint8_t getSoftwareRevision() const override
+    {
+        return 0;
+    }
+
+    uint8_t getSessionModification() const override
+    {
+        return mStartupInfo[0];
+    }
+
+    const std::vector<uint8_t> getTraceabilityInformation() const override
+    {
+        return std::vector<uint8_t>();
+    }
+
+    const std::shared_ptr<DirectoryHeader> getDirectoryHeader() const override
+    {
+        return nullptr;
+    }
+
+    const std::shared_ptr<ElementaryFile> getFileBySfi(const uint8_t sfi) const override
+    {
+        return mIndex.getBySfi(sfi);
+    }
+
+    const std::shared_ptr<ElementaryFile> getFileByLid(const uint16_t lid) const override
+    {
+        return mIndex.getByLid(lid);
+    }
+
+    const std::map<const uint8_t, const std::shared_ptr<ElementaryFile>> getAllFiles() const
+        override
+    {
+        std::map<const uint8_t, const std::shared_ptr<ElementaryFile>> files;
+        for (const auto& ef : mIndex.getFiles()) {
+            if (ef->getSfi() != 0) {
+                files.insert({ef->getSfi(), ef});
+            }
+        }
+
+        return files;
+    }
+
+    const std::vector<std::shared_ptr<ElementaryFile>>& getFiles() const override
+    {
+        return mIndex.getFiles();
+    }
+
+    bool isDfRatified() const override
+    {
+        return true;
+    }
+
+    int getTransactionCounter() const override
+    {
+        return 0x001234;
+    }
+
+    bool isPkiModeSupported() const override
+    {
+        return false;
+    }
+
+    bool isExtendedModeSupported() const override
+    {
+        return true;
+    }
+
+    bool isRatificationOnDeselectSupported() const override
+    {
+        return true;
+    }
+
+    bool isPinFeatureAvailable() const override
+    {
+        return false;
+    }
+
+    bool isPinBlocked() const override
+    {
+        return false;
+    }
+
+    int getPinAttemptRemaining() const override
+    {
+        return 0;
+    }
+
+    bool isSvFeatureAvailable() const override
+    {
+        return true;
+    }
+
+    int getSvBalance() const override
+    {
+        return mSvDebitLogRecords.empty() ? 0 : mSvDebitLogRecords.back()->getBalance();
+    }
+
+    int getSvLastTNum() const override
+    {
+        return mSvDebitLogRecords.empty() ? 0 : mSvDebitLogRecords.back()->getSvTNum();
+    }
+
+    const std::shared_ptr<SvLoadLogRecord> getSvLoadLogRecord() override
+    {
+        return nullptr;
+    }
+
+    const std::shared_ptr<SvDebitLogRecord> getSvDebitLogLastRecord() override
+    {
+        return mSvDebitLogRecords.empty() ? nullptr : mSvDebitLogRecords.back();
+    }
+
+    const std::vector<std::shared_ptr<SvDebitLogRecord>> getSvDebitLogAllRecords() const override
+    {
+        return std::vector<std::shared_ptr<SvDebitLogRecord>>(mSvDebitLogRecords.begin(),
+                                                              mSvDebitLogRecords.end());
+    }
+
+private:
+    const ProductType mProductType;
+    const std::vector<uint8_t> mDfName;
+    const std::vector<uint8_t> mSerialNumber;
+    const std::vector<uint8_t> mStartupInfo;
+    const std::string mPowerOnData;
+    ElementaryFileIndex mIndex;
+    std::vector<std::shared_ptr<SvDebitLogRecordMock>> mSvDebitLogRecords;
+};
@@ -0,0 +1,202 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <regex>
+#include <string>
+#include <vector>
+
+/* Calypsonet Terminal Calypso */
+#include "CalypsoCard.h"
+#include "CalypsoCardSelection.h"
+
+/* Keyple Core Util */
+#include "IllegalArgumentException.h"
+
+using namespace calypsonet::terminal::calypso;
+using namespace calypsonet::terminal::calypso::card;
+using namespace keyple::core::util::cpp::exception;
+
+/**
+ * CalypsoCardSelection implementation keeping the filters and applying them to a card the way a
+ * selection manager does: card protocol, power-on data regex and right truncated DF name.
+ *
+ * <p>The prepared commands are only counted.
+ */
+class CalypsoCardSelectionMock final : public CalypsoCardSelection {
+public:
+    /**
+     * Tells if the provided card passes all the filters.
+     */
+    bool matches(const std::string& cardProtocol, const CalypsoCard& calypsoCard) const
+    {
+        if (!mCardProtocol.empty() && mCardProtocol != cardProtocol) {
+            return false;
+        }
+
+        if (mHasPowerOnDataFilter &&
+            !std::regex_match(calypsoCard.getPowerOnData(), mPowerOnDataRegex)) {
+            return false;
+        }
+
+        if (!mAid.empty()) {
+            const ByteView dfName = calypsoCard.getDfNameView();
+            if (dfName.size() < mAid.size() ||
+                !std::equal(mAid.begin(), mAid.end(), dfName.begin())) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    int getPreparedCommandsNumber() const
+    {
+        return mPreparedCommandsNumber;
+    }
+
+    CalypsoCardSelection& filterByCardProtocol(const std::string& cardProtocol) override
+    {
+        if (cardProtocol.empty()) {
+            throw IllegalArgumentException("cardProtocol");
+        }
+
+        mCardProtocol = cardProtocol;
+
+        return *this;
+    }
+
+    CalypsoCardSelection& filterByPowerOnData(const std::string& powerOnDataRegex) override
+    {
+        mPowerOnDataRegex = std::regex(powerOnDataRegex);
+        mHasPowerOnDataFilter = true;
+
+        return *this;
+    }
+
+    CalypsoCardSelection& filterByDfName(const std::vector<uint8_t>& aid) override
+    {
+        if (aid.size() < 5 || aid.size() > 16) {
+            throw IllegalArgumentException("aid");
+        }
+
+        mAid = aid;
+
+        return *this;
+    }
+
+    CalypsoCardSelection& filterByDfName(const std::string& aid) override
+    {
+        if (aid.size() % 2 != 0) {
+            throw IllegalArgumentException("aid");
+        }
+
+        std::vector<uint8_t> bytes;
+        for (std::size_t i = 0; i < aid.size(); i += 2) {
+            bytes.push_back(static_cast<uint8_t>(std::stoi(aid.substr(i, 2), nullptr, 16)));
+        }
+
+        return filterByDfName(bytes);
+    }
+
+    CalypsoCardSelection& setFileOccurrence(const FileOccurrence fileOccurrence) override
+    {
+        (void)fileOccurrence;
+
+        return *this;
+    }
+
+    CalypsoCardSelection& setFileControlInformation(
+        const FileControlInformation fileControlInformation) override
+    {
+        (void)fileControlInformation;
+
+        return *this;
+    }
+
+    CalypsoCardSelection& addSuccessfulStatusWord(const int statusWord) override
+    {
+        (void)statusWord;
+
+        return *this;
+    }
+
+    CalypsoCardSelection& acceptInvalidatedCard() override
+    {
+        return *this;
+    }
+
+    CalypsoCardSelection& setMemoryArena(const std::shared_ptr<MemoryArenaSpi> arena) override
+    {
+        (void)arena;
+
+        return *this;
+    }
+
+    CalypsoCardSelection& prepareSelectFile(const std::vector<uint8_t>& lid) override
+    {
+        (void)lid;
+        mPreparedCommandsNumber++;
+
+        return *this;
+    }
+
+    CalypsoCardSelection& prepareSelectFile(const uint16_t lid) override
+    {
+        (void)lid;
+        mPreparedCommandsNumber++;
+
+        return *this;
+    }
+
+    CalypsoCardSelection& prepareSelectFile(const SelectFileControl selectControl) override
+    {
+        (void)selectControl;
+        mPreparedCommandsNumber++;
+
+        return *this;
+    }
+
+    CalypsoCardSelection& prepareReadRecordFile(const uint8_t sfi, const uint8_t recordNumber)
+        override
+    {
+        return prepareReadRecord(sfi, recordNumber);
+    }
+
+    CalypsoCardSelection& prepareReadRecord(const uint8_t sfi, const uint8_t recordNumber)
+        override
+    {
+        (void)sfi;
+        (void)recordNumber;
+        mPreparedCommandsNumber++;
+
+        return *this;
+    }
+
+    CalypsoCardSelection& prepareGetData(const GetDataTag tag) override
+    {
+        (void)tag;
+        mPreparedCommandsNumber++;
+
+        return *this;
+    }
+
+private:
+    std::string mCardProtocol;
+    std::regex mPowerOnDataRegex;
+    bool mHasPowerOnDataFilter = false;
+    std::vector<uint8_t> mAid;
+    int mPreparedCommandsNumber = 0;
+};
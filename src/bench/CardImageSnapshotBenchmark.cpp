@@ -0,0 +1,106 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+
+#include "benchmark/benchmark.h"
+
+/* Calypsonet Terminal Calypso */
+#include "CardImageSnapshot.h"
+#include "CardImageSnapshotWriter.h"
+#include "SnapshotCalypsoCard.h"
+
+/* Mocks */
+#include "CalypsoCardMock.h"
+
+static const int NB_FILES = 16;
+static const int NB_RECORDS = 4;
+static const int RECORD_SIZE = 29;
+
+static std::shared_ptr<CalypsoCardMock> createCard()
+{
+    auto card = std::make_shared<CalypsoCardMock>();
+
+    for (int i = 0; i < NB_FILES; i++) {
+        ElementaryFileMock& ef = card->addFile(static_cast<uint8_t>(i + 1),
+                                               static_cast<uint16_t>(0x2000 + i),
+                                               ElementaryFile::Type::LINEAR,
+                                               NB_RECORDS,
+                                               RECORD_SIZE);
+        for (int numRecord = 1; numRecord <= NB_RECORDS; numRecord++) {
+            ef.getDataMock().setContent(static_cast<uint8_t>(numRecord),
+                                        std::vector<uint8_t>(RECORD_SIZE,
+                                                             static_cast<uint8_t>(i + numRecord)));
+        }
+    }
+
+    for (int i = 0; i < 3; i++) {
+        card->addSvDebitLogRecord(std::vector<uint8_t>(SvDebitLogRecordMock::RECORD_SIZE,
+                                                       static_cast<uint8_t>(i)));
+    }
+
+    return card;
+}
+
+static void BM_writeCardImageSnapshot(benchmark::State& state)
+{
+    const std::shared_ptr<CalypsoCardMock> card = createCard();
+    std::vector<uint8_t> image;
+
+    for (auto _ : state) {
+        CardImageSnapshotWriter::write(card, image);
+        benchmark::DoNotOptimize(image.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * image.size());
+}
+BENCHMARK(BM_writeCardImageSnapshot);
+
+static void BM_openCardImageSnapshot(benchmark::State& state)
+{
+    std::vector<uint8_t> image;
+    CardImageSnapshotWriter::write(createCard(), image);
+
+    for (auto _ : state) {
+        const CardImageSnapshot snapshot(ByteView(image.data(), image.size()));
+        benchmark::DoNotOptimize(snapshot.getFilesNumber());
+    }
+}
+BENCHMARK(BM_openCardImageSnapshot);
+
+static void BM_loadSnapshotCalypsoCard(benchmark::State& state)
+{
+    std::vector<uint8_t> image;
+    CardImageSnapshotWriter::write(createCard(), image);
+
+    for (auto _ : state) {
+        const SnapshotCalypsoCard card(ByteView(image.data(), image.size()));
+        benchmark::DoNotOptimize(card.getFiles().data());
+    }
+}
+BENCHMARK(BM_loadSnapshotCalypsoCard);
+
+static void BM_readSnapshotCalypsoCardRecords(benchmark::State& state)
+{
+    std::vector<uint8_t> image;
+    CardImageSnapshotWriter::write(createCard(), image);
+    const SnapshotCalypsoCard card(ByteView(image.data(), image.size()));
+
+    for (auto _ : state) {
+        int sum = 0;
+        for (int sfi = 1; sfi <= NB_FILES; sfi++) {
+            const auto ef = card.getFileBySfi(static_cast<uint8_t>(sfi));
+            sum += ef->getData()->getContentView(NB_RECORDS)[0];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_readSnapshotCalypsoCardRecords);
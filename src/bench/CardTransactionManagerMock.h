@@ -0,0 +1,678 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+/* Calypsonet Terminal Calypso */
+#include "CalypsoCard.h"
+#include "CardTransactionManager.h"
+#include "CardTransactionPlan.h"
+
+/* Keyple Core Util */
+#include "IllegalArgumentException.h"
+#include "IllegalStateException.h"
+#include "UnsupportedOperationException.h"
+
+using namespace calypsonet::terminal::calypso;
+using namespace calypsonet::terminal::calypso::card;
+using namespace calypsonet::terminal::calypso::spi;
+using namespace calypsonet::terminal::calypso::transaction;
+using namespace calypsonet::terminal::reader;
+using namespace keyple::core::util::cpp::exception;
+
+/**
+ * Card command prepared by CardTransactionManagerMock: its encoded APDU and the part of the
+ * session buffer it consumes.
+ */
+struct PreparedCommandMock {
+    std::vector<uint8_t> apdu;
+    int sessionBufferBudget;
+};
+
+/**
+ * Immutable CardTransactionPlan holding a copy of the prepared commands.
+ */
+class CardTransactionPlanMock final : public CardTransactionPlan {
+public:
+    CardTransactionPlanMock(const CalypsoCard::ProductType productType,
+                            const uint8_t sessionModification,
+                            const std::vector<PreparedCommandMock>& commands)
+    : mProductType(productType),
+      mSessionModification(sessionModification),
+      mCommands(commands),
+      mSessionBufferBudget(0)
+    {
+        for (const auto& command : mCommands) {
+            mSessionBufferBudget += command.sessionBufferBudget;
+        }
+    }
+
+    const std::vector<PreparedCommandMock>& getCommands() const
+    {
+        return mCommands;
+    }
+
+    const CalypsoCard::ProductType& getProductType() const override
+    {
+        return mProductType;
+    }
+
+    uint8_t getSessionModification() const override
+    {
+        return mSessionModification;
+    }
+
+    int getCommandsNumber() const override
+    {
+        return static_cast<int>(mCommands.size());
+    }
+
+    int getApdusNumber() const override
+    {
+        return static_cast<int>(mCommands.size());
+    }
+
+    int getSessionBufferBudget() const override
+    {
+        return mSessionBufferBudget;
+    }
+
+private:
+    const CalypsoCard::ProductType mProductType;
+    const uint8_t mSessionModification;
+    const std::vector<PreparedCommandMock> mCommands;
+    int mSessionBufferBudget;
+};
+
+/**
+ * CardTransactionManager implementation encoding the prepared commands into ISO 7816-4 APDUs
+ * without any communication: the "process" methods simply discard the prepared commands.
+ *
+ * <p>The modifying commands consume "Lc + 6" bytes of the session buffer.
+ */
+class CardTransactionManagerMock final : public CardTransactionManager {
+public:
+    CardTransactionManagerMock(const std::shared_ptr<CardReader> cardReader,
+                               const std::shared_ptr<CalypsoCard> calypsoCard)
+    : mCardReader(cardReader), mCalypsoCard(calypsoCard) {}
+
+    const std::vector<PreparedCommandMock>& getPreparedCommands() const
+    {
+        return mCommands;
+    }
+
+    /* CommonTransactionManager */
+
+    const std::shared_ptr<CommonSecuritySetting> getSecuritySetting() const override
+    {
+        return nullptr;
+    }
+
+    const std::vector<std::vector<uint8_t>>& getTransactionAuditData() const override
+    {
+        return mAuditData;
+    }
+
+    CardTransactionManager& setTransactionObserver(
+        const std::shared_ptr<TransactionObserverSpi> observer) override
+    {
+        (void)observer;
+
+        return *this;
+    }
+
+    CardTransactionManager& prepareComputeSignature(const any data) override
+    {
+        (void)data;
+
+        throw UnsupportedOperationException("prepareComputeSignature");
+    }
+
+    CardTransactionManager& prepareVerifySignature(const any data) override
+    {
+        (void)data;
+
+        throw UnsupportedOperationException("prepareVerifySignature");
+    }
+
+    CardTransactionManager& prepareComputeBasicSignature(
+        const std::shared_ptr<BasicSignatureComputationData> data) override
+    {
+        (void)data;
+
+        throw UnsupportedOperationException("prepareComputeBasicSignature");
+    }
+
+    CardTransactionManager& prepareComputeTraceableSignature(
+        const std::shared_ptr<TraceableSignatureComputationData> data) override
+    {
+        (void)data;
+
+        throw UnsupportedOperationException("prepareComputeTraceableSignature");
+    }
+
+    CardTransactionManager& prepareVerifyBasicSignature(
+        const std::shared_ptr<BasicSignatureVerificationData> data) override
+    {
+        (void)data;
+
+        throw UnsupportedOperationException("prepareVerifyBasicSignature");
+    }
+
+    CardTransactionManager& prepareVerifyTraceableSignature(
+        const std::shared_ptr<TraceableSignatureVerificationData> data) override
+    {
+        (void)data;
+
+        throw UnsupportedOperationException("prepareVerifyTraceableSignature");
+    }
+
+    CardTransactionManager& processCommands() override
+    {
+        mCommands.clear();
+
+        return *this;
+    }
+
+    /* CardTransactionManager */
+
+    const std::shared_ptr<CardReader> getCardReader() const override
+    {
+        return mCardReader;
+    }
+
+    const std::shared_ptr<CalypsoCard> getCalypsoCard() const override
+    {
+        return mCalypsoCard;
+    }
+
+    const std::shared_ptr<CardSecuritySetting> getCardSecuritySetting() const override
+    {
+        return nullptr;
+    }
+
+    CardTransactionManager& reset(const std::shared_ptr<CardReader> cardReader,
+                                  const std::shared_ptr<CalypsoCard> calypsoCard) override
+    {
+        mCardReader = cardReader;
+        mCalypsoCard = calypsoCard;
+        mCommands.clear();
+
+        return *this;
+    }
+
+    CardTransactionManager& setMemoryArena(const std::shared_ptr<MemoryArenaSpi> arena) override
+    {
+        (void)arena;
+
+        return *this;
+    }
+
+    CardTransactionManager& prepareSelectFile(const std::vector<uint8_t>& lid) override
+    {
+        if (lid.size() != 2) {
+            throw IllegalArgumentException("lid");
+        }
+
+        return prepareSelectFile(static_cast<uint16_t>((lid[0] << 8) | lid[1]));
+    }
+
+    CardTransactionManager& prepareSelectFile(const uint16_t lid) override
+    {
+        return addCommand({0x00, 0xA4, 0x09, 0x00, 0x02,
+                           static_cast<uint8_t>(lid >> 8), static_cast<uint8_t>(lid), 0x00});
+    }
+
+    CardTransactionManager& prepareSelectFile(const SelectFileControl selectFileControl) override
+    {
+        const uint8_t p2 = selectFileControl == SelectFileControl::FIRST_EF ? 0x00 :
+                           selectFileControl == SelectFileControl::NEXT_EF ? 0x02 : 0x09;
+
+        return addCommand({0x00, 0xA4, 0x02, p2, 0x02, 0x00, 0x00, 0x00});
+    }
+
+    CardTransactionManager& prepareGetData(const GetDataTag tag) override
+    {
+        const uint8_t p2 = tag == GetDataTag::FCP_FOR_CURRENT_FILE ? 0x62 :
+                           tag == GetDataTag::FCI_FOR_CURRENT_DF ? 0x6F :
+                           tag == GetDataTag::EF_LIST ? 0xC0 : 0x85;
+
+        return addCommand({0x00, 0xCA, 0x00, p2, 0x00});
+    }
+
+    CardTransactionManager& prepareReadRecordFile(const uint8_t sfi, const uint8_t recordNumber)
+        override
+    {
+        return prepareReadRecord(sfi, recordNumber);
+    }
+
+    CardTransactionManager& prepareReadRecordFile(const uint8_t sfi,
+                                                  const uint8_t firstRecordNumber,
+                                                  const uint8_t numberOfRecords,
+                                                  const uint8_t recordSize) override
+    {
+        return prepareReadRecords(sfi,
+                                  firstRecordNumber,
+                                  static_cast<uint8_t>(firstRecordNumber + numberOfRecords - 1),
+                                  recordSize);
+    }
+
+    CardTransactionManager& prepareReadCounterFile(const uint8_t sfi,
+                                                   const uint8_t countersNumber) override
+    {
+        return prepareReadCounter(sfi, countersNumber);
+    }
+
+    CardTransactionManager& prepareReadRecord(const uint8_t sfi, const uint8_t recordNumber)
+        override
+    {
+        return addCommand({0x00, 0xB2, recordNumber, static_cast<uint8_t>((sfi << 3) | 4), 0x00});
+    }
+
+    CardTransactionManager& prepareReadRecords(const uint8_t sfi,
+                                               const uint8_t fromRecordNumber,
+                                               const uint8_t toRecordNumber,
+                                               const uint8_t recordSize) override
+    {
+        if (fromRecordNumber == toRecordNumber) {
+            return prepareReadRecord(sfi, fromRecordNumber);
+        }
+
+        const int length = (toRecordNumber - fromRecordNumber + 1) * (recordSize + 2);
+
+        return addCommand({0x00,
+                           0xB2,
+                           fromRecordNumber,
+                           static_cast<uint8_t>((sfi << 3) | 5),
+                           static_cast<uint8_t>(length)});
+    }
+
+    CardTransactionManager& prepareReadRecordsPartially(const uint8_t sfi,
+                                                        const uint8_t fromRecordNumber,
+                                                        const uint8_t toRecordNumber,
+                                                        const uint8_t offset,
+                                                        const uint8_t nbBytesToRead) override
+    {
+        const int length = (toRecordNumber - fromRecordNumber + 1) * nbBytesToRead;
+
+        return addCommand({0x00, 0xB3, fromRecordNumber, static_cast<uint8_t>((sfi << 3) | 5),
+                           0x04, 0x54, 0x02, offset, nbBytesToRead,
+                           static_cast<uint8_t>(length)});
+    }
+
+    CardTransactionManager& prepareReadBinary(const uint8_t sfi,
+                                              const int offset,
+                                              const int nbBytesToRead) override
+    {
+        return addCommand({0x00,
+                           0xB0,
+                           static_cast<uint8_t>(0x80 | sfi),
+                           static_cast<uint8_t>(offset),
+                           static_cast<uint8_t>(nbBytesToRead)});
+    }
+
+    CardTransactionManager& prepareReadCounter(const uint8_t sfi,
+                                               const uint8_t nbCountersToRead) override
+    {
+        (void)nbCountersToRead;
+
+        return prepareReadRecord(sfi, 1);
+    }
+
+    CardTransactionManager& prepareSearchRecords(const std::shared_ptr<SearchCommandData> data)
+        override
+    {
+        (void)data;
+
+        throw UnsupportedOperationException("prepareSearchRecords");
+    }
+
+    bool searchRecordsInCardImage(const std::shared_ptr<SearchCommandData> data) const override
+    {
+        (void)data;
+
+        throw UnsupportedOperationException("searchRecordsInCardImage");
+    }
+
+    CardTransactionManager& prepareCheckPinStatus() override
+    {
+        return addCommand({0x00, 0x20, 0x00, 0x00, 0x00});
+    }
+
+    CardTransactionManager& prepareAppendRecord(const uint8_t sfi,
+                                                const std::vector<uint8_t>& recordData) override
+    {
+        return addModifyingCommand(0xE2, 0x00, static_cast<uint8_t>(sfi << 3), recordData);
+    }
+
+    CardTransactionManager& prepareUpdateRecord(const uint8_t sfi,
+                                                const uint8_t recordNumber,
+                                                const std::vector<uint8_t>& recordData) override
+    {
+        return addModifyingCommand(0xDC,
+                                   recordNumber,
+                                   static_cast<uint8_t>((sfi << 3) | 4),
+                                   recordData);
+    }
+
+    CardTransactionManager& prepareWriteRecord(const uint8_t sfi,
+                                               const uint8_t recordNumber,
+                                               const std::vector<uint8_t>& recordData) override
+    {
+        return addModifyingCommand(0xD2,
+                                   recordNumber,
+                                   static_cast<uint8_t>((sfi << 3) | 4),
+                                   recordData);
+    }
+
+    CardTransactionManager& prepareUpdateBinary(const uint8_t sfi,
+                                                const int offset,
+                                                const std::vector<uint8_t>& data) override
+    {
+        return addModifyingCommand(0xD6,
+                                   static_cast<uint8_t>(0x80 | sfi),
+                                   static_cast<uint8_t>(offset),
+                                   data);
+    }
+
+    CardTransactionManager& prepareWriteBinary(const uint8_t sfi,
+                                               const int offset,
+                                               const std::vector<uint8_t>& data) override
+    {
+        return addModifyingCommand(0xD0,
+                                   static_cast<uint8_t>(0x80 | sfi),
+                                   static_cast<uint8_t>(offset),
+                                   data);
+    }
+
+    CardTransactionManager& prepareIncreaseCounter(const uint8_t sfi,
+                                                   const uint8_t counterNumber,
+                                                   const int incValue) override
+    {
+        return addModifyingCommand(0x32,
+                                   counterNumber,
+                                   static_cast<uint8_t>(sfi << 3),
+                                   toCounterValue(incValue));
+    }
+
+    CardTransactionManager& prepareIncreaseCounters(
+        const uint8_t sfi, const std::map<const int, const int>& counterNumberToIncValueMap)
+        override
+    {
+        return addMultipleCounterCommand(0x3A, sfi, counterNumberToIncValueMap);
+    }
+
+    CardTransactionManager& prepareDecreaseCounter(const uint8_t sfi,
+                                                   const uint8_t counterNumber,
+                                                   const int decValue) override
+    {
+        return addModifyingCommand(0x30,
+                                   counterNumber,
+                                   static_cast<uint8_t>(sfi << 3),
+                                   toCounterValue(decValue));
+    }
+
+    CardTransactionManager& prepareDecreaseCounters(
+        const uint8_t sfi, const std::map<const int, const int>& counterNumberToDecValueMap)
+        override
+    {
+        return addMultipleCounterCommand(0x38, sfi, counterNumberToDecValueMap);
+    }
+
+    CardTransactionManager& prepareSetCounter(const uint8_t sfi,
+                                              const uint8_t counterNumber,
+                                              const int newValue) override
+    {
+        return prepareIncreaseCounter(sfi, counterNumber, newValue);
+    }
+
+    CardTransactionManager& prepareSvGet(const SvOperation svOperation,
+                                         const SvAction svAction) override
+    {
+        (void)svAction;
+
+        return addCommand({0x00, 0x7C, 0x00,
+                           static_cast<uint8_t>(svOperation == SvOperation::RELOAD ? 0x07 : 0x09),
+                           0x00});
+    }
+
+    CardTransactionManager& prepareSvReload(const int amount,
+                                            const std::vector<uint8_t>& date,
+                                            const std::vector<uint8_t>& time,
+                                            const std::vector<uint8_t>& free) override
+    {
+        (void)date;
+        (void)time;
+        (void)free;
+
+        return addModifyingCommand(0xB8, 0x55, 0x00, toCounterValue(amount));
+    }
+
+    CardTransactionManager& prepareSvReload(const int amount) override
+    {
+        return addModifyingCommand(0xB8, 0x55, 0x00, toCounterValue(amount));
+    }
+
+    CardTransactionManager& prepareSvDebit(const int amount,
+                                           const std::vector<uint8_t>& date,
+                                           const std::vector<uint8_t>& time) override
+    {
+        (void)date;
+        (void)time;
+
+        return addModifyingCommand(0xBA, 0x55, 0x00, toCounterValue(amount));
+    }
+
+    CardTransactionManager& prepareSvDebit(const int amount) override
+    {
+        return addModifyingCommand(0xBA, 0x55, 0x00, toCounterValue(amount));
+    }
+
+    CardTransactionManager& prepareSvReadAllLogs() override
+    {
+        prepareReadRecords(0x14, 1, 1, 29);
+
+        return prepareReadRecords(0x15, 1, 3, 29);
+    }
+
+    CardTransactionManager& prepareInvalidate() override
+    {
+        return addModifyingCommand(0x04, 0x00, 0x00, std::vector<uint8_t>());
+    }
+
+    CardTransactionManager& prepareRehabilitate() override
+    {
+        return addModifyingCommand(0x44, 0x00, 0x00, std::vector<uint8_t>());
+    }
+
+    CardTransactionManager& prepareReleaseCardChannel() override
+    {
+        return *this;
+    }
+
+    CardTransactionManager& enableCommandsMerging() override
+    {
+        return *this;
+    }
+
+    const std::shared_ptr<CardTransactionPlan> compileTransactionPlan() override
+    {
+        if (mCommands.empty()) {
+            throw IllegalStateException("No command prepared.");
+        }
+
+        auto plan = std::make_shared<CardTransactionPlanMock>(
+                        mCalypsoCard->getProductType(),
+                        mCalypsoCard->getSessionModification(),
+                        mCommands);
+        mCommands.clear();
+
+        return plan;
+    }
+
+    const std::shared_ptr<SessionBufferUsage> getSessionBufferUsage() const override
+    {
+        throw UnsupportedOperationException("getSessionBufferUsage");
+    }
+
+    CardTransactionManager& prepareTransactionPlan(const std::shared_ptr<CardTransactionPlan> plan)
+        override
+    {
+        const auto planMock = std::dynamic_pointer_cast<CardTransactionPlanMock>(plan);
+        if (planMock == nullptr ||
+            planMock->getProductType() != mCalypsoCard->getProductType() ||
+            planMock->getSessionModification() != mCalypsoCard->getSessionModification()) {
+            throw IllegalArgumentException("plan");
+        }
+
+        mCommands.insert(mCommands.end(),
+                         planMock->getCommands().begin(),
+                         planMock->getCommands().end());
+
+        return *this;
+    }
+
+    CardTransactionManager& processCardCommands() override
+    {
+        return processCommands();
+    }
+
+    CardTransactionManager& processVerifyPin(const std::vector<uint8_t>& pin) override
+    {
+        (void)pin;
+
+        throw UnsupportedOperationException("processVerifyPin");
+    }
+
+    CardTransactionManager& processChangePin(const std::vector<uint8_t>& newPin) override
+    {
+        (void)newPin;
+
+        throw UnsupportedOperationException("processChangePin");
+    }
+
+    CardTransactionManager& processChangeKey(const uint8_t keyIndex,
+                                             const uint8_t newKif,
+                                             const uint8_t newKvc,
+                                             const uint8_t issuerKif,
+                                             const uint8_t issuerKvc) override
+    {
+        (void)keyIndex;
+        (void)newKif;
+        (void)newKvc;
+        (void)issuerKif;
+        (void)issuerKvc;
+
+        throw UnsupportedOperationException("processChangeKey");
+    }
+
+    CardTransactionManager& processOpening(const WriteAccessLevel writeAccessLevel) override
+    {
+        (void)writeAccessLevel;
+        mCommands.clear();
+
+        return *this;
+    }
+
+    CardTransactionManager& processClosing() override
+    {
+        mCommands.clear();
+
+        return *this;
+    }
+
+    CardTransactionManager& processCancel() override
+    {
+        mCommands.clear();
+
+        return *this;
+    }
+
+    void processOpeningAsync(const WriteAccessLevel writeAccessLevel,
+                             const std::shared_ptr<TransactionExecutorSpi> executor,
+                             const std::shared_ptr<CardTransactionCallbackSpi> callback) override
+    {
+        (void)writeAccessLevel;
+        (void)executor;
+        (void)callback;
+
+        throw UnsupportedOperationException("processOpeningAsync");
+    }
+
+    void processCommandsAsync(const std::shared_ptr<TransactionExecutorSpi> executor,
+                              const std::shared_ptr<CardTransactionCallbackSpi> callback) override
+    {
+        (void)executor;
+        (void)callback;
+
+        throw UnsupportedOperationException("processCommandsAsync");
+    }
+
+    void processClosingAsync(const std::shared_ptr<TransactionExecutorSpi> executor,
+                             const std::shared_ptr<CardTransactionCallbackSpi> callback) override
+    {
+        (void)executor;
+        (void)callback;
+
+        throw UnsupportedOperationException("processClosingAsync");
+    }
+
+private:
+    std::shared_ptr<CardReader> mCardReader;
+    std::shared_ptr<CalypsoCard> mCalypsoCard;
+    std::vector<PreparedCommandMock> mCommands;
+    const std::vector<std::vector<uint8_t>> mAuditData;
+
+    CardTransactionManager& addCommand(const std::vector<uint8_t>& apdu)
+    {
+        mCommands.push_back({apdu, 0});
+
+        return *this;
+    }
+
+    CardTransactionManager& addModifyingCommand(const uint8_t ins,
+                                                const uint8_t p1,
+                                                const uint8_t p2,
+                                                const std::vector<uint8_t>& data)
+    {
+        std::vector<uint8_t> apdu = {0x00, ins, p1, p2, static_cast<uint8_t>(data.size())};
+        apdu.insert(apdu.end(), data.begin(), data.end());
+        mCommands.push_back({apdu, static_cast<int>(data.size()) + 6});
+
+        return *this;
+    }
+
+    CardTransactionManager& addMultipleCounterCommand(const uint8_t ins,
+                                                      const uint8_t sfi,
+                                                      const std::map<const int, const int>& values)
+    {
+        std::vector<uint8_t> data;
+        for (const auto& entry : values) {
+            data.push_back(static_cast<uint8_t>(entry.first));
+            const std::vector<uint8_t> value = toCounterValue(entry.second);
+            data.insert(data.end(), value.begin(), value.end());
+        }
+
+        return addModifyingCommand(ins, 0x00, static_cast<uint8_t>(sfi << 3), data);
+    }
+
+    static std::vector<uint8_t> toCounterValue(const int value)
+    {
+        return {static_cast<uint8_t>(value >> 16),
+                static_cast<uint8_t>(value >> 8),
+                static_cast<uint8_t>(value)};
+    }
+};
@@ -0,0 +1,79 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "benchmark/benchmark.h"
+
+/* Mocks */
+#include "FileDataMock.h"
+
+/* A counters EF record of 29 bytes (9 counters + 2 unused bytes) */
+static const int NB_COUNTERS = 9;
+
+static FileDataMock createCountersFile()
+{
+    FileDataMock fileData;
+    std::vector<uint8_t> record(29);
+
+    for (std::size_t i = 0; i < record.size(); i++) {
+        record[i] = static_cast<uint8_t>(i * 7);
+    }
+
+    fileData.setContent(1, record);
+
+    return fileData;
+}
+
+static void BM_getContentAsCounterValue(benchmark::State& state)
+{
+    const FileDataMock fileData = createCountersFile();
+
+    for (auto _ : state) {
+        int sum = 0;
+        for (int c = 1; c <= NB_COUNTERS; c++) {
+            sum += *fileData.getContentAsCounterValue(c);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_getContentAsCounterValue);
+
+static void BM_getAllCountersValue(benchmark::State& state)
+{
+    const FileDataMock fileData = createCountersFile();
+
+    for (auto _ : state) {
+        int sum = 0;
+        for (const auto& counter : fileData.getAllCountersValue()) {
+            sum += counter.second;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_getAllCountersValue);
+
+static void BM_getCountersView(benchmark::State& state)
+{
+    const FileDataMock fileData = createCountersFile();
+
+    for (auto _ : state) {
+        const CounterView counters = fileData.getCountersView();
+        int sum = 0;
+        int value;
+        for (int c = 1; c <= NB_COUNTERS; c++) {
+            if (counters.getValue(c, value)) {
+                sum += value;
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_getCountersView);
@@ -0,0 +1,66 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+#include <cstdint>
+#include <vector>
+
+/* Calypsonet Terminal Calypso */
+#include "DirectoryHeader.h"
+
+using namespace calypsonet::terminal::calypso;
+using namespace calypsonet::terminal::calypso::card;
+
+/**
+ * DirectoryHeader implementation using the KIF/KVC of the test keys of the Calypso
+ * specification.
+ */
+class DirectoryHeaderMock final : public DirectoryHeader {
+public:
+    DirectoryHeaderMock() : mAccessConditions(4, 0x10), mKeyIndexes(4, 0x01) {}
+
+    uint16_t getLid() const override
+    {
+        return 0x3F00;
+    }
+
+    uint8_t getDfStatus() const override
+    {
+        return 0x00;
+    }
+
+    const std::vector<uint8_t>& getAccessConditions() const override
+    {
+        return mAccessConditions;
+    }
+
+    const std::vector<uint8_t>& getKeyIndexes() const override
+    {
+        return mKeyIndexes;
+    }
+
+    uint8_t getKif(const WriteAccessLevel writeAccessLevel) const override
+    {
+        return writeAccessLevel == WriteAccessLevel::PERSONALIZATION ? 0x21 :
+               writeAccessLevel == WriteAccessLevel::LOAD ? 0x27 : 0x30;
+    }
+
+    uint8_t getKvc(const WriteAccessLevel writeAccessLevel) const override
+    {
+        return writeAccessLevel == WriteAccessLevel::PERSONALIZATION ? 0x77 :
+               writeAccessLevel == WriteAccessLevel::LOAD ? 0x78 : 0x79;
+    }
+
+private:
+    const std::vector<uint8_t> mAccessConditions;
+    const std::vector<uint8_t> mKeyIndexes;
+};
@@ -0,0 +1,64 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+#include <cstdint>
+#include <memory>
+
+/* Calypsonet Terminal Calypso */
+#include "ElementaryFile.h"
+
+/* Mocks */
+#include "FileDataMock.h"
+#include "FileHeaderMock.h"
+
+using namespace calypsonet::terminal::calypso::card;
+
+/**
+ * ElementaryFile implementation owning a FileHeaderMock and a FileDataMock.
+ */
+class ElementaryFileMock final : public ElementaryFile {
+public:
+    ElementaryFileMock(const uint8_t sfi,
+                       const uint16_t lid,
+                       const ElementaryFile::Type efType,
+                       const int recordsNumber,
+                       const int recordSize)
+    : mSfi(sfi),
+      mHeader(std::make_shared<FileHeaderMock>(lid, efType, recordsNumber, recordSize)),
+      mData(std::make_shared<FileDataMock>()) {}
+
+    uint8_t getSfi() const override
+    {
+        return mSfi;
+    }
+
+    const std::shared_ptr<FileHeader> getHeader() const override
+    {
+        return mHeader;
+    }
+
+    const std::shared_ptr<FileData> getData() const override
+    {
+        return mData;
+    }
+
+    FileDataMock& getDataMock()
+    {
+        return *mData;
+    }
+
+private:
+    const uint8_t mSfi;
+    const std::shared_ptr<FileHeaderMock> mHeader;
+    const std::shared_ptr<FileDataMock> mData;
+};
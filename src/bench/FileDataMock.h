@@ -0,0 +1,143 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+/* Calypsonet Terminal Calypso */
+#include "FileData.h"
+
+/* Keyple Core Util */
+#include "IllegalArgumentException.h"
+#include "IndexOutOfBoundsException.h"
+
+using namespace calypsonet::terminal::calypso::card;
+using namespace keyple::core::util::cpp::exception;
+
+/**
+ * FileData implementation keeping both the legacy map and the RecordStore, whose getters behave
+ * like the ones of the reference library.
+ */
+class FileDataMock final : public FileData {
+public:
+    void setContent(const uint8_t numRecord, const std::vector<uint8_t>& content)
+    {
+        mRecords[numRecord] = content;
+        mStore.setRecord(numRecord, content);
+    }
+
+    const std::vector<uint8_t> getContent() const override
+    {
+        return getContent(1);
+    }
+
+    const std::vector<uint8_t> getContent(const uint8_t numRecord) const override
+    {
+        const auto it = mRecords.find(numRecord);
+
+        return it == mRecords.end() ? std::vector<uint8_t>() : it->second;
+    }
+
+    const std::vector<uint8_t> getContent(const uint8_t numRecord,
+                                          const uint8_t dataOffset,
+                                          const uint8_t dataLength) const override
+    {
+        const auto it = mRecords.find(numRecord);
+        if (it == mRecords.end()) {
+            return std::vector<uint8_t>();
+        }
+
+        if (dataOffset + dataLength > static_cast<int>(it->second.size())) {
+            throw IndexOutOfBoundsException("Out of record bounds.");
+        }
+
+        return std::vector<uint8_t>(it->second.begin() + dataOffset,
+                                    it->second.begin() + dataOffset + dataLength);
+    }
+
+    const ByteView getContentView() const override
+    {
+        return mStore.getRecord(1);
+    }
+
+    const ByteView getContentView(const uint8_t numRecord) const override
+    {
+        return mStore.getRecord(numRecord);
+    }
+
+    const std::map<const uint8_t, std::vector<uint8_t>>& getAllRecordsContent() const override
+    {
+        return mRecords;
+    }
+
+    const RecordStore& getRecordStore() const override
+    {
+        return mStore;
+    }
+
+    const std::shared_ptr<int> getContentAsCounterValue(const int numCounter) const override
+    {
+        if (numCounter < 1) {
+            throw IllegalArgumentException("numCounter < 1");
+        }
+
+        const auto it = mRecords.find(1);
+        if (it == mRecords.end()) {
+            return nullptr;
+        }
+
+        const std::vector<uint8_t>& rec1 = it->second;
+        const int counterIndex = (numCounter - 1) * 3;
+        if (counterIndex >= static_cast<int>(rec1.size())) {
+            return nullptr;
+        }
+
+        if (counterIndex + 3 > static_cast<int>(rec1.size())) {
+            throw IndexOutOfBoundsException("Truncated counter.");
+        }
+
+        return std::make_shared<int>((rec1[counterIndex] << 16) |
+                                     (rec1[counterIndex + 1] << 8) |
+                                     rec1[counterIndex + 2]);
+    }
+
+    const std::map<const int, const int> getAllCountersValue() const override
+    {
+        std::map<const int, const int> result;
+
+        const auto it = mRecords.find(1);
+        if (it == mRecords.end()) {
+            return result;
+        }
+
+        const std::vector<uint8_t>& rec1 = it->second;
+        const int length = static_cast<int>(rec1.size()) - static_cast<int>(rec1.size()) % 3;
+        for (int i = 0, c = 1; i < length; i += 3, c++) {
+            result.insert({c, (rec1[i] << 16) | (rec1[i + 1] << 8) | rec1[i + 2]});
+        }
+
+        return result;
+    }
+
+    const CounterView getCountersView() const override
+    {
+        return CounterView(mStore.getRecord(1));
+    }
+
+private:
+    std::map<const uint8_t, std::vector<uint8_t>> mRecords;
+    RecordStore mStore;
+};
@@ -0,0 +1,86 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/* Calypsonet Terminal Calypso */
+#include "FileHeader.h"
+
+using namespace calypsonet::terminal::calypso::card;
+
+/**
+ * Immutable FileHeader implementation.
+ */
+class FileHeaderMock final : public FileHeader {
+public:
+    FileHeaderMock(const uint16_t lid,
+                   const ElementaryFile::Type efType,
+                   const int recordsNumber,
+                   const int recordSize)
+    : mLid(lid),
+      mEfType(efType),
+      mRecordsNumber(recordsNumber),
+      mRecordSize(recordSize),
+      mAccessConditions(4),
+      mKeyIndexes(4) {}
+
+    uint16_t getLid() const override
+    {
+        return mLid;
+    }
+
+    const std::shared_ptr<uint8_t> getDfStatus() const override
+    {
+        return nullptr;
+    }
+
+    ElementaryFile::Type getEfType() const override
+    {
+        return mEfType;
+    }
+
+    int getRecordsNumber() const override
+    {
+        return mRecordsNumber;
+    }
+
+    int getRecordSize() const override
+    {
+        return mRecordSize;
+    }
+
+    const std::vector<uint8_t>& getAccessConditions() const override
+    {
+        return mAccessConditions;
+    }
+
+    const std::vector<uint8_t>& getKeyIndexes() const override
+    {
+        return mKeyIndexes;
+    }
+
+    const std::shared_ptr<uint16_t> getSharedReference() const override
+    {
+        return nullptr;
+    }
+
+private:
+    const uint16_t mLid;
+    const ElementaryFile::Type mEfType;
+    const int mRecordsNumber;
+    const int mRecordSize;
+    const std::vector<uint8_t> mAccessConditions;
+    const std::vector<uint8_t> mKeyIndexes;
+};
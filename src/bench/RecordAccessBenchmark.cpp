@@ -0,0 +1,102 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "benchmark/benchmark.h"
+
+/* Mocks */
+#include "CalypsoCardMock.h"
+
+/* A typical ticketing image: environment, contracts, event log and counters */
+static const int NB_RECORDS = 4;
+static const int RECORD_SIZE = 29;
+
+static CalypsoCardMock createCard()
+{
+    CalypsoCardMock card;
+    const uint8_t sfis[] = {0x07, 0x08, 0x09, 0x19, 0x1D};
+    const uint16_t lids[] = {0x2001, 0x2010, 0x2020, 0x2030, 0x2069};
+
+    for (int f = 0; f < 5; f++) {
+        ElementaryFileMock& ef = card.addFile(sfis[f],
+                                              lids[f],
+                                              ElementaryFile::Type::LINEAR,
+                                              NB_RECORDS,
+                                              RECORD_SIZE);
+        for (int r = 1; r <= NB_RECORDS; r++) {
+            ef.getDataMock().setContent(static_cast<uint8_t>(r),
+                                        std::vector<uint8_t>(RECORD_SIZE,
+                                                             static_cast<uint8_t>(f * 16 + r)));
+        }
+    }
+
+    return card;
+}
+
+static void BM_getAllFilesThenGetContent(benchmark::State& state)
+{
+    const CalypsoCardMock card = createCard();
+
+    for (auto _ : state) {
+        int sum = 0;
+        const auto files = card.getAllFiles();
+        for (int r = 1; r <= NB_RECORDS; r++) {
+            sum += files.at(0x08)->getData()->getContent(static_cast<uint8_t>(r))[0];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_getAllFilesThenGetContent);
+
+static void BM_getFileBySfiThenGetContent(benchmark::State& state)
+{
+    const CalypsoCardMock card = createCard();
+
+    for (auto _ : state) {
+        int sum = 0;
+        const auto data = card.getFileBySfi(0x08)->getData();
+        for (int r = 1; r <= NB_RECORDS; r++) {
+            sum += data->getContent(static_cast<uint8_t>(r))[0];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_getFileBySfiThenGetContent);
+
+static void BM_getFileBySfiThenGetContentView(benchmark::State& state)
+{
+    const CalypsoCardMock card = createCard();
+
+    for (auto _ : state) {
+        int sum = 0;
+        const auto data = card.getFileBySfi(0x08)->getData();
+        for (int r = 1; r <= NB_RECORDS; r++) {
+            sum += data->getContentView(static_cast<uint8_t>(r))[0];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_getFileBySfiThenGetContentView);
+
+static void BM_getFileByLidThenGetRecordStore(benchmark::State& state)
+{
+    const CalypsoCardMock card = createCard();
+
+    for (auto _ : state) {
+        int sum = 0;
+        const RecordStore& store = card.getFileByLid(0x2010)->getData()->getRecordStore();
+        for (int r = 1; r <= NB_RECORDS; r++) {
+            sum += store.getRecord(static_cast<uint8_t>(r))[0];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_getFileByLidThenGetRecordStore);
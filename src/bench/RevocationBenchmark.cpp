@@ -0,0 +1,163 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+/* Calypsonet Terminal Calypso */
+#include "CachingSamRevocationService.h"
+#include "HotSwapSamRevocationService.h"
+#include "SamRevocationIndex.h"
+
+using namespace calypsonet::terminal::calypso::transaction;
+
+static const int REVOKED_SAMS_NUMBER = 100000;
+
+/* Revoked SAMs have an even serial number, the lookups alternate revoked and not revoked SAMs */
+static const std::shared_ptr<SamRevocationIndex>& getIndex()
+{
+    static const std::shared_ptr<SamRevocationIndex> index = [] {
+        SamRevocationIndex::Builder builder;
+        for (uint32_t i = 0; i < REVOKED_SAMS_NUMBER; i++) {
+            const uint32_t serial = i * 2 * 2654435761u;
+            builder.addRevokedSam({static_cast<uint8_t>(serial >> 24),
+                                   static_cast<uint8_t>(serial >> 16),
+                                   static_cast<uint8_t>(serial >> 8),
+                                   static_cast<uint8_t>(serial)},
+                                  static_cast<int>(i & 0xFFFF));
+        }
+        return std::make_shared<SamRevocationIndex>(builder.build());
+    }();
+
+    return index;
+}
+
+static std::array<uint8_t, 4> getSerialNumber(const uint32_t i)
+{
+    const uint32_t serial = (i % (2 * REVOKED_SAMS_NUMBER)) * 2654435761u;
+
+    return {{static_cast<uint8_t>(serial >> 24), static_cast<uint8_t>(serial >> 16),
+             static_cast<uint8_t>(serial >> 8), static_cast<uint8_t>(serial)}};
+}
+
+static void BM_revocationIndexLookup_vector(benchmark::State& state)
+{
+    const auto& index = getIndex();
+    uint32_t i = 0;
+
+    for (auto _ : state) {
+        const std::array<uint8_t, 4> serialNumber = getSerialNumber(i++);
+        benchmark::DoNotOptimize(index->isSamRevoked(
+            std::vector<uint8_t>(serialNumber.begin(), serialNumber.end()), 0x8000));
+    }
+}
+BENCHMARK(BM_revocationIndexLookup_vector);
+
+static void BM_revocationIndexLookup_array(benchmark::State& state)
+{
+    const auto& index = getIndex();
+    uint32_t i = 0;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(index->isSamRevokedBySerial4(getSerialNumber(i++), 0x8000));
+    }
+}
+BENCHMARK(BM_revocationIndexLookup_array);
+
+static void BM_revocationIndexLookup_partial(benchmark::State& state)
+{
+    const auto& index = getIndex();
+    uint32_t i = 0;
+
+    for (auto _ : state) {
+        const std::array<uint8_t, 4> serialNumber = getSerialNumber(i++);
+        benchmark::DoNotOptimize(index->isSamRevokedBySerial3(
+            {{serialNumber[1], serialNumber[2], serialNumber[3]}},
+            SamRevocationServiceSpi::RevocationQuery::NO_COUNTER));
+    }
+}
+BENCHMARK(BM_revocationIndexLookup_partial);
+
+/* Checks from several threads through the hot swap wrapper */
+static void BM_hotSwapRevocationLookup(benchmark::State& state)
+{
+    static HotSwapSamRevocationService service(getIndex());
+    uint32_t i = static_cast<uint32_t>(state.thread_index()) * 7919;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(service.isSamRevokedBySerial4(getSerialNumber(i++), 0x8000));
+    }
+}
+BENCHMARK(BM_hotSwapRevocationLookup)->ThreadRange(1, 8);
+
+/* Arguments: batch size */
+static void BM_revocationIndexBatch(benchmark::State& state)
+{
+    const auto& index = getIndex();
+    std::vector<SamRevocationServiceSpi::RevocationQuery> queries;
+    for (uint32_t i = 0; i < static_cast<uint32_t>(state.range(0)); i++) {
+        queries.emplace_back(getSerialNumber(i), 0x8000);
+    }
+    std::vector<bool> revoked;
+
+    for (auto _ : state) {
+        index->areSamsRevoked(queries, revoked);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_revocationIndexBatch)->Arg(64)->Arg(4096);
+
+/* Back office answering from the index after a fixed latency */
+class SlowSamRevocationService final : public SamRevocationServiceSpi {
+public:
+    bool isSamRevoked(const std::vector<uint8_t>& serialNumber) const override
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+
+        return getIndex()->isSamRevoked(serialNumber);
+    }
+
+    bool isSamRevoked(const std::vector<uint8_t>& serialNumber, const int counterValue)
+        const override
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+
+        return getIndex()->isSamRevoked(serialNumber, counterValue);
+    }
+};
+
+/* Checks of a few hundred SAMs from several threads, once the cache is warm */
+static void BM_cachedRevocationLookup(benchmark::State& state)
+{
+    static CachingSamRevocationService cache(std::make_shared<SlowSamRevocationService>(),
+                                             4096,
+                                             std::chrono::milliseconds(3600000));
+    uint32_t i = static_cast<uint32_t>(state.thread_index()) * 7919;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cache.isSamRevokedBySerial4(getSerialNumber(i++ % 500), 0x8000));
+    }
+
+    if (state.thread_index() == 0) {
+        state.counters["misses"] = static_cast<double>(cache.getMissesNumber());
+    }
+}
+BENCHMARK(BM_cachedRevocationLookup)->ThreadRange(1, 8);
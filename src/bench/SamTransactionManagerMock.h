@@ -0,0 +1,219 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+
+#pragma once
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/* Calypsonet Terminal Calypso */
+#include "InvalidSignatureException.h"
+#include "SamResourcePoolSpi.h"
+#include "SamRevocationServiceSpi.h"
+#include "SamRevokedException.h"
+#include "SamTransactionManager.h"
+
+/* Mocks */
+#include "TraceableSignatureVerificationDataMock.h"
+
+/* Keyple Core Util */
+#include "IllegalArgumentException.h"
+#include "IllegalStateException.h"
+#include "UnsupportedOperationException.h"
+
+using namespace calypsonet::terminal::calypso::sam;
+using namespace calypsonet::terminal::calypso::spi;
+using namespace calypsonet::terminal::calypso::transaction;
+using namespace calypsonet::terminal::reader;
+using namespace keyple::core::util::cpp::exception;
+
+/**
+ * SamTransactionManager implementation verifying TraceableSignatureVerificationDataMock requests
+ * without any communication.
+ *
+ * <p>The revocation status of the signing SAM is checked when the command is prepared, like the
+ * reference library does. processCommands() sleeps for a fixed exchange time plus a time per
+ * command to mimic the SAM latency, then sets the results in order, stopping with an
+ * InvalidSignatureException at the first incorrect signature.
+ */
+class SamTransactionManagerMock final : public SamTransactionManager {
+public:
+    SamTransactionManagerMock(const std::shared_ptr<SamResourcePoolSpi::SamResource> samResource,
+                              const std::shared_ptr<SamRevocationServiceSpi> samRevocationService,
+                              const std::chrono::microseconds exchangeTime,
+                              const std::chrono::microseconds commandTime)
+    : mSamResource(samResource),
+      mSamRevocationService(samRevocationService),
+      mExchangeTime(exchangeTime),
+      mCommandTime(commandTime) {}
+
+    /* CommonTransactionManager */
+
+    const std::shared_ptr<CommonSecuritySetting> getSecuritySetting() const override
+    {
+        return nullptr;
+    }
+
+    const std::vector<std::vector<uint8_t>>& getTransactionAuditData() const override
+    {
+        return mAuditData;
+    }
+
+    SamTransactionManager& setTransactionObserver(
+        const std::shared_ptr<TransactionObserverSpi> observer) override
+    {
+        (void)observer;
+
+        return *this;
+    }
+
+    SamTransactionManager& prepareComputeSignature(const any data) override
+    {
+        (void)data;
+
+        throw UnsupportedOperationException("prepareComputeSignature");
+    }
+
+    SamTransactionManager& prepareVerifySignature(const any data) override
+    {
+        (void)data;
+
+        throw UnsupportedOperationException("prepareVerifySignature");
+    }
+
+    SamTransactionManager& prepareComputeBasicSignature(
+        const std::shared_ptr<BasicSignatureComputationData> data) override
+    {
+        (void)data;
+
+        throw UnsupportedOperationException("prepareComputeBasicSignature");
+    }
+
+    SamTransactionManager& prepareComputeTraceableSignature(
+        const std::shared_ptr<TraceableSignatureComputationData> data) override
+    {
+        (void)data;
+
+        throw UnsupportedOperationException("prepareComputeTraceableSignature");
+    }
+
+    SamTransactionManager& prepareVerifyBasicSignature(
+        const std::shared_ptr<BasicSignatureVerificationData> data) override
+    {
+        (void)data;
+
+        throw UnsupportedOperationException("prepareVerifyBasicSignature");
+    }
+
+    SamTransactionManager& prepareVerifyTraceableSignature(
+        const std::shared_ptr<TraceableSignatureVerificationData> data) override
+    {
+        const auto request =
+            std::dynamic_pointer_cast<TraceableSignatureVerificationDataMock>(data);
+        if (request == nullptr) {
+            throw IllegalArgumentException("Unsupported verification data");
+        }
+
+        if (request->isSamRevocationStatusChecked()) {
+            if (mSamRevocationService == nullptr) {
+                throw IllegalStateException("No SAM revocation service registered");
+            }
+
+            if (mSamRevocationService->isSamRevoked(request->getSamSerialNumber(),
+                                                    request->getSamCounterValue())) {
+                throw SamRevokedException("The SAM is revoked");
+            }
+        }
+
+        request->reset();
+        mPrepared.push_back(request);
+
+        return *this;
+    }
+
+    SamTransactionManager& processCommands() override
+    {
+        if (mPrepared.empty()) {
+            return *this;
+        }
+
+        std::this_thread::sleep_for(
+            mExchangeTime + mCommandTime * static_cast<int>(mPrepared.size()));
+
+        std::vector<std::shared_ptr<TraceableSignatureVerificationDataMock>> prepared;
+        prepared.swap(mPrepared);
+
+        for (const auto& request : prepared) {
+            request->setSignatureValid(request->isSignatureCorrect());
+            if (!request->isSignatureCorrect()) {
+                throw InvalidSignatureException("Invalid signature");
+            }
+        }
+
+        return *this;
+    }
+
+    /* SamTransactionManager */
+
+    const std::shared_ptr<CardReader> getSamReader() const override
+    {
+        return mSamResource->getSamReader();
+    }
+
+    const std::shared_ptr<CalypsoSam> getCalypsoSam() const override
+    {
+        return mSamResource->getCalypsoSam();
+    }
+
+    SamTransactionManager& prepareComputeSignatures(
+        const std::vector<std::shared_ptr<BasicSignatureComputationData>>& data,
+        SignatureBatchOutput& output) override
+    {
+        (void)data;
+        (void)output;
+
+        throw UnsupportedOperationException("prepareComputeSignatures");
+    }
+
+    SamTransactionManager& prepareComputeSignatures(
+        const std::vector<std::shared_ptr<TraceableSignatureComputationData>>& data,
+        SignatureBatchOutput& output) override
+    {
+        (void)data;
+        (void)output;
+
+        throw UnsupportedOperationException("prepareComputeSignatures");
+    }
+
+    SamTransactionManager& areSamsRevoked(
+        const std::vector<SamRevocationServiceSpi::RevocationQuery>& queries,
+        std::vector<bool>& revoked) override
+    {
+        if (mSamRevocationService == nullptr) {
+            throw IllegalStateException("No SAM revocation service registered");
+        }
+
+        mSamRevocationService->areSamsRevoked(queries, revoked);
+
+        return *this;
+    }
+
+private:
+    const std::shared_ptr<SamResourcePoolSpi::SamResource> mSamResource;
+    const std::shared_ptr<SamRevocationServiceSpi> mSamRevocationService;
+    const std::chrono::microseconds mExchangeTime;
+    const std::chrono::microseconds mCommandTime;
+    const std::vector<std::vector<uint8_t>> mAuditData;
+    std::vector<std::shared_ptr<TraceableSignatureVerificationDataMock>> mPrepared;
+};
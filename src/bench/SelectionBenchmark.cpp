@@ -0,0 +1,57 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "benchmark/benchmark.h"
+
+/* Mocks */
+#include "CalypsoCardMock.h"
+#include "CalypsoCardSelectionMock.h"
+
+static const std::string CARD_PROTOCOL = "ISO_14443_4_CARD";
+
+static void BM_filterByDfName(benchmark::State& state)
+{
+    const CalypsoCardMock card;
+    CalypsoCardSelectionMock selection;
+    selection.filterByCardProtocol(CARD_PROTOCOL).filterByDfName("A000000404012509");
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(selection.matches(CARD_PROTOCOL, card));
+    }
+}
+BENCHMARK(BM_filterByDfName);
+
+static void BM_filterByPowerOnData(benchmark::State& state)
+{
+    const CalypsoCardMock card;
+    CalypsoCardSelectionMock selection;
+    selection.filterByCardProtocol(CARD_PROTOCOL).filterByPowerOnData("3B8F8001805A0A.*");
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(selection.matches(CARD_PROTOCOL, card));
+    }
+}
+BENCHMARK(BM_filterByPowerOnData);
+
+static void BM_buildSelection(benchmark::State& state)
+{
+    for (auto _ : state) {
+        CalypsoCardSelectionMock selection;
+        selection.filterByCardProtocol(CARD_PROTOCOL)
+                 .filterByDfName("A000000404012509")
+                 .acceptInvalidatedCard()
+                 .prepareReadRecord(0x07, 1)
+                 .prepareReadRecord(0x19, 1);
+        benchmark::DoNotOptimize(selection.getPreparedCommandsNumber());
+    }
+}
+BENCHMARK(BM_buildSelection);
@@ -0,0 +1,207 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+/* Calypsonet Terminal Calypso */
+#include "CalypsoSamSimulator.h"
+#include "LoadBalancedSamResourcePool.h"
+#include "ParallelSignatureVerifier.h"
+#include "SimulatedCardReader.h"
+
+/* Mocks */
+#include "SamTransactionManagerMock.h"
+#include "TraceableSignatureVerificationDataMock.h"
+
+using namespace calypsonet::terminal::calypso::sim;
+
+static const int REQUESTS_NUMBER = 2000;
+static const int SIGNING_SAMS_NUMBER = 300;
+static const int POOL_SAMS_NUMBER = 4;
+static const std::chrono::microseconds EXCHANGE_TIME(200);
+static const std::chrono::microseconds COMMAND_TIME(20);
+static const std::chrono::microseconds LOOKUP_TIME(20);
+
+/**
+ * Revocation service answering from a list after a fixed back office latency; the SAMs whose
+ * serial number ends with 0x00 are revoked.
+ */
+class SamRevocationServiceMock final : public SamRevocationServiceSpi {
+public:
+    bool isSamRevoked(const std::vector<uint8_t>& serialNumber) const override
+    {
+        std::this_thread::sleep_for(LOOKUP_TIME);
+
+        return serialNumber.back() == 0x00;
+    }
+
+    bool isSamRevoked(const std::vector<uint8_t>& serialNumber, const int counterValue)
+        const override
+    {
+        (void)counterValue;
+
+        return isSamRevoked(serialNumber);
+    }
+};
+
+class SamTransactionManagerFactoryMock final : public SamTransactionManagerFactorySpi {
+public:
+    std::shared_ptr<SamTransactionManager> createSamTransactionManager(
+        const std::shared_ptr<SamResourcePoolSpi::SamResource> samResource,
+        const std::shared_ptr<SamRevocationServiceSpi> samRevocationService) override
+    {
+        return std::make_shared<SamTransactionManagerMock>(
+                   samResource, samRevocationService, EXCHANGE_TIME, COMMAND_TIME);
+    }
+};
+
+class CountingListener final : public SignatureVerificationListenerSpi {
+public:
+    CountingListener() : mValidNumber(0), mInvalidNumber(0), mFailuresNumber(0) {}
+
+    void onSignatureVerified(const int index, const bool isSignatureValid) override
+    {
+        (void)index;
+
+        if (isSignatureValid) {
+            mValidNumber++;
+        } else {
+            mInvalidNumber++;
+        }
+    }
+
+    void onSignatureVerificationFailure(const int index, const std::exception_ptr error) override
+    {
+        (void)index;
+        (void)error;
+
+        mFailuresNumber++;
+    }
+
+    int getResultsNumber() const
+    {
+        return mValidNumber + mInvalidNumber + mFailuresNumber;
+    }
+
+private:
+    std::atomic<int> mValidNumber;
+    std::atomic<int> mInvalidNumber;
+    std::atomic<int> mFailuresNumber;
+};
+
+/*
+ * The signatures of an audit batch: each signing SAM produced several signatures, some of them
+ * uploaded several times (same counter value). One signature out of 100 is incorrect.
+ */
+static std::vector<std::shared_ptr<TraceableSignatureVerificationData>> createRequests()
+{
+    std::vector<std::shared_ptr<TraceableSignatureVerificationData>> requests;
+    requests.reserve(REQUESTS_NUMBER);
+
+    for (int i = 0; i < REQUESTS_NUMBER; i++) {
+        const int sam = i % SIGNING_SAMS_NUMBER;
+        auto request = std::make_shared<TraceableSignatureVerificationDataMock>(
+                           std::vector<uint8_t>({0x00, 0x00, static_cast<uint8_t>(sam >> 8),
+                                                 static_cast<uint8_t>(sam)}),
+                           (i / SIGNING_SAMS_NUMBER) % 4,
+                           i % 100 != 99);
+        request->withSamTraceabilityMode(0, false, true);
+        requests.push_back(request);
+    }
+
+    return requests;
+}
+
+static std::shared_ptr<LoadBalancedSamResourcePool> createPool()
+{
+    auto pool = std::make_shared<LoadBalancedSamResourcePool>(std::chrono::milliseconds(0));
+
+    for (int i = 0; i < POOL_SAMS_NUMBER; i++) {
+        pool->addSamResource(
+            std::make_shared<SimulatedCardReader>("sam" + std::to_string(i), false),
+            std::make_shared<CalypsoSamSimulator>(
+                std::vector<uint8_t>({0x00, 0x00, 0x00, static_cast<uint8_t>(i)}), 0));
+    }
+
+    return pool;
+}
+
+/* The current pipeline: one signature verified at a time through a single manager */
+static void BM_sequentialSignatureVerification(benchmark::State& state)
+{
+    const auto requests = createRequests();
+    auto pool = createPool();
+    SamTransactionManagerMock manager(pool->allocateSamResource(),
+                                      std::make_shared<SamRevocationServiceMock>(),
+                                      EXCHANGE_TIME,
+                                      COMMAND_TIME);
+
+    for (auto _ : state) {
+        int validNumber = 0;
+        for (const auto& request : requests) {
+            try {
+                manager.prepareVerifyTraceableSignature(request).processCommands();
+                validNumber++;
+            } catch (const RuntimeException&) {
+                /* Revoked SAM or invalid signature */
+            }
+        }
+        benchmark::DoNotOptimize(validNumber);
+    }
+
+    state.SetItemsProcessed(state.iterations() * REQUESTS_NUMBER);
+}
+BENCHMARK(BM_sequentialSignatureVerification)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+/*
+ * Arguments: number of worker threads, batch size. A SAM being allocated to a single worker at a
+ * time, the number of workers does not exceed the number of SAMs of the pool.
+ */
+static void BM_parallelSignatureVerification(benchmark::State& state)
+{
+    const auto requests = createRequests();
+    ParallelSignatureVerifier verifier(createPool(),
+                                       std::make_shared<SamTransactionManagerFactoryMock>(),
+                                       std::make_shared<SamRevocationServiceMock>(),
+                                       static_cast<int>(state.range(0)),
+                                       static_cast<int>(state.range(1)),
+                                       std::chrono::milliseconds(1000));
+
+    for (auto _ : state) {
+        CountingListener listener;
+        verifier.verify(requests, listener);
+        if (listener.getResultsNumber() != REQUESTS_NUMBER) {
+            state.SkipWithError("Missing results");
+            break;
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * REQUESTS_NUMBER);
+    state.counters["lookups"] = benchmark::Counter(
+        static_cast<double>(verifier.getRevocationLookupsNumber()),
+        benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_parallelSignatureVerification)
+    ->Args({1, 1})
+    ->Args({1, 32})
+    ->Args({2, 32})
+    ->Args({POOL_SAMS_NUMBER, 32})
+    ->Args({POOL_SAMS_NUMBER, 128})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
@@ -0,0 +1,170 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "benchmark/benchmark.h"
+
+/* Calypsonet Terminal Calypso */
+#include "CalypsoCardSimulator.h"
+#include "CalypsoSamSimulator.h"
+#include "SimulatedCardReader.h"
+
+/* Mocks */
+#include "DirectoryHeaderMock.h"
+#include "FileHeaderMock.h"
+
+using namespace calypsonet::terminal::calypso::sim;
+
+static const uint64_t MASTER_KEY = 0x0123456789ABCDEFULL;
+static const std::vector<uint8_t> SERIAL_NUMBER = {0, 0, 0, 0, 0x12, 0x34, 0x56, 0x78};
+
+/**
+ * Runs the APDUs of a validation the way a transaction manager does, each card exchange done
+ * inside the session being sent to the SAM with Digest Update commands.
+ */
+class ValidationRunner {
+public:
+    ValidationRunner()
+    : mCard(std::make_shared<CalypsoCardSimulator>(
+          std::vector<uint8_t>({0xA0, 0x00, 0x00, 0x04, 0x04, 0x01, 0x25, 0x09, 0x01}),
+          SERIAL_NUMBER,
+          std::make_shared<DirectoryHeaderMock>(),
+          MASTER_KEY)),
+      mSam(std::make_shared<CalypsoSamSimulator>(std::vector<uint8_t>({1, 2, 3, 4}), MASTER_KEY)),
+      mCardReader("card", true),
+      mSamReader("sam", false),
+      mSessionOpen(false)
+    {
+        mCard->addFile(0x07, std::make_shared<FileHeaderMock>(
+                                 0x2001, ElementaryFile::Type::LINEAR, 1, 29))
+              .addFile(0x08, std::make_shared<FileHeaderMock>(
+                                 0x2010, ElementaryFile::Type::CYCLIC, 3, 29))
+              .addFile(0x09, std::make_shared<FileHeaderMock>(
+                                 0x2020, ElementaryFile::Type::LINEAR, 4, 29))
+              .addFile(0x19, std::make_shared<FileHeaderMock>(
+                                 0x2069, ElementaryFile::Type::COUNTERS, 1, 27))
+              .setTransactionCounter(0xFFFFFF);
+        mCard->setRecord(0x19, 1, std::vector<uint8_t>({0xFF, 0xFF, 0xFF}));
+
+        mCardReader.insertCard(mCard);
+        mSamReader.insertCard(mSam);
+
+        mSelectDiversifier = {0x80, 0x14, 0x00, 0x00, 0x08};
+        mSelectDiversifier.insert(mSelectDiversifier.end(), SERIAL_NUMBER.begin(),
+                                  SERIAL_NUMBER.end());
+        mOpenSession = {0x00, 0x8A, 0x0B, 0x39, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+        mDigestInit = {0x80, 0x8A, 0x00, 0xFF, 0x00, 0x30, 0x79};
+        mCloseSession = {0x00, 0x8E, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04};
+        mDigestAuthenticate = {0x80, 0x82, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00};
+        mAppendRecord = {0x00, 0xE2, 0x00, 0x40, 0x1D};
+        mAppendRecord.resize(5 + 29, 0x5A);
+    }
+
+    /* Returns false if the session failed */
+    bool run()
+    {
+        toCard(SELECT_APPLICATION);
+
+        mSamReader.transmitApdu(mSelectDiversifier, mResponse);
+        mSamReader.transmitApdu(GET_CHALLENGE, mResponse);
+        std::copy(mResponse.begin(), mResponse.begin() + 4, mOpenSession.begin() + 6);
+
+        toCard(mOpenSession);
+        mDigestInit.resize(7);
+        mDigestInit.insert(mDigestInit.end(), mResponse.begin(), mResponse.end() - 2);
+        mDigestInit[4] = static_cast<uint8_t>(mDigestInit.size() - 5);
+        mSamReader.transmitApdu(mDigestInit, mResponse);
+        mSessionOpen = true;
+
+        toCard(READ_CONTRACTS);
+        toCard(READ_COUNTER);
+        toCard(DECREASE_COUNTER);
+        toCard(mAppendRecord);
+
+        mSessionOpen = false;
+        mSamReader.transmitApdu(DIGEST_CLOSE, mResponse);
+        std::copy(mResponse.begin(), mResponse.begin() + 4, mCloseSession.begin() + 5);
+        toCard(mCloseSession);
+        if (mResponse.size() != 6) {
+            return false;
+        }
+
+        std::copy(mResponse.begin(), mResponse.begin() + 4, mDigestAuthenticate.begin() + 5);
+        mSamReader.transmitApdu(mDigestAuthenticate, mResponse);
+
+        return mResponse[0] == 0x90;
+    }
+
+private:
+    static const std::vector<uint8_t> SELECT_APPLICATION;
+    static const std::vector<uint8_t> GET_CHALLENGE;
+    static const std::vector<uint8_t> READ_CONTRACTS;
+    static const std::vector<uint8_t> READ_COUNTER;
+    static const std::vector<uint8_t> DECREASE_COUNTER;
+    static const std::vector<uint8_t> DIGEST_CLOSE;
+
+    const std::shared_ptr<CalypsoCardSimulator> mCard;
+    const std::shared_ptr<CalypsoSamSimulator> mSam;
+    SimulatedCardReader mCardReader;
+    SimulatedCardReader mSamReader;
+    bool mSessionOpen;
+    std::vector<uint8_t> mSelectDiversifier;
+    std::vector<uint8_t> mOpenSession;
+    std::vector<uint8_t> mDigestInit;
+    std::vector<uint8_t> mCloseSession;
+    std::vector<uint8_t> mDigestAuthenticate;
+    std::vector<uint8_t> mAppendRecord;
+    std::vector<uint8_t> mResponse;
+    std::vector<uint8_t> mDigestUpdate;
+
+    void toCard(const std::vector<uint8_t>& apdu)
+    {
+        mCardReader.transmitApdu(apdu, mResponse);
+
+        if (mSessionOpen) {
+            digestUpdate(apdu);
+            digestUpdate(mResponse);
+        }
+    }
+
+    void digestUpdate(const std::vector<uint8_t>& data)
+    {
+        mDigestUpdate.assign({0x80, 0x8C, 0x00, 0x00, static_cast<uint8_t>(data.size())});
+        mDigestUpdate.insert(mDigestUpdate.end(), data.begin(), data.end());
+
+        std::vector<uint8_t> response;
+        mSamReader.transmitApdu(mDigestUpdate, response);
+    }
+};
+
+const std::vector<uint8_t> ValidationRunner::SELECT_APPLICATION =
+    {0x00, 0xA4, 0x04, 0x00, 0x09, 0xA0, 0x00, 0x00, 0x04, 0x04, 0x01, 0x25, 0x09, 0x01, 0x00};
+const std::vector<uint8_t> ValidationRunner::GET_CHALLENGE = {0x80, 0x84, 0x00, 0x00, 0x04};
+const std::vector<uint8_t> ValidationRunner::READ_CONTRACTS = {0x00, 0xB2, 0x01, 0x4D, 0x7C};
+const std::vector<uint8_t> ValidationRunner::READ_COUNTER = {0x00, 0xB2, 0x01, 0xCC, 0x00};
+const std::vector<uint8_t> ValidationRunner::DECREASE_COUNTER =
+    {0x00, 0x30, 0x01, 0xC8, 0x03, 0x00, 0x00, 0x01, 0x03};
+const std::vector<uint8_t> ValidationRunner::DIGEST_CLOSE = {0x80, 0x8E, 0x00, 0x00, 0x04};
+
+static void BM_simulatedValidation(benchmark::State& state)
+{
+    ValidationRunner runner;
+
+    for (auto _ : state) {
+        if (!runner.run()) {
+            state.SkipWithError("Session failed");
+            break;
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_simulatedValidation);
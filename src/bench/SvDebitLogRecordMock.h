@@ -0,0 +1,90 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+#include <cstdint>
+#include <vector>
+
+/* Calypsonet Terminal Calypso */
+#include "SvDebitLogRecord.h"
+
+using namespace calypsonet::terminal::calypso;
+using namespace calypsonet::terminal::calypso::card;
+
+/**
+ * SvDebitLogRecord implementation decoding the fields from the raw data at each invocation, like
+ * the reference library does.
+ *
+ * <p>Layout of the 19 bytes record: amount (2), date (2), time (2), KVC (1), SAM ID (4), SAM
+ * transaction number (3), balance (3), SV transaction number (2).
+ */
+class SvDebitLogRecordMock final : public SvDebitLogRecord {
+public:
+    static const int RECORD_SIZE = 19;
+
+    explicit SvDebitLogRecordMock(const std::vector<uint8_t>& rawData) : mRawData(rawData) {}
+
+    const std::vector<uint8_t>& getRawData() const override
+    {
+        return mRawData;
+    }
+
+    const ByteView getRawDataView() const override
+    {
+        return mRawData;
+    }
+
+    int getAmount() const override
+    {
+        return static_cast<int16_t>((mRawData[0] << 8) | mRawData[1]);
+    }
+
+    int getBalance() const override
+    {
+        const int balance = (mRawData[14] << 16) | (mRawData[15] << 8) | mRawData[16];
+
+        return (balance & 0x800000) != 0 ? balance - 0x1000000 : balance;
+    }
+
+    const std::vector<uint8_t> getDebitDate() const override
+    {
+        return std::vector<uint8_t>(mRawData.begin() + 2, mRawData.begin() + 4);
+    }
+
+    const std::vector<uint8_t> getDebitTime() const override
+    {
+        return std::vector<uint8_t>(mRawData.begin() + 4, mRawData.begin() + 6);
+    }
+
+    uint8_t getKvc() const override
+    {
+        return mRawData[6];
+    }
+
+    const std::vector<uint8_t> getSamId() const override
+    {
+        return std::vector<uint8_t>(mRawData.begin() + 7, mRawData.begin() + 11);
+    }
+
+    int getSamTNum() const override
+    {
+        return (mRawData[11] << 16) | (mRawData[12] << 8) | mRawData[13];
+    }
+
+    int getSvTNum() const override
+    {
+        return (mRawData[17] << 8) | mRawData[18];
+    }
+
+private:
+    const std::vector<uint8_t> mRawData;
+};
@@ -0,0 +1,79 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "benchmark/benchmark.h"
+
+/* Mocks */
+#include "CalypsoCardMock.h"
+
+static const int NB_DEBIT_LOGS = 3;
+
+static CalypsoCardMock createCard()
+{
+    CalypsoCardMock card;
+
+    for (int i = 0; i < NB_DEBIT_LOGS; i++) {
+        std::vector<uint8_t> rawData(SvDebitLogRecordMock::RECORD_SIZE);
+        for (std::size_t j = 0; j < rawData.size(); j++) {
+            rawData[j] = static_cast<uint8_t>(i * 19 + j);
+        }
+        card.addSvDebitLogRecord(rawData);
+    }
+
+    return card;
+}
+
+static void BM_getSvDebitLogAllRecordsFields(benchmark::State& state)
+{
+    const CalypsoCardMock card = createCard();
+
+    for (auto _ : state) {
+        int sum = 0;
+        for (const auto& log : card.getSvDebitLogAllRecords()) {
+            sum += log->getAmount() + log->getBalance() + log->getSamTNum() + log->getSvTNum();
+            sum += log->getDebitDate()[0] + log->getDebitTime()[0] + log->getSamId()[0];
+            sum += log->getKvc();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_getSvDebitLogAllRecordsFields);
+
+static void BM_getSvDebitLogAllRecordsRawDataView(benchmark::State& state)
+{
+    const CalypsoCardMock card = createCard();
+
+    for (auto _ : state) {
+        int sum = 0;
+        for (const auto& log : card.getSvDebitLogAllRecords()) {
+            const ByteView raw = log->getRawDataView();
+            sum += static_cast<int16_t>((raw[0] << 8) | raw[1]);
+            sum += (raw[14] << 16) | (raw[15] << 8) | raw[16];
+            sum += (raw[11] << 16) | (raw[12] << 8) | raw[13];
+            sum += (raw[17] << 8) | raw[18];
+            sum += raw[2] + raw[4] + raw[7] + raw[6];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_getSvDebitLogAllRecordsRawDataView);
+
+static void BM_getSvDebitLogLastRecord(benchmark::State& state)
+{
+    CalypsoCardMock card = createCard();
+
+    for (auto _ : state) {
+        const auto log = card.getSvDebitLogLastRecord();
+        benchmark::DoNotOptimize(log->getAmount() + log->getBalance());
+    }
+}
+BENCHMARK(BM_getSvDebitLogLastRecord);
@@ -0,0 +1,134 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+
+#pragma once
+#include <cstdint>
+#include <vector>
+
+/* Calypsonet Terminal Calypso */
+#include "TraceableSignatureVerificationData.h"
+
+/* Keyple Core Util */
+#include "IllegalStateException.h"
+
+using namespace calypsonet::terminal::calypso::transaction;
+using namespace keyple::core::util::cpp::exception;
+
+/**
+ * TraceableSignatureVerificationData implementation carrying the identity of the signing SAM
+ * (serial number and counter) in clear, so that SamTransactionManagerMock can check its
+ * revocation status without decoding the signed data.
+ */
+class TraceableSignatureVerificationDataMock final : public TraceableSignatureVerificationData {
+public:
+    TraceableSignatureVerificationDataMock(const std::vector<uint8_t>& samSerialNumber,
+                                           const int samCounterValue,
+                                           const bool isSignatureCorrect)
+    : mSamSerialNumber(samSerialNumber),
+      mSamCounterValue(samCounterValue),
+      mIsSignatureCorrect(isSignatureCorrect),
+      mCheckSamRevocationStatus(false),
+      mIsProcessed(false),
+      mIsSignatureValid(false) {}
+
+    const std::vector<uint8_t>& getSamSerialNumber() const
+    {
+        return mSamSerialNumber;
+    }
+
+    int getSamCounterValue() const
+    {
+        return mSamCounterValue;
+    }
+
+    bool isSignatureCorrect() const
+    {
+        return mIsSignatureCorrect;
+    }
+
+    bool isSamRevocationStatusChecked() const
+    {
+        return mCheckSamRevocationStatus;
+    }
+
+    void setSignatureValid(const bool isSignatureValid)
+    {
+        mIsSignatureValid = isSignatureValid;
+        mIsProcessed = true;
+    }
+
+    void reset()
+    {
+        mIsProcessed = false;
+    }
+
+    /* CommonSignatureVerificationData */
+
+    TraceableSignatureVerificationData& setData(const std::vector<uint8_t>& data,
+                                                const std::vector<uint8_t>& signature,
+                                                const uint8_t kif,
+                                                const uint8_t kvc) override
+    {
+        (void)data;
+        (void)signature;
+        (void)kif;
+        (void)kvc;
+
+        return *this;
+    }
+
+    TraceableSignatureVerificationData& setKeyDiversifier(
+        const std::vector<uint8_t>& diversifier) override
+    {
+        (void)diversifier;
+
+        return *this;
+    }
+
+    bool isSignatureValid() const override
+    {
+        if (!mIsProcessed) {
+            throw IllegalStateException("The command has not yet been processed");
+        }
+
+        return mIsSignatureValid;
+    }
+
+    /* TraceableSignatureVerificationData */
+
+    TraceableSignatureVerificationData& withSamTraceabilityMode(
+        const int offset,
+        const bool isPartialSamSerialNumber,
+        const bool checkSamRevocationStatus) override
+    {
+        (void)offset;
+        (void)isPartialSamSerialNumber;
+
+        mCheckSamRevocationStatus = checkSamRevocationStatus;
+
+        return *this;
+    }
+
+    TraceableSignatureVerificationData& withoutBusyMode() override
+    {
+        return *this;
+    }
+
+private:
+    const std::vector<uint8_t> mSamSerialNumber;
+    const int mSamCounterValue;
+    const bool mIsSignatureCorrect;
+    bool mCheckSamRevocationStatus;
+    bool mIsProcessed;
+    bool mIsSignatureValid;
+};
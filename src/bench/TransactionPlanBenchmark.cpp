@@ -0,0 +1,65 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "benchmark/benchmark.h"
+
+/* Mocks */
+#include "CalypsoCardMock.h"
+#include "CardTransactionManagerMock.h"
+
+/* The commands of a validation: read environment, contracts and counters, append an event */
+static void prepareValidation(CardTransactionManager& ctm)
+{
+    ctm.prepareReadRecord(0x07, 1)
+       .prepareReadRecords(0x09, 1, 4, 29)
+       .prepareReadCounter(0x19, 9)
+       .prepareDecreaseCounter(0x19, 1, 1)
+       .prepareAppendRecord(0x08, std::vector<uint8_t>(29, 0x5A));
+}
+
+static void BM_prepareCommands(benchmark::State& state)
+{
+    CardTransactionManagerMock ctm(nullptr, std::make_shared<CalypsoCardMock>());
+
+    for (auto _ : state) {
+        prepareValidation(ctm);
+        benchmark::DoNotOptimize(ctm.getPreparedCommands().data());
+        ctm.processCommands();
+    }
+}
+BENCHMARK(BM_prepareCommands);
+
+static void BM_prepareTransactionPlan(benchmark::State& state)
+{
+    CardTransactionManagerMock ctm(nullptr, std::make_shared<CalypsoCardMock>());
+    prepareValidation(ctm);
+    const std::shared_ptr<CardTransactionPlan> plan = ctm.compileTransactionPlan();
+
+    for (auto _ : state) {
+        ctm.prepareTransactionPlan(plan);
+        benchmark::DoNotOptimize(ctm.getPreparedCommands().data());
+        ctm.processCommands();
+    }
+}
+BENCHMARK(BM_prepareTransactionPlan);
+
+static void BM_compileTransactionPlan(benchmark::State& state)
+{
+    CardTransactionManagerMock ctm(nullptr, std::make_shared<CalypsoCardMock>());
+
+    for (auto _ : state) {
+        prepareValidation(ctm);
+        const std::shared_ptr<CardTransactionPlan> plan = ctm.compileTransactionPlan();
+        benchmark::DoNotOptimize(plan->getSessionBufferBudget());
+    }
+}
+BENCHMARK(BM_compileTransactionPlan);
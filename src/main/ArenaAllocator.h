@@ -0,0 +1,115 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+
+/* Calypsonet Terminal Calypso */
+#include "MemoryArenaSpi.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace calypso {
+
+using namespace calypsonet::terminal::calypso::spi;
+
+/**
+ * Standard allocator forwarding to a MemoryArenaSpi.
+ *
+ * <p>Used with std::allocate_shared, it allows an object and its control block to be placed in
+ * a single arena allocation, e.g.:
+ *
+ * <pre>
+ * auto ef = std::allocate_shared<ElementaryFileAdapter>(
+ *     ArenaAllocator<ElementaryFileAdapter>(arena), sfi);
+ * </pre>
+ *
+ * @param <T> The type of the allocated objects.
+ * @since 1.5.0
+ */
+template <typename T>
+class ArenaAllocator {
+public:
+    /**
+     *
+     */
+    typedef T value_type;
+
+    /**
+     *
+     */
+    template <typename U>
+    struct rebind {
+        typedef ArenaAllocator<U> other;
+    };
+
+    /**
+     * @param arena The arena providing the memory (must outlive the allocator and the allocated
+     *        objects).
+     * @since 1.5.0
+     */
+    explicit ArenaAllocator(MemoryArenaSpi& arena) : mArena(&arena) {}
+
+    /**
+     *
+     */
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) : mArena(other.getArena()) {}
+
+    /**
+     * @since 1.5.0
+     */
+    T* allocate(const std::size_t n)
+    {
+        return static_cast<T*>(mArena->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    /**
+     * @since 1.5.0
+     */
+    void deallocate(T* p, const std::size_t n)
+    {
+        mArena->deallocate(p, n * sizeof(T));
+    }
+
+    /**
+     * @return The arena providing the memory.
+     * @since 1.5.0
+     */
+    MemoryArenaSpi* getArena() const
+    {
+        return mArena;
+    }
+
+private:
+    /**
+     *
+     */
+    MemoryArenaSpi* mArena;
+};
+
+template <typename T, typename U>
+inline bool operator==(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b)
+{
+    return a.getArena() == b.getArena();
+}
+
+template <typename T, typename U>
+inline bool operator!=(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b)
+{
+    return !(a == b);
+}
+
+}
+}
+}
@@ -0,0 +1,184 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+/* Keyple Core Util */
+#include "IndexOutOfBoundsException.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace calypso {
+
+using namespace keyple::core::util::cpp::exception;
+
+/**
+ * Non-owning read-only view of a contiguous sequence of bytes.
+ *
+ * <p>A ByteView does not copy nor allocate anything: it only references bytes owned by another
+ * object (typically the CalypsoCard image). It therefore remains valid only as long as the owner
+ * is alive and the referenced data is not modified.
+ *
+ * @since 1.5.0
+ */
+class ByteView final {
+public:
+    /**
+     * Constructs an empty view.
+     *
+     * @since 1.5.0
+     */
+    ByteView() : mData(nullptr), mSize(0) {}
+
+    /**
+     * Constructs a view on the provided memory area.
+     *
+     * @param data A pointer to the first byte (may be null if size is 0).
+     * @param size The number of bytes.
+     * @since 1.5.0
+     */
+    ByteView(const uint8_t* data, const std::size_t size) : mData(data), mSize(size) {}
+
+    /**
+     * Constructs a view on the whole content of the provided vector.
+     *
+     * @param data The referenced vector.
+     * @since 1.5.0
+     */
+    ByteView(const std::vector<uint8_t>& data) : mData(data.data()), mSize(data.size()) {}
+
+    /**
+     * Gets a pointer to the first byte.
+     *
+     * @return Null if the view is empty.
+     * @since 1.5.0
+     */
+    const uint8_t* data() const
+    {
+        return mSize == 0 ? nullptr : mData;
+    }
+
+    /**
+     * Gets the number of bytes.
+     *
+     * @return A positive or zero value.
+     * @since 1.5.0
+     */
+    std::size_t size() const
+    {
+        return mSize;
+    }
+
+    /**
+     * Indicates if the view is empty.
+     *
+     * @return True if the view doesn't reference any byte.
+     * @since 1.5.0
+     */
+    bool empty() const
+    {
+        return mSize == 0;
+    }
+
+    /**
+     * @return An iterator on the first byte.
+     * @since 1.5.0
+     */
+    const uint8_t* begin() const
+    {
+        return mData;
+    }
+
+    /**
+     * @return An iterator past the last byte.
+     * @since 1.5.0
+     */
+    const uint8_t* end() const
+    {
+        return mData + mSize;
+    }
+
+    /**
+     * Gets the byte at the provided index (unchecked).
+     *
+     * @param index The index (should be {@code <} size()).
+     * @return The byte value.
+     * @since 1.5.0
+     */
+    uint8_t operator[](const std::size_t index) const
+    {
+        return mData[index];
+    }
+
+    /**
+     * Gets a view on a subset of the referenced bytes.
+     *
+     * @param offset The offset of the first byte.
+     * @param length The number of bytes.
+     * @return A not empty view if length {@code >} 0.
+     * @throw IndexOutOfBoundsException If (offset + length) {@code >} size().
+     * @since 1.5.0
+     */
+    ByteView subView(const std::size_t offset, const std::size_t length) const
+    {
+        if (offset > mSize || length > mSize - offset) {
+            throw IndexOutOfBoundsException("The requested range is out of the view bounds.");
+        }
+
+        return ByteView(mData + offset, length);
+    }
+
+    /**
+     * Gets a copy of the referenced bytes.
+     *
+     * @return A new byte array.
+     * @since 1.5.0
+     */
+    std::vector<uint8_t> toVector() const
+    {
+        return std::vector<uint8_t>(begin(), end());
+    }
+
+    /**
+     *
+     */
+    friend std::ostream& operator<<(std::ostream& os, const ByteView& view)
+    {
+        static const char hex[] = "0123456789ABCDEF";
+
+        for (const uint8_t b : view) {
+            os << hex[b >> 4] << hex[b & 0x0F];
+        }
+
+        return os;
+    }
+
+private:
+    /**
+     *
+     */
+    const uint8_t* mData;
+
+    /**
+     *
+     */
+    std::size_t mSize;
+};
+
+}
+}
+}
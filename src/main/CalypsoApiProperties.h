@@ -39,7 +39,7 @@ private:
     CalypsoApiProperties() {}
 };
 
-const std::string CalypsoApiProperties::VERSION = "1.4";
+const std::string CalypsoApiProperties::VERSION = "1.5";
 
 }
 }
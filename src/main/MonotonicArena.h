@@ -0,0 +1,160 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <vector>
+
+/* Calypsonet Terminal Calypso */
+#include "MemoryArenaSpi.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace calypso {
+
+using namespace calypsonet::terminal::calypso::spi;
+
+/**
+ * MemoryArenaSpi implementation allocating by simply moving a pointer forward in large memory
+ * blocks, and releasing everything at once with reset().
+ *
+ * <p>The blocks are kept across reset() invocations: once the arena has reached the size needed
+ * by a transaction, the following transactions do not allocate anything from the heap.
+ *
+ * <p>This class is not thread safe.
+ *
+ * @since 1.5.0
+ */
+class MonotonicArena final : public MemoryArenaSpi {
+public:
+    /**
+     * Constructs an arena.
+     *
+     * @param blockSize The size of the first memory block (the following ones are larger if
+     *        needed).
+     * @since 1.5.0
+     */
+    explicit MonotonicArena(const std::size_t blockSize = 4096)
+    : mBlockSize(std::max<std::size_t>(blockSize, 64)), mCurrentBlock(0), mOffset(0) {}
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    void* allocate(const std::size_t size, const std::size_t alignment) override
+    {
+        while (mCurrentBlock < mBlocks.size()) {
+            Block& block = mBlocks[mCurrentBlock];
+            const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(block.data.get());
+            const std::size_t start = ((base + mOffset + alignment - 1) & ~(alignment - 1)) - base;
+
+            if (start + size <= block.size) {
+                mOffset = start + size;
+                return block.data.get() + start;
+            }
+
+            mCurrentBlock++;
+            mOffset = 0;
+        }
+
+        const std::size_t needed = size + alignment;
+        const std::size_t blockSize = std::max(needed, mBlocks.empty() ? mBlockSize
+                                                                       : 2 * mBlocks.back().size);
+        mBlocks.push_back(Block(blockSize));
+        mCurrentBlock = mBlocks.size() - 1;
+        mOffset = 0;
+
+        return allocate(size, alignment);
+    }
+
+    /**
+     * Does nothing: the memory is released by reset().
+     *
+     * @since 1.5.0
+     */
+    void deallocate(void* block, const std::size_t size) override
+    {
+        (void)block;
+        (void)size;
+    }
+
+    /**
+     * Makes all the memory of the arena available again, without returning it to the heap.
+     *
+     * <p>All the objects allocated in the arena must have been destroyed before.
+     *
+     * @since 1.5.0
+     */
+    void reset()
+    {
+        mCurrentBlock = 0;
+        mOffset = 0;
+    }
+
+    /**
+     * Gets the total size of the memory blocks owned by the arena.
+     *
+     * @return A positive or zero value.
+     * @since 1.5.0
+     */
+    std::size_t getCapacity() const
+    {
+        std::size_t capacity = 0;
+
+        for (const auto& block : mBlocks) {
+            capacity += block.size;
+        }
+
+        return capacity;
+    }
+
+private:
+    /**
+     *
+     */
+    struct Block {
+        explicit Block(const std::size_t size) : data(new uint8_t[size]), size(size) {}
+
+        std::unique_ptr<uint8_t[]> data;
+        std::size_t size;
+    };
+
+    /**
+     *
+     */
+    const std::size_t mBlockSize;
+
+    /**
+     *
+     */
+    std::vector<Block> mBlocks;
+
+    /**
+     *
+     */
+    std::size_t mCurrentBlock;
+
+    /**
+     *
+     */
+    std::size_t mOffset;
+};
+
+}
+}
+}
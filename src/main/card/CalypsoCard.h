@@ -23,6 +23,7 @@
 #include "SmartCard.h"
 
 /* Calypsonet Terminal Calypso */
+#include "ByteView.h"
 #include "DirectoryHeader.h"
 #include "ElementaryFile.h"
 #include "SvDebitLogRecord.h"
@@ -167,6 +168,28 @@ public:
      */
     virtual const std::vector<uint8_t> getApplicationSerialNumber() const = 0;
 
+    /**
+     * Gets a view on the DF name, without copy.
+     *
+     * <p>The view is only valid as long as this CalypsoCard is alive.
+     *
+     * @return A not empty view on the DF Name bytes (5 to 16 bytes).
+     * @see getDfName()
+     * @since 1.5.0
+     */
+    virtual const ByteView getDfNameView() const = 0;
+
+    /**
+     * Gets a view on the Calypso application serial number, without copy.
+     *
+     * <p>The view is only valid as long as this CalypsoCard is alive.
+     *
+     * @return A not empty view on the Application Serial Number (8 bytes).
+     * @see getApplicationSerialNumber()
+     * @since 1.5.0
+     */
+    virtual const ByteView getApplicationSerialNumberView() const = 0;
+
     /**
      * Gets the raw Calypso startup information.
      *
@@ -286,6 +309,8 @@ public:
      * <p>Note that if a secure session is actually running, then the map contains all session
      * modifications, which can be canceled if the secure session fails.
      *
+     * <p>Note that a new map is built at each invocation.
+     *
      * @return A not null reference (it may be empty if no one EF is set).
      * @since 1.0.0
      * @deprecated Since an EF may not have an SFI, the getFiles() method must be used instead.
@@ -299,6 +324,9 @@ public:
      * <p>Note that if a secure session is actually running, then the set contains all session
      * modifications, which can be canceled if the secure session fails.
      *
+     * <p>The returned reference gives access to the files without any allocation; it is the
+     * recommended way to iterate over all the files of the card image.
+     *
      * @return A not null reference (it may be empty if no one EF is set).
      * @since 1.1.0
      */
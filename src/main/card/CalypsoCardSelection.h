@@ -23,6 +23,7 @@
 /* Calypsonet Terminal Calypso */
 #include "CalypsoCardSelection.h"
 #include "GetDataTag.h"
+#include "MemoryArenaSpi.h"
 #include "SelectFileControl.h"
 
 namespace calypsonet {
@@ -31,6 +32,7 @@ namespace calypso {
 namespace card {
 
 using namespace calypsonet::terminal::calypso;
+using namespace calypsonet::terminal::calypso::spi;
 using namespace calypsonet::terminal::reader::selection::spi;
 
 /**
@@ -223,6 +225,22 @@ public:
      */
     virtual CalypsoCardSelection& acceptInvalidatedCard() = 0;
 
+    /**
+     * Sets the arena in which the CalypsoCard image resulting from the selection and all its
+     * sub-objects (files, headers, log records, ...) are allocated.
+     *
+     * <p>By default, the objects are allocated from the heap.
+     *
+     * <p>The arena must outlive the card image. It is the responsibility of the application to
+     * release the arena's memory only once all the objects of the transaction have been released.
+     *
+     * @param arena The arena to use, or null to use the heap.
+     * @return The object instance.
+     * @see CardTransactionManager::setMemoryArena(const std::shared_ptr<MemoryArenaSpi>)
+     * @since 1.5.0
+     */
+    virtual CalypsoCardSelection& setMemoryArena(const std::shared_ptr<MemoryArenaSpi> arena) = 0;
+
     /**
      * Adds a command APDU to select file with an LID provided as a 2-byte byte array.
      *
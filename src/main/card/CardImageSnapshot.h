@@ -0,0 +1,390 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/* Calypsonet Terminal Calypso */
+#include "ByteView.h"
+
+/* Keyple Core Util */
+#include "IllegalArgumentException.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace calypso {
+namespace card {
+
+using namespace calypsonet::terminal::calypso;
+using namespace keyple::core::util::cpp::exception;
+
+/**
+ * Read-only access to a binary snapshot of a card image, as produced by CardImageSnapshotWriter.
+ *
+ * <p>The snapshot is a single flat buffer which can be stored as is and later used in place, for
+ * example from a memory-mapped file. All the multi-byte values are little-endian and are read byte
+ * per byte, so that the buffer has no alignment requirement:
+ *
+ * <ul>
+ *   <li>Header (HEADER_SIZE bytes): magic "CCIS", format version, product type, flags, startup
+ *       information, transaction counter, PIN and SV state, directory header, counts and total
+ *       size (see the Header offsets).
+ *   <li>Blob table: BLOBS_NUMBER slices (offset and length, 4 bytes each) of the variable-length
+ *       data (see Blob).
+ *   <li>File table: one FILE_ENTRY_SIZE bytes descriptor per Elementary File (see the FileEntry
+ *       offsets), whose records are stored like in a RecordStore: a table of the lengths (2 bytes
+ *       each), a table of the known offsets (2 bytes each, see RecordStore::getKnownOffset())
+ *       and a buffer of fixed-size slots.
+ *   <li>Data area.
+ * </ul>
+ *
+ * <p>The constructor only checks that the header and all the slices lie within the buffer; the
+ * content is never parsed. The instance does not own the buffer, which must remain valid and
+ * unchanged as long as the instance (or any object built from it) is used.
+ *
+ * @since 1.5.0
+ */
+class CardImageSnapshot final {
+public:
+    /**
+     * Version of the format.
+     *
+     * @since 1.5.0
+     */
+    static const uint8_t FORMAT_VERSION = 2;
+
+    /**
+     * Magic number ("CCIS").
+     *
+     * @since 1.5.0
+     */
+    static const uint32_t MAGIC = 0x53494343;
+
+    /**
+     * Offsets of the header fields.
+     *
+     * @since 1.5.0
+     */
+    enum Header {
+        MAGIC_OFFSET = 0,
+        VERSION_OFFSET = 4,
+        PRODUCT_TYPE_OFFSET = 5,
+        FLAGS_OFFSET = 6,
+        PLATFORM_OFFSET = 8,
+        APPLICATION_TYPE_OFFSET = 9,
+        APPLICATION_SUBTYPE_OFFSET = 10,
+        SOFTWARE_ISSUER_OFFSET = 11,
+        SOFTWARE_VERSION_OFFSET = 12,
+        SOFTWARE_REVISION_OFFSET = 13,
+        SESSION_MODIFICATION_OFFSET = 14,
+        DF_STATUS_OFFSET = 15,
+        TRANSACTION_COUNTER_OFFSET = 16,
+        PIN_ATTEMPT_REMAINING_OFFSET = 20,
+        SV_BALANCE_OFFSET = 24,
+        SV_LAST_TNUM_OFFSET = 28,
+        DF_LID_OFFSET = 32,
+        DF_KIF_OFFSET = 34,
+        DF_KVC_OFFSET = 37,
+        FILES_NUMBER_OFFSET = 40,
+        SV_DEBIT_LOGS_NUMBER_OFFSET = 42,
+        IMAGE_SIZE_OFFSET = 44,
+        HEADER_SIZE = 48
+    };
+
+    /**
+     * Flags of the header.
+     *
+     * @since 1.5.0
+     */
+    enum Flag {
+        HCE = 0x0001,
+        DF_INVALIDATED = 0x0002,
+        DF_RATIFIED = 0x0004,
+        PKI_MODE_SUPPORTED = 0x0008,
+        EXTENDED_MODE_SUPPORTED = 0x0010,
+        RATIFICATION_ON_DESELECT_SUPPORTED = 0x0020,
+        PIN_FEATURE_AVAILABLE = 0x0040,
+        PIN_STATUS_KNOWN = 0x0080,
+        PIN_BLOCKED = 0x0100,
+        SV_FEATURE_AVAILABLE = 0x0200,
+        SV_STATUS_KNOWN = 0x0400,
+        DIRECTORY_HEADER_PRESENT = 0x0800,
+        TRANSACTION_COUNTER_KNOWN = 0x1000
+    };
+
+    /**
+     * Variable-length data of the blob table.
+     *
+     * @since 1.5.0
+     */
+    enum Blob {
+        POWER_ON_DATA,
+        SELECT_APPLICATION_RESPONSE,
+        DF_NAME,
+        APPLICATION_SERIAL_NUMBER,
+        STARTUP_INFO,
+        TRACEABILITY_INFORMATION,
+        DF_ACCESS_CONDITIONS,
+        DF_KEY_INDEXES,
+        SV_LOAD_LOG,
+        SV_DEBIT_LOGS,
+        BLOBS_NUMBER
+    };
+
+    /**
+     * Offsets of the fields of a file descriptor.
+     *
+     * @since 1.5.0
+     */
+    enum FileEntry {
+        SFI_OFFSET = 0,
+        FILE_FLAGS_OFFSET = 1,
+        LID_OFFSET = 2,
+        EF_TYPE_OFFSET = 4,
+        FILE_DF_STATUS_OFFSET = 5,
+        SHARED_REFERENCE_OFFSET = 6,
+        RECORDS_NUMBER_OFFSET = 8,
+        RECORD_SIZE_OFFSET = 10,
+        ACCESS_CONDITIONS_OFFSET = 12,
+        KEY_INDEXES_OFFSET = 20,
+        STORED_RECORDS_NUMBER_OFFSET = 28,
+        SLOT_SIZE_OFFSET = 30,
+        LENGTHS_OFFSET = 32,
+        SLOTS_OFFSET = 36,
+        KNOWN_OFFSETS_OFFSET = 40,
+        FILE_ENTRY_SIZE = 44
+    };
+
+    /**
+     * Flags of a file descriptor.
+     *
+     * @since 1.5.0
+     */
+    enum FileFlag {
+        HEADER_PRESENT = 0x01,
+        FILE_DF_STATUS_PRESENT = 0x02,
+        SHARED_REFERENCE_PRESENT = 0x04
+    };
+
+    /**
+     * Size of a slice of the blob table or of a file descriptor (offset and length).
+     *
+     * @since 1.5.0
+     */
+    static const std::size_t SLICE_SIZE = 8;
+
+    /**
+     * Creates an empty snapshot, on which isValid() returns false.
+     *
+     * @since 1.5.0
+     */
+    CardImageSnapshot() {}
+
+    /**
+     * Opens a snapshot.
+     *
+     * @param image The snapshot buffer.
+     * @throw IllegalArgumentException If the buffer is not a valid snapshot of a supported version.
+     * @since 1.5.0
+     */
+    explicit CardImageSnapshot(const ByteView& image) : mImage(image)
+    {
+        if (image.size() < HEADER_SIZE + BLOBS_NUMBER * SLICE_SIZE ||
+            getUint32(MAGIC_OFFSET) != MAGIC ||
+            getUint8(VERSION_OFFSET) != FORMAT_VERSION ||
+            getUint32(IMAGE_SIZE_OFFSET) != image.size()) {
+            throw IllegalArgumentException("Invalid card image snapshot header.");
+        }
+
+        for (int blob = 0; blob < BLOBS_NUMBER; blob++) {
+            checkSlice(HEADER_SIZE + blob * SLICE_SIZE);
+        }
+
+        const std::size_t filesOffset = getFilesOffset();
+        if (filesOffset + getFilesNumber() * FILE_ENTRY_SIZE > image.size()) {
+            throw IllegalArgumentException("Invalid card image snapshot file table.");
+        }
+
+        for (int i = 0; i < getFilesNumber(); i++) {
+            const std::size_t entry = getFileEntryOffset(i);
+            checkSlice(entry + ACCESS_CONDITIONS_OFFSET);
+            checkSlice(entry + KEY_INDEXES_OFFSET);
+
+            const std::size_t recordsNumber = getUint16(entry + STORED_RECORDS_NUMBER_OFFSET);
+            const std::size_t lengths = getUint32(entry + LENGTHS_OFFSET);
+            const std::size_t slots = getUint32(entry + SLOTS_OFFSET);
+            const std::size_t knownOffsets = getUint32(entry + KNOWN_OFFSETS_OFFSET);
+            if (lengths > image.size() || (image.size() - lengths) / 2 < recordsNumber ||
+                knownOffsets > image.size() ||
+                (image.size() - knownOffsets) / 2 < recordsNumber ||
+                slots > image.size() ||
+                image.size() - slots < recordsNumber * getUint16(entry + SLOT_SIZE_OFFSET)) {
+                throw IllegalArgumentException("Invalid card image snapshot records.");
+            }
+        }
+    }
+
+    /**
+     * Tells if the snapshot has been opened on a valid buffer.
+     *
+     * @return False for a default-constructed instance.
+     * @since 1.5.0
+     */
+    bool isValid() const
+    {
+        return !mImage.empty();
+    }
+
+    /**
+     * Gets the snapshot buffer.
+     *
+     * @return A not empty view for a valid snapshot.
+     * @since 1.5.0
+     */
+    const ByteView& getImage() const
+    {
+        return mImage;
+    }
+
+    /**
+     * Reads a byte of the buffer.
+     *
+     * @param offset The offset of the byte, within the buffer.
+     * @return The value.
+     * @since 1.5.0
+     */
+    uint8_t getUint8(const std::size_t offset) const
+    {
+        return mImage[offset];
+    }
+
+    /**
+     * Reads a little-endian 2-byte value of the buffer.
+     *
+     * @param offset The offset of the value, within the buffer.
+     * @return The value.
+     * @since 1.5.0
+     */
+    uint16_t getUint16(const std::size_t offset) const
+    {
+        return static_cast<uint16_t>(mImage[offset] | mImage[offset + 1] << 8);
+    }
+
+    /**
+     * Reads a little-endian 4-byte value of the buffer.
+     *
+     * @param offset The offset of the value, within the buffer.
+     * @return The value.
+     * @since 1.5.0
+     */
+    uint32_t getUint32(const std::size_t offset) const
+    {
+        return static_cast<uint32_t>(mImage[offset]) |
+               static_cast<uint32_t>(mImage[offset + 1]) << 8 |
+               static_cast<uint32_t>(mImage[offset + 2]) << 16 |
+               static_cast<uint32_t>(mImage[offset + 3]) << 24;
+    }
+
+    /**
+     * Tells if a flag of the header is set.
+     *
+     * @param flag The flag.
+     * @return True if the flag is set.
+     * @since 1.5.0
+     */
+    bool hasFlag(const Flag flag) const
+    {
+        return (getUint16(FLAGS_OFFSET) & flag) != 0;
+    }
+
+    /**
+     * Gets a blob.
+     *
+     * @param blob The blob.
+     * @return An empty view if the data was not available when the snapshot was written.
+     * @since 1.5.0
+     */
+    ByteView getBlob(const Blob blob) const
+    {
+        return getSlice(HEADER_SIZE + blob * SLICE_SIZE);
+    }
+
+    /**
+     * Gets the number of Elementary Files.
+     *
+     * @return A positive or zero value.
+     * @since 1.5.0
+     */
+    int getFilesNumber() const
+    {
+        return getUint16(FILES_NUMBER_OFFSET);
+    }
+
+    /**
+     * Gets the offset of the descriptor of a file.
+     *
+     * @param index The index of the file, in the order of CalypsoCard::getFiles().
+     * @return The offset of the descriptor within the buffer.
+     * @since 1.5.0
+     */
+    std::size_t getFileEntryOffset(const int index) const
+    {
+        return getFilesOffset() + index * FILE_ENTRY_SIZE;
+    }
+
+    /**
+     * Gets the slice whose offset and length are stored at the provided offset.
+     *
+     * @param offset The offset of the slice descriptor within the buffer.
+     * @return A view within the buffer.
+     * @since 1.5.0
+     */
+    ByteView getSlice(const std::size_t offset) const
+    {
+        return ByteView(mImage.data() + getUint32(offset), getUint32(offset + 4));
+    }
+
+private:
+    /**
+     *
+     */
+    std::size_t getFilesOffset() const
+    {
+        return HEADER_SIZE + BLOBS_NUMBER * SLICE_SIZE;
+    }
+
+    /**
+     *
+     */
+    void checkSlice(const std::size_t offset) const
+    {
+        const uint32_t sliceOffset = getUint32(offset);
+        const uint32_t sliceLength = getUint32(offset + 4);
+
+        if (sliceOffset > mImage.size() || mImage.size() - sliceOffset < sliceLength) {
+            throw IllegalArgumentException("Invalid card image snapshot slice.");
+        }
+    }
+
+    /**
+     *
+     */
+    ByteView mImage;
+};
+
+}
+}
+}
+}
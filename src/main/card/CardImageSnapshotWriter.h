@@ -0,0 +1,386 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/* Calypsonet Terminal Calypso */
+#include "ByteView.h"
+#include "CalypsoCard.h"
+#include "CardImageSnapshot.h"
+#include "DirectoryHeader.h"
+#include "ElementaryFile.h"
+#include "FileHeader.h"
+#include "RecordStore.h"
+#include "SvDebitLogRecord.h"
+#include "SvLoadLogRecord.h"
+#include "WriteAccessLevel.h"
+
+/* Keyple Core Util */
+#include "IllegalArgumentException.h"
+#include "IllegalStateException.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace calypso {
+namespace card {
+
+using namespace calypsonet::terminal::calypso;
+using namespace keyple::core::util::cpp::exception;
+
+/**
+ * Writes the binary snapshot of a card image (see CardImageSnapshot for the format).
+ *
+ * <p>The snapshot captures the selection data (power-on data, FCI, startup information), the
+ * directory header, every Elementary File with its header and records, the PIN status and the SV
+ * state and logs. The values which are not available in the card image (e.g. the SV balance when
+ * no SV command has been processed) are flagged as such and reported the same way by
+ * SnapshotCalypsoCard.
+ *
+ * <p>The output buffer is provided by the caller and may be reused from one card to another, in
+ * which case no allocation is done once it has reached the size of the largest snapshot.
+ *
+ * @since 1.5.0
+ */
+class CardImageSnapshotWriter final {
+public:
+    /**
+     * Writes the snapshot of a card image.
+     *
+     * @param calypsoCard The card image.
+     * @param output The buffer receiving the snapshot, which is overwritten.
+     * @throw IllegalArgumentException If the card is null or if the card image exceeds the limits
+     *        of the format (65535 files, 65535 records of 65535 bytes per file, 4 GB).
+     * @since 1.5.0
+     */
+    static void write(const std::shared_ptr<CalypsoCard>& calypsoCard, std::vector<uint8_t>& output)
+    {
+        if (calypsoCard == nullptr) {
+            throw IllegalArgumentException("The card image must not be null.");
+        }
+
+        CalypsoCard& card = *calypsoCard;
+        const std::vector<std::shared_ptr<ElementaryFile>>& files = card.getFiles();
+        checkLimit(files.size());
+
+        output.assign(CardImageSnapshot::HEADER_SIZE +
+                      CardImageSnapshot::BLOBS_NUMBER * CardImageSnapshot::SLICE_SIZE +
+                      files.size() * CardImageSnapshot::FILE_ENTRY_SIZE,
+                      0);
+
+        putUint32(output, CardImageSnapshot::MAGIC_OFFSET, CardImageSnapshot::MAGIC);
+        output[CardImageSnapshot::VERSION_OFFSET] = CardImageSnapshot::FORMAT_VERSION;
+        output[CardImageSnapshot::PRODUCT_TYPE_OFFSET] =
+            static_cast<uint8_t>(card.getProductType());
+        output[CardImageSnapshot::PLATFORM_OFFSET] = card.getPlatform();
+        output[CardImageSnapshot::APPLICATION_TYPE_OFFSET] = card.getApplicationType();
+        output[CardImageSnapshot::APPLICATION_SUBTYPE_OFFSET] = card.getApplicationSubtype();
+        output[CardImageSnapshot::SOFTWARE_ISSUER_OFFSET] = card.getSoftwareIssuer();
+        output[CardImageSnapshot::SOFTWARE_VERSION_OFFSET] = card.getSoftwareVersion();
+        output[CardImageSnapshot::SOFTWARE_REVISION_OFFSET] = card.getSoftwareRevision();
+        output[CardImageSnapshot::SESSION_MODIFICATION_OFFSET] = card.getSessionModification();
+        putUint16(output, CardImageSnapshot::FILES_NUMBER_OFFSET, files.size());
+
+        uint16_t flags = 0;
+        setFlag(flags, CardImageSnapshot::HCE, card.isHce());
+        setFlag(flags, CardImageSnapshot::DF_INVALIDATED, card.isDfInvalidated());
+        setFlag(flags, CardImageSnapshot::DF_RATIFIED, card.isDfRatified());
+        setFlag(flags, CardImageSnapshot::PKI_MODE_SUPPORTED, card.isPkiModeSupported());
+        setFlag(flags, CardImageSnapshot::EXTENDED_MODE_SUPPORTED, card.isExtendedModeSupported());
+        setFlag(flags,
+                CardImageSnapshot::RATIFICATION_ON_DESELECT_SUPPORTED,
+                card.isRatificationOnDeselectSupported());
+        setFlag(flags, CardImageSnapshot::PIN_FEATURE_AVAILABLE, card.isPinFeatureAvailable());
+        setFlag(flags, CardImageSnapshot::SV_FEATURE_AVAILABLE, card.isSvFeatureAvailable());
+
+        /*
+         * The transaction counter, PIN and SV getters throw when the value has not been read
+         * from the card
+         */
+        try {
+            putUint32(output,
+                      CardImageSnapshot::TRANSACTION_COUNTER_OFFSET,
+                      static_cast<uint32_t>(card.getTransactionCounter()));
+            setFlag(flags, CardImageSnapshot::TRANSACTION_COUNTER_KNOWN, true);
+        } catch (const IllegalStateException&) {
+            /* No session opened */
+        }
+
+        try {
+            setFlag(flags, CardImageSnapshot::PIN_BLOCKED, card.isPinBlocked());
+            putUint32(output,
+                      CardImageSnapshot::PIN_ATTEMPT_REMAINING_OFFSET,
+                      static_cast<uint32_t>(card.getPinAttemptRemaining()));
+            setFlag(flags, CardImageSnapshot::PIN_STATUS_KNOWN, true);
+        } catch (const IllegalStateException&) {
+            /* PIN status not available */
+        }
+
+        try {
+            putUint32(output,
+                      CardImageSnapshot::SV_BALANCE_OFFSET,
+                      static_cast<uint32_t>(card.getSvBalance()));
+            putUint32(output,
+                      CardImageSnapshot::SV_LAST_TNUM_OFFSET,
+                      static_cast<uint32_t>(card.getSvLastTNum()));
+            setFlag(flags, CardImageSnapshot::SV_STATUS_KNOWN, true);
+        } catch (const IllegalStateException&) {
+            /* SV status not available */
+        }
+
+        putBlob(output, CardImageSnapshot::POWER_ON_DATA, ByteView(
+            reinterpret_cast<const uint8_t*>(card.getPowerOnData().data()),
+            card.getPowerOnData().size()));
+        putBlob(output,
+                CardImageSnapshot::SELECT_APPLICATION_RESPONSE,
+                card.getSelectApplicationResponse());
+        putBlob(output, CardImageSnapshot::DF_NAME, card.getDfNameView());
+        putBlob(output,
+                CardImageSnapshot::APPLICATION_SERIAL_NUMBER,
+                card.getApplicationSerialNumberView());
+        putBlob(output, CardImageSnapshot::STARTUP_INFO, card.getStartupInfoRawData());
+        putBlob(output,
+                CardImageSnapshot::TRACEABILITY_INFORMATION,
+                card.getTraceabilityInformation());
+
+        const std::shared_ptr<DirectoryHeader> directoryHeader = card.getDirectoryHeader();
+        if (directoryHeader != nullptr) {
+            setFlag(flags, CardImageSnapshot::DIRECTORY_HEADER_PRESENT, true);
+            putUint16(output, CardImageSnapshot::DF_LID_OFFSET, directoryHeader->getLid());
+            output[CardImageSnapshot::DF_STATUS_OFFSET] = directoryHeader->getDfStatus();
+            for (int level = 0; level < 3; level++) {
+                const WriteAccessLevel writeAccessLevel = static_cast<WriteAccessLevel>(level);
+                output[CardImageSnapshot::DF_KIF_OFFSET + level] =
+                    directoryHeader->getKif(writeAccessLevel);
+                output[CardImageSnapshot::DF_KVC_OFFSET + level] =
+                    directoryHeader->getKvc(writeAccessLevel);
+            }
+            putBlob(output,
+                    CardImageSnapshot::DF_ACCESS_CONDITIONS,
+                    directoryHeader->getAccessConditions());
+            putBlob(output, CardImageSnapshot::DF_KEY_INDEXES, directoryHeader->getKeyIndexes());
+        }
+
+        putUint16(output, CardImageSnapshot::FLAGS_OFFSET, flags);
+
+        const std::shared_ptr<SvLoadLogRecord> svLoadLog = card.getSvLoadLogRecord();
+        if (svLoadLog != nullptr) {
+            putBlob(output, CardImageSnapshot::SV_LOAD_LOG, svLoadLog->getRawDataView());
+        }
+
+        putSvDebitLogs(output, card.getSvDebitLogAllRecords());
+
+        for (std::size_t i = 0; i < files.size(); i++) {
+            putFile(output,
+                    CardImageSnapshot::HEADER_SIZE +
+                        CardImageSnapshot::BLOBS_NUMBER * CardImageSnapshot::SLICE_SIZE +
+                        i * CardImageSnapshot::FILE_ENTRY_SIZE,
+                    *files[i]);
+        }
+
+        checkLimit(output.size() >> 16);
+        putUint32(output,
+                  CardImageSnapshot::IMAGE_SIZE_OFFSET,
+                  static_cast<uint32_t>(output.size()));
+    }
+
+private:
+    /**
+     * Checks that a value fits in 2 bytes.
+     */
+    static void checkLimit(const std::size_t value)
+    {
+        if (value > 0xFFFF) {
+            throw IllegalArgumentException("The card image exceeds the limits of the snapshot.");
+        }
+    }
+
+    /**
+     *
+     */
+    static void setFlag(uint16_t& flags, const int flag, const bool value)
+    {
+        if (value) {
+            flags = static_cast<uint16_t>(flags | flag);
+        }
+    }
+
+    /**
+     *
+     */
+    static void putUint16(std::vector<uint8_t>& output,
+                          const std::size_t offset,
+                          const std::size_t value)
+    {
+        output[offset] = static_cast<uint8_t>(value);
+        output[offset + 1] = static_cast<uint8_t>(value >> 8);
+    }
+
+    /**
+     *
+     */
+    static void putUint32(std::vector<uint8_t>& output,
+                          const std::size_t offset,
+                          const uint32_t value)
+    {
+        output[offset] = static_cast<uint8_t>(value);
+        output[offset + 1] = static_cast<uint8_t>(value >> 8);
+        output[offset + 2] = static_cast<uint8_t>(value >> 16);
+        output[offset + 3] = static_cast<uint8_t>(value >> 24);
+    }
+
+    /**
+     * Appends data to the data area and stores its slice at the provided offset.
+     */
+    static void putSlice(std::vector<uint8_t>& output,
+                         const std::size_t offset,
+                         const ByteView& data)
+    {
+        putUint32(output, offset, static_cast<uint32_t>(output.size()));
+        putUint32(output, offset + 4, static_cast<uint32_t>(data.size()));
+        output.insert(output.end(), data.begin(), data.end());
+    }
+
+    /**
+     *
+     */
+    static void putBlob(std::vector<uint8_t>& output,
+                        const CardImageSnapshot::Blob blob,
+                        const ByteView& data)
+    {
+        putSlice(output,
+                 CardImageSnapshot::HEADER_SIZE + blob * CardImageSnapshot::SLICE_SIZE,
+                 data);
+    }
+
+    /**
+     * The debit logs are stored one after the other, all of them having the same size.
+     */
+    static void putSvDebitLogs(std::vector<uint8_t>& output,
+                               const std::vector<std::shared_ptr<SvDebitLogRecord>>& logs)
+    {
+        checkLimit(logs.size());
+
+        const std::size_t offset = CardImageSnapshot::HEADER_SIZE +
+                                   CardImageSnapshot::SV_DEBIT_LOGS * CardImageSnapshot::SLICE_SIZE;
+        const std::size_t start = output.size();
+        for (const auto& log : logs) {
+            const ByteView rawData = log->getRawDataView();
+            if (rawData.size() != logs.front()->getRawDataView().size()) {
+                throw IllegalArgumentException("The SV debit logs must have the same size.");
+            }
+            output.insert(output.end(), rawData.begin(), rawData.end());
+        }
+
+        putUint16(output, CardImageSnapshot::SV_DEBIT_LOGS_NUMBER_OFFSET, logs.size());
+        putUint32(output, offset, static_cast<uint32_t>(start));
+        putUint32(output, offset + 4, static_cast<uint32_t>(output.size() - start));
+    }
+
+    /**
+     *
+     */
+    static void putFile(std::vector<uint8_t>& output,
+                        const std::size_t entry,
+                        const ElementaryFile& ef)
+    {
+        output[entry + CardImageSnapshot::SFI_OFFSET] = ef.getSfi();
+
+        uint8_t flags = 0;
+        const std::shared_ptr<FileHeader> header = ef.getHeader();
+        if (header != nullptr) {
+            flags |= CardImageSnapshot::HEADER_PRESENT;
+            putUint16(output, entry + CardImageSnapshot::LID_OFFSET, header->getLid());
+            output[entry + CardImageSnapshot::EF_TYPE_OFFSET] =
+                static_cast<uint8_t>(header->getEfType());
+            putUint16(output,
+                      entry + CardImageSnapshot::RECORDS_NUMBER_OFFSET,
+                      static_cast<std::size_t>(header->getRecordsNumber()));
+            putUint16(output,
+                      entry + CardImageSnapshot::RECORD_SIZE_OFFSET,
+                      static_cast<std::size_t>(header->getRecordSize()));
+
+            const std::shared_ptr<uint8_t> dfStatus = header->getDfStatus();
+            if (dfStatus != nullptr) {
+                flags |= CardImageSnapshot::FILE_DF_STATUS_PRESENT;
+                output[entry + CardImageSnapshot::FILE_DF_STATUS_OFFSET] = *dfStatus;
+            }
+
+            const std::shared_ptr<uint16_t> sharedReference = header->getSharedReference();
+            if (sharedReference != nullptr) {
+                flags |= CardImageSnapshot::SHARED_REFERENCE_PRESENT;
+                putUint16(output,
+                          entry + CardImageSnapshot::SHARED_REFERENCE_OFFSET,
+                          *sharedReference);
+            }
+
+            putSlice(output,
+                     entry + CardImageSnapshot::ACCESS_CONDITIONS_OFFSET,
+                     header->getAccessConditions());
+            putSlice(output,
+                     entry + CardImageSnapshot::KEY_INDEXES_OFFSET,
+                     header->getKeyIndexes());
+        }
+
+        output[entry + CardImageSnapshot::FILE_FLAGS_OFFSET] = flags;
+
+        /* Same layout as the RecordStore: lengths and known offsets, then fixed-size slots */
+        const RecordStore& records = ef.getData()->getRecordStore();
+        const int recordsNumber = records.getRecordsNumber();
+        const int slotSize = records.getRecordSize();
+        checkLimit(static_cast<std::size_t>(recordsNumber));
+        checkLimit(static_cast<std::size_t>(slotSize));
+
+        putUint16(output,
+                  entry + CardImageSnapshot::STORED_RECORDS_NUMBER_OFFSET,
+                  static_cast<std::size_t>(recordsNumber));
+        putUint16(output,
+                  entry + CardImageSnapshot::SLOT_SIZE_OFFSET,
+                  static_cast<std::size_t>(slotSize));
+
+        std::size_t position = output.size();
+        putUint32(output,
+                  entry + CardImageSnapshot::LENGTHS_OFFSET,
+                  static_cast<uint32_t>(position));
+        output.resize(position + recordsNumber * (4 + slotSize), 0);
+        putUint32(output,
+                  entry + CardImageSnapshot::KNOWN_OFFSETS_OFFSET,
+                  static_cast<uint32_t>(position + recordsNumber * 2));
+        putUint32(output,
+                  entry + CardImageSnapshot::SLOTS_OFFSET,
+                  static_cast<uint32_t>(position + recordsNumber * 4));
+
+        uint8_t* slot = output.data() + position + recordsNumber * 4;
+        for (int numRecord = 1; numRecord <= recordsNumber; numRecord++) {
+            const ByteView record = records.getRecord(numRecord);
+            putUint16(output, position, record.size());
+            putUint16(output,
+                      position + recordsNumber * 2,
+                      static_cast<std::size_t>(records.getKnownOffset(numRecord)));
+            std::copy(record.begin(), record.end(), slot);
+            position += 2;
+            slot += slotSize;
+        }
+    }
+};
+
+}
+}
+}
+}
@@ -0,0 +1,147 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+/* Calypsonet Terminal Calypso */
+#include "ByteView.h"
+
+/* Keyple Core Util */
+#include "IllegalArgumentException.h"
+#include "IndexOutOfBoundsException.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace calypso {
+namespace card {
+
+using namespace calypsonet::terminal::calypso;
+using namespace keyple::core::util::cpp::exception;
+
+/**
+ * Non-owning view of the counters of an EF, decoded on the fly from the content of its record #1.
+ *
+ * <p>The counter #N is extracted from the 3 bytes at the index [(N - 1) * 3] of the record, most
+ * significant byte first. If the record size is not a multiple of 3, the last truncated counter is
+ * ignored.
+ *
+ * <p>A CounterView does not allocate anything and has the same validity as the ByteView it is
+ * built on.
+ *
+ * @since 1.5.0
+ */
+class CounterView final {
+public:
+    /**
+     * Constructs an empty view.
+     *
+     * @since 1.5.0
+     */
+    CounterView() {}
+
+    /**
+     * Constructs a view on the provided record content.
+     *
+     * @param record The content of the record #1 of the EF.
+     * @since 1.5.0
+     */
+    explicit CounterView(const ByteView& record) : mRecord(record) {}
+
+    /**
+     * Gets the number of known counters.
+     *
+     * @return A positive or zero value.
+     * @since 1.5.0
+     */
+    int getCountersNumber() const
+    {
+        return static_cast<int>(mRecord.size() / 3);
+    }
+
+    /**
+     * Indicates if the value of a counter is known.
+     *
+     * @param numCounter The counter number.
+     * @return False if numCounter is out of range.
+     * @since 1.5.0
+     */
+    bool hasCounter(const int numCounter) const
+    {
+        return numCounter >= 1 && numCounter <= getCountersNumber();
+    }
+
+    /**
+     * Gets the value of a counter.
+     *
+     * @param numCounter The counter number (should be {@code >=} 1).
+     * @return The counter value.
+     * @throw IllegalArgumentException If numCounter is {@code <} 1.
+     * @throw IndexOutOfBoundsException If the counter is not known.
+     * @since 1.5.0
+     */
+    int getValue(const int numCounter) const
+    {
+        if (numCounter < 1) {
+            throw IllegalArgumentException("The counter number must be greater or equal to 1.");
+        }
+
+        if (numCounter > getCountersNumber()) {
+            throw IndexOutOfBoundsException("The counter #" + std::to_string(numCounter) +
+                                            " is not known.");
+        }
+
+        return decode(numCounter);
+    }
+
+    /**
+     * Gets the value of a counter if it is known.
+     *
+     * @param numCounter The counter number.
+     * @param value The variable to set with the counter value.
+     * @return False if the counter is not known, in which case value is not modified.
+     * @since 1.5.0
+     */
+    bool getValue(const int numCounter, int& value) const
+    {
+        if (!hasCounter(numCounter)) {
+            return false;
+        }
+
+        value = decode(numCounter);
+
+        return true;
+    }
+
+private:
+    /**
+     *
+     */
+    int decode(const int numCounter) const
+    {
+        const std::size_t i = (numCounter - 1) * 3;
+
+        return (mRecord[i] << 16) | (mRecord[i + 1] << 8) | mRecord[i + 2];
+    }
+
+    /**
+     *
+     */
+    ByteView mRecord;
+};
+
+}
+}
+}
+}
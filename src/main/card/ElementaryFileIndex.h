@@ -0,0 +1,232 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/* Calypsonet Terminal Calypso */
+#include "ElementaryFile.h"
+#include "FileHeader.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace calypso {
+namespace card {
+
+/**
+ * Index of the Elementary Files of a DF allowing constant time access by SFI or by LID.
+ *
+ * <p>The SFI index is a direct-indexed table of 32 entries. The LID index is a small open
+ * addressing hash table which only allocates when it grows.
+ *
+ * <p>A file must be indexed again with put(std::shared_ptr<ElementaryFile>) when its header
+ * becomes known, in order to be reachable by its LID.
+ *
+ * @since 1.5.0
+ */
+class ElementaryFileIndex final {
+public:
+    /**
+     * Constructs an empty index.
+     *
+     * @since 1.5.0
+     */
+    ElementaryFileIndex() : mLidSlots(static_cast<std::size_t>(MIN_LID_SLOTS)), mLidCount(0) {}
+
+    /**
+     * Adds a file to the index, or updates its indexation if it is already present.
+     *
+     * @param ef The file to index (ignored if null).
+     * @since 1.5.0
+     */
+    void put(const std::shared_ptr<ElementaryFile>& ef)
+    {
+        if (ef == nullptr) {
+            return;
+        }
+
+        if (std::find(mFiles.begin(), mFiles.end(), ef) == mFiles.end()) {
+            mFiles.push_back(ef);
+        }
+
+        const uint8_t sfi = ef->getSfi();
+        if (sfi != 0 && sfi < SFI_SLOTS) {
+            mSfiTable[sfi] = ef;
+        }
+
+        const std::shared_ptr<FileHeader> header = ef->getHeader();
+        if (header != nullptr) {
+            putLid(header->getLid(), ef);
+        }
+    }
+
+    /**
+     * Gets the file having the provided SFI.
+     *
+     * @param sfi The SFI to search.
+     * @return A null reference if the file is not found or if the SFI is equal to 0.
+     * @since 1.5.0
+     */
+    const std::shared_ptr<ElementaryFile>& getBySfi(const uint8_t sfi) const
+    {
+        return sfi < SFI_SLOTS ? mSfiTable[sfi] : nullFile();
+    }
+
+    /**
+     * Gets the file having the provided LID.
+     *
+     * @param lid The LID to search.
+     * @return A null reference if the file is not found.
+     * @since 1.5.0
+     */
+    const std::shared_ptr<ElementaryFile>& getByLid(const uint16_t lid) const
+    {
+        const LidSlot& slot = mLidSlots[findLidSlot(lid)];
+
+        return slot.used ? slot.ef : nullFile();
+    }
+
+    /**
+     * Gets all the indexed files, in the order they were first added.
+     *
+     * @return A not null reference (it may be empty if no one EF is indexed).
+     * @since 1.5.0
+     */
+    const std::vector<std::shared_ptr<ElementaryFile>>& getFiles() const
+    {
+        return mFiles;
+    }
+
+    /**
+     * Removes all the files from the index, keeping the allocated memory.
+     *
+     * @since 1.5.0
+     */
+    void clear()
+    {
+        for (auto& ef : mSfiTable) {
+            ef.reset();
+        }
+
+        for (auto& slot : mLidSlots) {
+            slot = LidSlot();
+        }
+
+        mLidCount = 0;
+        mFiles.clear();
+    }
+
+private:
+    /**
+     *
+     */
+    struct LidSlot {
+        LidSlot() : used(false), lid(0) {}
+
+        bool used;
+        uint16_t lid;
+        std::shared_ptr<ElementaryFile> ef;
+    };
+
+    /**
+     * SFI range is [1..30], slot 0 is never used.
+     */
+    static const uint8_t SFI_SLOTS = 32;
+
+    /**
+     * Must be a power of 2.
+     */
+    static const std::size_t MIN_LID_SLOTS = 32;
+
+    /**
+     *
+     */
+    static const std::shared_ptr<ElementaryFile>& nullFile()
+    {
+        static const std::shared_ptr<ElementaryFile> none;
+
+        return none;
+    }
+
+    /**
+     * Returns the slot holding the LID, or the empty slot where it should be inserted.
+     */
+    std::size_t findLidSlot(const uint16_t lid) const
+    {
+        const std::size_t mask = mLidSlots.size() - 1;
+        std::size_t i = (lid * 40503u >> 8) & mask;
+
+        while (mLidSlots[i].used && mLidSlots[i].lid != lid) {
+            i = (i + 1) & mask;
+        }
+
+        return i;
+    }
+
+    /**
+     *
+     */
+    void putLid(const uint16_t lid, const std::shared_ptr<ElementaryFile>& ef)
+    {
+        std::size_t i = findLidSlot(lid);
+
+        if (!mLidSlots[i].used) {
+            /* Keep the load factor below 1/2 */
+            if (2 * (mLidCount + 1) > mLidSlots.size()) {
+                std::vector<LidSlot> slots(2 * mLidSlots.size());
+                slots.swap(mLidSlots);
+                for (const auto& slot : slots) {
+                    if (slot.used) {
+                        mLidSlots[findLidSlot(slot.lid)] = slot;
+                    }
+                }
+
+                i = findLidSlot(lid);
+            }
+
+            mLidSlots[i].used = true;
+            mLidSlots[i].lid = lid;
+            mLidCount++;
+        }
+
+        mLidSlots[i].ef = ef;
+    }
+
+    /**
+     *
+     */
+    std::shared_ptr<ElementaryFile> mSfiTable[SFI_SLOTS];
+
+    /**
+     *
+     */
+    std::vector<LidSlot> mLidSlots;
+
+    /**
+     *
+     */
+    std::size_t mLidCount;
+
+    /**
+     *
+     */
+    std::vector<std::shared_ptr<ElementaryFile>> mFiles;
+};
+
+}
+}
+}
+}
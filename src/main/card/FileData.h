@@ -14,8 +14,14 @@
 
 #include <cstdint>
 #include <map>
+#include <memory>
 #include <vector>
 
+/* Calypsonet Terminal Calypso */
+#include "ByteView.h"
+#include "CounterView.h"
+#include "RecordStore.h"
+
 namespace calypsonet {
 namespace terminal {
 namespace calypso {
@@ -63,14 +69,49 @@ public:
                                                   const uint8_t dataOffset,
                                                   const uint8_t dataLength) const = 0;
 
+    /**
+     * Gets a view on the known content of record #1, without copy.<br>
+     * For a Binary file, it means all the bytes of the file.
+     *
+     * <p>The view is only valid as long as the file data is not modified (i.e. until the next
+     * "process" method of the transaction manager is invoked).
+     *
+     * @return An empty view if the record #1 is not set.
+     * @since 1.5.0
+     */
+    virtual const ByteView getContentView() const = 0;
+
+    /**
+     * Gets a view on the known content of a specific record, without copy.
+     *
+     * <p>The view is only valid as long as the file data is not modified (i.e. until the next
+     * "process" method of the transaction manager is invoked).
+     *
+     * @param numRecord The record number.
+     * @return An empty view if the requested record is not set.
+     * @since 1.5.0
+     */
+    virtual const ByteView getContentView(const uint8_t numRecord) const = 0;
+
     /**
      * Gets a reference to all known records content.
      *
      * @return a not null map possibly empty if there's no content.
      * @since 1.0.0
+     * @deprecated Use getRecordStore() instead.
      */
     virtual const std::map<const uint8_t, std::vector<uint8_t>>& getAllRecordsContent() const = 0;
 
+    /**
+     * Gets a reference to the contiguous store of all known records content.
+     *
+     * <p>Iterating over the records of the store is a linear scan of a single buffer.
+     *
+     * @return A not null reference, possibly empty if there's no content.
+     * @since 1.5.0
+     */
+    virtual const RecordStore& getRecordStore() const = 0;
+
     /**
      * Gets the known value of the counter #numCounter.<br>
      * The counter value is extracted from the 3 next bytes at the index [(numCounter - 1) * 3] of
@@ -96,6 +137,20 @@ public:
      * @since 1.0.0
      */
     virtual const std::map<const int, const int> getAllCountersValue() const = 0;
+
+    /**
+     * Gets a view on all known counters, decoded on demand from record #1 without any allocation.
+     *
+     * <p>Unlike getContentAsCounterValue(int) and getAllCountersValue(), the value of a counter
+     * is obtained with CounterView::getValue(int, int&) without building any object.
+     *
+     * <p>The view is only valid as long as the file data is not modified (i.e. until the next
+     * "process" method of the transaction manager is invoked).
+     *
+     * @return An empty view if record #1 is not set.
+     * @since 1.5.0
+     */
+    virtual const CounterView getCountersView() const = 0;
 };
 
 }
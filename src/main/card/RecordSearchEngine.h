@@ -0,0 +1,209 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+/* Calypsonet Terminal Calypso */
+#include "ByteView.h"
+#include "RecordStore.h"
+
+/* Keyple Core Util */
+#include "IllegalArgumentException.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace calypso {
+namespace card {
+
+using namespace calypsonet::terminal::calypso;
+using namespace keyple::core::util::cpp::exception;
+
+/**
+ * Host side implementation of the search semantics of the <b>Search Record Multiple</b> command,
+ * applied to records already present in the card image.
+ *
+ * <p>The data to search and the mask (padded right with FFh if absent or incomplete) are
+ * prepared once at construction. The comparison is then done 8 bytes at a time, using portable
+ * word operations.
+ *
+ * @since 1.5.0
+ */
+class RecordSearchEngine final {
+public:
+    /**
+     * Constructs a search engine for the provided data and mask.
+     *
+     * @param searchData The data to search (from 1 to 250 bytes).
+     * @param mask The mask of bits to take into account (its length must be less or equal than the
+     *        length of the data to search).
+     * @throw IllegalArgumentException If the data is empty or longer than 250 bytes, or if the
+     *        mask is longer than the data.
+     * @since 1.5.0
+     */
+    RecordSearchEngine(const std::vector<uint8_t>& searchData, const std::vector<uint8_t>& mask)
+    : mLength(searchData.size())
+    {
+        if (searchData.empty() || searchData.size() > 250) {
+            throw IllegalArgumentException("The search data length must be in range [1..250].");
+        }
+
+        if (mask.size() > searchData.size()) {
+            throw IllegalArgumentException("The mask must not be longer than the search data.");
+        }
+
+        /* Rounded up to a multiple of 8 bytes, the padding bytes having a null mask */
+        const std::size_t paddedLength = (mLength + 7) & ~static_cast<std::size_t>(7);
+        mData.resize(paddedLength);
+        mMask.resize(paddedLength);
+
+        for (std::size_t i = 0; i < mLength; i++) {
+            mMask[i] = i < mask.size() ? mask[i] : 0xFF;
+            mData[i] = searchData[i] & mMask[i];
+        }
+    }
+
+    /**
+     * Indicates if a record matches the search.
+     *
+     * @param record The record content.
+     * @param offset The offset from which the analysis is performed.
+     * @param repeatedOffset True if the analysis must be repeated at each following offset, until
+     *        the end of the record is reached.
+     * @return True if the searched data is found.
+     * @since 1.5.0
+     */
+    bool matches(const ByteView& record, const int offset, const bool repeatedOffset) const
+    {
+        if (offset < 0 || static_cast<std::size_t>(offset) + mLength > record.size()) {
+            return false;
+        }
+
+        const std::size_t lastOffset = repeatedOffset ? record.size() - mLength : offset;
+
+        for (std::size_t o = offset; o <= lastOffset; o++) {
+            if (matchesAt(record.data() + o, record.size() - o)) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * Searches the records of the provided store, from a given record to the last record of the
+     * EF.
+     *
+     * <p>The range analyzed in a record starts at the provided offset and ends after the searched
+     * data, or at the end of the record if the analysis is repeated. A record is only analyzed if
+     * this whole range has been read (see RecordStore::getKnownOffset()), so that the bytes set
+     * to 0 in place of unread data never produce a match.
+     *
+     * @param records The records to analyze.
+     * @param recordsNumber The number of records of the EF, as defined in its header.
+     * @param recordSize The size of the records of the EF, as defined in its header.
+     * @param startAtRecord The number of the first record to analyze.
+     * @param offset The offset from which the analysis is performed in each record.
+     * @param repeatedOffset True if the analysis must be repeated at each following offset.
+     * @param matchingRecordNumbers The list to which the numbers of the matching records are
+     *        added.
+     * @return False if a record to analyze (up to recordsNumber) is not known or if the range to
+     *         analyze has not been entirely read, in which case the result is incomplete.
+     * @since 1.5.0
+     */
+    bool search(const RecordStore& records,
+                const int recordsNumber,
+                const int recordSize,
+                const int startAtRecord,
+                const int offset,
+                const bool repeatedOffset,
+                std::vector<uint8_t>& matchingRecordNumbers) const
+    {
+        /* End of the range to analyze, limited to the size of the records */
+        const int rangeEnd = repeatedOffset
+                                 ? recordSize
+                                 : std::min(recordSize, offset + static_cast<int>(mLength));
+
+        for (int numRecord = startAtRecord; numRecord <= recordsNumber; numRecord++) {
+            if (!records.hasRecord(numRecord) ||
+                records.getKnownOffset(numRecord) > offset ||
+                static_cast<int>(records.getRecord(numRecord).size()) < rangeEnd) {
+                return false;
+            }
+
+            if (matches(records.getRecord(numRecord), offset, repeatedOffset)) {
+                matchingRecordNumbers.push_back(static_cast<uint8_t>(numRecord));
+            }
+        }
+
+        return true;
+    }
+
+private:
+    /**
+     * Compares the search data with the bytes at the provided location, which has at least
+     * mLength bytes available.
+     */
+    bool matchesAt(const uint8_t* bytes, const std::size_t available) const
+    {
+        uint64_t word;
+        uint64_t data;
+        uint64_t mask;
+        std::size_t i = 0;
+
+        for (; i + 8 <= mLength; i += 8) {
+            std::memcpy(&word, bytes + i, 8);
+            std::memcpy(&data, mData.data() + i, 8);
+            std::memcpy(&mask, mMask.data() + i, 8);
+            if ((word & mask) != data) {
+                return false;
+            }
+        }
+
+        if (i < mLength) {
+            /* Last partial word: never read past the end of the record */
+            word = 0;
+            std::memcpy(&word, bytes + i, std::min<std::size_t>(8, available - i));
+            std::memcpy(&data, mData.data() + i, 8);
+            std::memcpy(&mask, mMask.data() + i, 8);
+            if ((word & mask) != data) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     *
+     */
+    std::size_t mLength;
+
+    /**
+     * Search data already masked.
+     */
+    std::vector<uint8_t> mData;
+
+    /**
+     *
+     */
+    std::vector<uint8_t> mMask;
+};
+
+}
+}
+}
+}
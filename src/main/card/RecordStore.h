@@ -0,0 +1,360 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+/* Calypsonet Terminal Calypso */
+#include "ByteView.h"
+
+/* Keyple Core Util */
+#include "IllegalArgumentException.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace calypso {
+namespace card {
+
+using namespace calypsonet::terminal::calypso;
+using namespace keyple::core::util::cpp::exception;
+
+/**
+ * Contiguous storage of the records of an EF.
+ *
+ * <p>All the records are stored in a single buffer made of getRecordsNumber() slots of
+ * getRecordSize() bytes each: record #N is located at offset (N - 1) * getRecordSize(). A table
+ * gives the length of each record (0 means that the record is not set) and the offset of its
+ * first known byte: when only a part of a record has been read (see setRecordPart()), the bytes
+ * located before this offset are unknown and set to 0.
+ *
+ * <p>The store should be sized from FileHeader::getRecordsNumber() and
+ * FileHeader::getRecordSize() when the header is known, so that no reallocation occurs while the
+ * file content is collected. Otherwise, it grows as needed.
+ *
+ * <p>For a Binary file, the store contains a single record whose size is the file size.
+ *
+ * @since 1.5.0
+ */
+class RecordStore final {
+public:
+    /**
+     * Constructs an empty store.
+     *
+     * @since 1.5.0
+     */
+    RecordStore() : mRecordsNumber(0), mRecordSize(0), mSized(false) {}
+
+    /**
+     * Constructs a store able to contain the provided number of records of the provided size.
+     *
+     * @param recordsNumber The number of records (should be {@code >=} 0).
+     * @param recordSize The size of a record (should be {@code >=} 0).
+     * @throw IllegalArgumentException If one of the arguments is negative.
+     * @since 1.5.0
+     */
+    RecordStore(const int recordsNumber, const int recordSize)
+    : mRecordsNumber(0), mRecordSize(0), mSized(false)
+    {
+        resize(recordsNumber, recordSize);
+    }
+
+    /**
+     * Gets the number of record slots.
+     *
+     * @return A positive or zero value.
+     * @since 1.5.0
+     */
+    int getRecordsNumber() const
+    {
+        return mRecordsNumber;
+    }
+
+    /**
+     * Gets the size of a record slot.
+     *
+     * @return A positive or zero value.
+     * @since 1.5.0
+     */
+    int getRecordSize() const
+    {
+        return mRecordSize;
+    }
+
+    /**
+     * Indicates if the content of a record is known.
+     *
+     * @param numRecord The record number.
+     * @return False if the record is not set or out of range.
+     * @since 1.5.0
+     */
+    bool hasRecord(const int numRecord) const
+    {
+        return numRecord >= 1 && numRecord <= mRecordsNumber && mLengths[numRecord - 1] != 0;
+    }
+
+    /**
+     * Gets the offset of the first known byte of a record.
+     *
+     * @param numRecord The record number.
+     * @return 0 if the record is fully known, not set or out of range.
+     * @since 1.5.0
+     */
+    int getKnownOffset(const int numRecord) const
+    {
+        return hasRecord(numRecord) ? mOffsets[numRecord - 1] : 0;
+    }
+
+    /**
+     * Gets a view on the content of a record, from its first byte to its last known byte.
+     *
+     * <p>The bytes located before getKnownOffset() are not known and are set to 0.
+     *
+     * @param numRecord The record number.
+     * @return An empty view if the record is not set or out of range.
+     * @since 1.5.0
+     */
+    ByteView getRecord(const int numRecord) const
+    {
+        if (!hasRecord(numRecord)) {
+            return ByteView();
+        }
+
+        return ByteView(mBuffer.data() + (numRecord - 1) * mRecordSize, mLengths[numRecord - 1]);
+    }
+
+    /**
+     * Sets the content of a record, replacing its previous content.
+     *
+     * <p>The store grows if the record number or the content length exceed its current
+     * dimensions. The provided content must not be a view on this store.
+     *
+     * @param numRecord The record number (should be {@code >=} 1).
+     * @param content The record content.
+     * @throw IllegalArgumentException If numRecord is {@code <} 1.
+     * @since 1.5.0
+     */
+    void setRecord(const int numRecord, const ByteView& content)
+    {
+        checkRecordNumber(numRecord);
+        ensureCapacity(numRecord, static_cast<int>(content.size()));
+
+        if (!content.empty()) {
+            std::memmove(slot(numRecord), content.data(), content.size());
+        }
+
+        mLengths[numRecord - 1] = static_cast<uint16_t>(content.size());
+        mOffsets[numRecord - 1] = 0;
+    }
+
+    /**
+     * Sets a part of the content of a record, starting at the provided offset.
+     *
+     * <p>The known bytes of the record are kept if they are contiguous with the part, the known
+     * range of the record (from getKnownOffset() to the length) being extended to include it.
+     * Otherwise, the part replaces them and becomes the only known range of the record. In both
+     * cases, the bytes located before the known range are set to 0.
+     *
+     * <p>Setting an empty part has no effect.
+     *
+     * @param numRecord The record number (should be {@code >=} 1).
+     * @param offset The offset (should be {@code >=} 0).
+     * @param content The content of the part.
+     * @throw IllegalArgumentException If numRecord is {@code <} 1 or offset is {@code <} 0.
+     * @since 1.5.0
+     */
+    void setRecordPart(const int numRecord, const int offset, const ByteView& content)
+    {
+        checkRecordNumber(numRecord);
+
+        if (offset < 0) {
+            throw IllegalArgumentException("The offset must be positive or zero.");
+        }
+
+        if (content.empty()) {
+            return;
+        }
+
+        const int end = offset + static_cast<int>(content.size());
+        ensureCapacity(numRecord, end);
+
+        uint8_t* const record = slot(numRecord);
+        const int length = mLengths[numRecord - 1];
+        const int knownOffset = mOffsets[numRecord - 1];
+        std::memmove(record + offset, content.data(), content.size());
+
+        if (length != 0 && offset <= length && end >= knownOffset) {
+            mOffsets[numRecord - 1] = static_cast<uint16_t>(std::min(knownOffset, offset));
+            mLengths[numRecord - 1] = static_cast<uint16_t>(std::max(length, end));
+        } else {
+            std::fill(record, record + offset, 0);
+            mOffsets[numRecord - 1] = static_cast<uint16_t>(offset);
+            mLengths[numRecord - 1] = static_cast<uint16_t>(end);
+        }
+    }
+
+    /**
+     * Adds a record at the head of a cyclic file: record #1 becomes record #2 and so on.
+     *
+     * <p>When all the slots are used, the oldest record is lost if the number of records has been
+     * set (by the constructor or by resize()), i.e. is the one of the file. Otherwise, the store
+     * grows by one slot.
+     *
+     * @param content The content of the new record #1.
+     * @since 1.5.0
+     */
+    void appendRecord(const ByteView& content)
+    {
+        if (mRecordsNumber == 0 || (!mSized && mLengths[mRecordsNumber - 1] != 0)) {
+            reallocate(mRecordsNumber + 1, std::max(static_cast<int>(content.size()), mRecordSize));
+        } else {
+            ensureCapacity(1, static_cast<int>(content.size()));
+        }
+
+        if (mRecordsNumber > 1) {
+            std::memmove(slot(2), slot(1), (mRecordsNumber - 1) * mRecordSize);
+            std::memmove(&mLengths[1], &mLengths[0], (mRecordsNumber - 1) * sizeof(uint16_t));
+            std::memmove(&mOffsets[1], &mOffsets[0], (mRecordsNumber - 1) * sizeof(uint16_t));
+        }
+
+        setRecord(1, content);
+    }
+
+    /**
+     * Removes the content of all the records, keeping the allocated memory.
+     *
+     * @since 1.5.0
+     */
+    void clear()
+    {
+        std::fill(mLengths.begin(), mLengths.end(), 0);
+        std::fill(mOffsets.begin(), mOffsets.end(), 0);
+    }
+
+    /**
+     * Changes the dimensions of the store, keeping the content of the records which still fit in
+     * it. A record longer than the new record size becomes unset, so that a truncated record is
+     * never taken for a complete one.
+     *
+     * @param recordsNumber The number of records (should be {@code >=} 0).
+     * @param recordSize The size of a record (should be {@code >=} 0).
+     * @throw IllegalArgumentException If one of the arguments is negative.
+     * @since 1.5.0
+     */
+    void resize(const int recordsNumber, const int recordSize)
+    {
+        if (recordsNumber < 0 || recordSize < 0) {
+            throw IllegalArgumentException("The dimensions of the store must be positive or zero.");
+        }
+
+        mSized = true;
+        reallocate(recordsNumber, recordSize);
+    }
+
+private:
+    /**
+     *
+     */
+    static void checkRecordNumber(const int numRecord)
+    {
+        if (numRecord < 1) {
+            throw IllegalArgumentException("The record number must be greater or equal to 1.");
+        }
+    }
+
+    /**
+     *
+     */
+    void ensureCapacity(const int numRecord, const int length)
+    {
+        if (numRecord > mRecordsNumber || length > mRecordSize) {
+            reallocate(std::max(numRecord, mRecordsNumber), std::max(length, mRecordSize));
+        }
+    }
+
+    /**
+     * A record longer than the new record size becomes unset.
+     */
+    void reallocate(const int recordsNumber, const int recordSize)
+    {
+        if (recordsNumber == mRecordsNumber && recordSize == mRecordSize) {
+            return;
+        }
+
+        std::vector<uint8_t> buffer(recordsNumber * recordSize);
+        std::vector<uint16_t> lengths(recordsNumber);
+        std::vector<uint16_t> offsets(recordsNumber);
+
+        const int commonRecords = std::min(recordsNumber, mRecordsNumber);
+        for (int i = 0; i < commonRecords; i++) {
+            if (mLengths[i] > recordSize) {
+                continue;
+            }
+            lengths[i] = mLengths[i];
+            offsets[i] = mOffsets[i];
+            std::memcpy(
+                buffer.data() + i * recordSize, mBuffer.data() + i * mRecordSize, lengths[i]);
+        }
+
+        mBuffer.swap(buffer);
+        mLengths.swap(lengths);
+        mOffsets.swap(offsets);
+        mRecordsNumber = recordsNumber;
+        mRecordSize = recordSize;
+    }
+
+    /**
+     *
+     */
+    uint8_t* slot(const int numRecord)
+    {
+        return mBuffer.data() + (numRecord - 1) * mRecordSize;
+    }
+
+    /**
+     *
+     */
+    int mRecordsNumber;
+
+    /**
+     *
+     */
+    int mRecordSize;
+
+    /**
+     *
+     */
+    std::vector<uint8_t> mBuffer;
+
+    /**
+     *
+     */
+    std::vector<uint16_t> mLengths;
+
+    /**
+     *
+     */
+    std::vector<uint16_t> mOffsets;
+
+    /**
+     *
+     */
+    bool mSized;
+};
+
+}
+}
+}
+}
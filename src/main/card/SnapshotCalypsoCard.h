@@ -0,0 +1,1396 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/* Calypsonet Terminal Calypso */
+#include "ByteView.h"
+#include "CalypsoCard.h"
+#include "CardImageSnapshot.h"
+#include "CounterView.h"
+#include "DirectoryHeader.h"
+#include "ElementaryFile.h"
+#include "ElementaryFileIndex.h"
+#include "FileData.h"
+#include "FileHeader.h"
+#include "RecordStore.h"
+#include "SvDebitLogRecord.h"
+#include "SvLoadLogRecord.h"
+#include "WriteAccessLevel.h"
+
+/* Keyple Core Util */
+#include "IllegalArgumentException.h"
+#include "IllegalStateException.h"
+#include "IndexOutOfBoundsException.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace calypso {
+namespace card {
+
+using namespace calypsonet::terminal::calypso;
+using namespace keyple::core::util::cpp::exception;
+
+/**
+ * Read-only CalypsoCard rebuilt from a snapshot written by CardImageSnapshotWriter.
+ *
+ * <p>The snapshot is not parsed: the constructor validates its structure (see CardImageSnapshot)
+ * and creates one lightweight object per Elementary File. The record contents are views on the
+ * snapshot buffer (getContentView(), getCountersView()); the legacy getters returning a
+ * reference (FileData::getAllRecordsContent() and FileData::getRecordStore()) build their copy
+ * on the first call only.
+ *
+ * <p>The values which were not available when the snapshot was written are reported as in the
+ * original card image: the PIN and SV getters throw IllegalStateException, the directory header
+ * and the SV logs are null.
+ *
+ * <p>The snapshot buffer is either owned by the instance or only referenced, for example when it
+ * is memory-mapped. In the latter case, the buffer must remain valid and unchanged as long as the
+ * instance is used. In both cases, the objects obtained from the instance (files, headers, logs)
+ * must not be used after its destruction.
+ *
+ * <p>The instance is immutable and may be shared between threads.
+ *
+ * @since 1.5.0
+ */
+class SnapshotCalypsoCard final : public CalypsoCard {
+public:
+    /**
+     * Creates a card image referencing a snapshot buffer, without copy.
+     *
+     * @param image The snapshot buffer.
+     * @throw IllegalArgumentException If the buffer is not a valid snapshot.
+     * @since 1.5.0
+     */
+    explicit SnapshotCalypsoCard(const ByteView& image) : mSnapshot(image)
+    {
+        load();
+    }
+
+    /**
+     * Creates a card image owning a snapshot buffer.
+     *
+     * @param image The snapshot buffer, moved into the instance.
+     * @throw IllegalArgumentException If the buffer is not a valid snapshot.
+     * @since 1.5.0
+     */
+    explicit SnapshotCalypsoCard(std::vector<uint8_t>&& image)
+    : mOwnedImage(std::move(image)), mSnapshot(ByteView(mOwnedImage))
+    {
+        load();
+    }
+
+    /**
+     *
+     */
+    SnapshotCalypsoCard(const SnapshotCalypsoCard&) = delete;
+
+    /**
+     *
+     */
+    SnapshotCalypsoCard& operator=(const SnapshotCalypsoCard&) = delete;
+
+    /**
+     * Gets the snapshot.
+     *
+     * @return A valid snapshot.
+     * @since 1.5.0
+     */
+    const CardImageSnapshot& getSnapshot() const
+    {
+        return mSnapshot;
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    const std::string& getPowerOnData() const override
+    {
+        return mPowerOnData;
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    const std::vector<uint8_t> getSelectApplicationResponse() const override
+    {
+        return mSnapshot.getBlob(CardImageSnapshot::SELECT_APPLICATION_RESPONSE).toVector();
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    const ProductType& getProductType() const override
+    {
+        return mProductType;
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    bool isHce() const override
+    {
+        return mSnapshot.hasFlag(CardImageSnapshot::HCE);
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    bool isDfInvalidated() const override
+    {
+        return mSnapshot.hasFlag(CardImageSnapshot::DF_INVALIDATED);
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    const std::vector<uint8_t>& getDfName() const override
+    {
+        return mDfName;
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    const std::vector<uint8_t> getApplicationSerialNumber() const override
+    {
+        return getApplicationSerialNumberView().toVector();
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    const ByteView getDfNameView() const override
+    {
+        return mSnapshot.getBlob(CardImageSnapshot::DF_NAME);
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    const ByteView getApplicationSerialNumberView() const override
+    {
+        return mSnapshot.getBlob(CardImageSnapshot::APPLICATION_SERIAL_NUMBER);
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    const std::vector<uint8_t>& getStartupInfoRawData() const override
+    {
+        return mStartupInfo;
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    uint8_t getPlatform() const override
+    {
+        return mSnapshot.getUint8(CardImageSnapshot::PLATFORM_OFFSET);
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    uint8_t getApplicationType() const override
+    {
+        return mSnapshot.getUint8(CardImageSnapshot::APPLICATION_TYPE_OFFSET);
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    uint8_t getApplicationSubtype() const override
+    {
+        return mSnapshot.getUint8(CardImageSnapshot::APPLICATION_SUBTYPE_OFFSET);
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    uint8_t getSoftwareIssuer() const override
+    {
+        return mSnapshot.getUint8(CardImageSnapshot::SOFTWARE_ISSUER_OFFSET);
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    uint8_t getSoftwareVersion() const override
+    {
+        return mSnapshot.getUint8(CardImageSnapshot::SOFTWARE_VERSION_OFFSET);
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    uint8_t getSoftwareRevision() const override
+    {
+        return mSnapshot.getUint8(CardImageSnapshot::SOFTWARE_REVISION_OFFSET);
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    uint8_t getSessionModification() const override
+    {
+        return mSnapshot.getUint8(CardImageSnapshot::SESSION_MODIFICATION_OFFSET);
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    const std::vector<uint8_t> getTraceabilityInformation() const override
+    {
+        return mSnapshot.getBlob(CardImageSnapshot::TRACEABILITY_INFORMATION).toVector();
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    const std::shared_ptr<DirectoryHeader> getDirectoryHeader() const override
+    {
+        return mDirectoryHeader;
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    const std::shared_ptr<ElementaryFile> getFileBySfi(const uint8_t sfi) const override
+    {
+        return mIndex.getBySfi(sfi);
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    const std::shared_ptr<ElementaryFile> getFileByLid(const uint16_t lid) const override
+    {
+        return mIndex.getByLid(lid);
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    const std::map<const uint8_t, const std::shared_ptr<ElementaryFile>> getAllFiles() const
+        override
+    {
+        std::map<const uint8_t, const std::shared_ptr<ElementaryFile>> files;
+        for (const auto& ef : mIndex.getFiles()) {
+            if (ef->getSfi() != 0) {
+                files.insert({ef->getSfi(), ef});
+            }
+        }
+
+        return files;
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    const std::vector<std::shared_ptr<ElementaryFile>>& getFiles() const override
+    {
+        return mIndex.getFiles();
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    bool isDfRatified() const override
+    {
+        return mSnapshot.hasFlag(CardImageSnapshot::DF_RATIFIED);
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @throw IllegalStateException If the transaction counter was not available in the card
+     *        image.
+     * @since 1.5.0
+     */
+    int getTransactionCounter() const override
+    {
+        if (!mSnapshot.hasFlag(CardImageSnapshot::TRANSACTION_COUNTER_KNOWN)) {
+            throw IllegalStateException("No session has been opened.");
+        }
+
+        return static_cast<int>(mSnapshot.getUint32(CardImageSnapshot::TRANSACTION_COUNTER_OFFSET));
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    bool isPkiModeSupported() const override
+    {
+        return mSnapshot.hasFlag(CardImageSnapshot::PKI_MODE_SUPPORTED);
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    bool isExtendedModeSupported() const override
+    {
+        return mSnapshot.hasFlag(CardImageSnapshot::EXTENDED_MODE_SUPPORTED);
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    bool isRatificationOnDeselectSupported() const override
+    {
+        return mSnapshot.hasFlag(CardImageSnapshot::RATIFICATION_ON_DESELECT_SUPPORTED);
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    bool isPinFeatureAvailable() const override
+    {
+        return mSnapshot.hasFlag(CardImageSnapshot::PIN_FEATURE_AVAILABLE);
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @throw IllegalStateException If the PIN status was not available in the card image.
+     * @since 1.5.0
+     */
+    bool isPinBlocked() const override
+    {
+        checkPinStatus();
+
+        return mSnapshot.hasFlag(CardImageSnapshot::PIN_BLOCKED);
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @throw IllegalStateException If the PIN status was not available in the card image.
+     * @since 1.5.0
+     */
+    int getPinAttemptRemaining() const override
+    {
+        checkPinStatus();
+
+        return static_cast<int>(
+            mSnapshot.getUint32(CardImageSnapshot::PIN_ATTEMPT_REMAINING_OFFSET));
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    bool isSvFeatureAvailable() const override
+    {
+        return mSnapshot.hasFlag(CardImageSnapshot::SV_FEATURE_AVAILABLE);
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @throw IllegalStateException If the SV status was not available in the card image.
+     * @since 1.5.0
+     */
+    int getSvBalance() const override
+    {
+        checkSvStatus();
+
+        return static_cast<int>(mSnapshot.getUint32(CardImageSnapshot::SV_BALANCE_OFFSET));
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @throw IllegalStateException If the SV status was not available in the card image.
+     * @since 1.5.0
+     */
+    int getSvLastTNum() const override
+    {
+        checkSvStatus();
+
+        return static_cast<int>(mSnapshot.getUint32(CardImageSnapshot::SV_LAST_TNUM_OFFSET));
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    const std::shared_ptr<SvLoadLogRecord> getSvLoadLogRecord() override
+    {
+        return mSvLoadLogRecord;
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    const std::shared_ptr<SvDebitLogRecord> getSvDebitLogLastRecord() override
+    {
+        return mSvDebitLogRecords.empty() ? nullptr : mSvDebitLogRecords.back();
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    const std::vector<std::shared_ptr<SvDebitLogRecord>> getSvDebitLogAllRecords() const override
+    {
+        return mSvDebitLogRecords;
+    }
+
+private:
+    /**
+     * FileHeader of a file descriptor.
+     */
+    class SnapshotFileHeader final : public FileHeader {
+    public:
+        /**
+         *
+         */
+        SnapshotFileHeader(const CardImageSnapshot& snapshot, const std::size_t entry)
+        : mLid(snapshot.getUint16(entry + CardImageSnapshot::LID_OFFSET)),
+          mEfType(static_cast<ElementaryFile::Type>(
+              snapshot.getUint8(entry + CardImageSnapshot::EF_TYPE_OFFSET))),
+          mRecordsNumber(snapshot.getUint16(entry + CardImageSnapshot::RECORDS_NUMBER_OFFSET)),
+          mRecordSize(snapshot.getUint16(entry + CardImageSnapshot::RECORD_SIZE_OFFSET)),
+          mAccessConditions(
+              snapshot.getSlice(entry + CardImageSnapshot::ACCESS_CONDITIONS_OFFSET).toVector()),
+          mKeyIndexes(snapshot.getSlice(entry + CardImageSnapshot::KEY_INDEXES_OFFSET).toVector())
+        {
+            const uint8_t flags = snapshot.getUint8(entry + CardImageSnapshot::FILE_FLAGS_OFFSET);
+
+            if ((flags & CardImageSnapshot::FILE_DF_STATUS_PRESENT) != 0) {
+                mDfStatus = std::make_shared<uint8_t>(
+                    snapshot.getUint8(entry + CardImageSnapshot::FILE_DF_STATUS_OFFSET));
+            }
+
+            if ((flags & CardImageSnapshot::SHARED_REFERENCE_PRESENT) != 0) {
+                mSharedReference = std::make_shared<uint16_t>(
+                    snapshot.getUint16(entry + CardImageSnapshot::SHARED_REFERENCE_OFFSET));
+            }
+        }
+
+        /**
+         *
+         */
+        uint16_t getLid() const override
+        {
+            return mLid;
+        }
+
+        /**
+         *
+         */
+        const std::shared_ptr<uint8_t> getDfStatus() const override
+        {
+            return mDfStatus;
+        }
+
+        /**
+         *
+         */
+        ElementaryFile::Type getEfType() const override
+        {
+            return mEfType;
+        }
+
+        /**
+         *
+         */
+        int getRecordsNumber() const override
+        {
+            return mRecordsNumber;
+        }
+
+        /**
+         *
+         */
+        int getRecordSize() const override
+        {
+            return mRecordSize;
+        }
+
+        /**
+         *
+         */
+        const std::vector<uint8_t>& getAccessConditions() const override
+        {
+            return mAccessConditions;
+        }
+
+        /**
+         *
+         */
+        const std::vector<uint8_t>& getKeyIndexes() const override
+        {
+            return mKeyIndexes;
+        }
+
+        /**
+         *
+         */
+        const std::shared_ptr<uint16_t> getSharedReference() const override
+        {
+            return mSharedReference;
+        }
+
+    private:
+        /**
+         *
+         */
+        const uint16_t mLid;
+
+        /**
+         *
+         */
+        const ElementaryFile::Type mEfType;
+
+        /**
+         *
+         */
+        const int mRecordsNumber;
+
+        /**
+         *
+         */
+        const int mRecordSize;
+
+        /**
+         *
+         */
+        const std::vector<uint8_t> mAccessConditions;
+
+        /**
+         *
+         */
+        const std::vector<uint8_t> mKeyIndexes;
+
+        /**
+         *
+         */
+        std::shared_ptr<uint8_t> mDfStatus;
+
+        /**
+         *
+         */
+        std::shared_ptr<uint16_t> mSharedReference;
+    };
+
+    /**
+     * FileData reading the records in place.
+     */
+    class SnapshotFileData final : public FileData {
+    public:
+        /**
+         *
+         */
+        SnapshotFileData(const CardImageSnapshot& snapshot, const std::size_t entry)
+        : mRecordsNumber(
+              snapshot.getUint16(entry + CardImageSnapshot::STORED_RECORDS_NUMBER_OFFSET)),
+          mSlotSize(snapshot.getUint16(entry + CardImageSnapshot::SLOT_SIZE_OFFSET)),
+          mLengths(snapshot.getImage().data() +
+                   snapshot.getUint32(entry + CardImageSnapshot::LENGTHS_OFFSET)),
+          mSlots(snapshot.getImage().data() +
+                 snapshot.getUint32(entry + CardImageSnapshot::SLOTS_OFFSET)),
+          mKnownOffsets(snapshot.getImage().data() +
+                        snapshot.getUint32(entry + CardImageSnapshot::KNOWN_OFFSETS_OFFSET)) {}
+
+        /**
+         *
+         */
+        const std::vector<uint8_t> getContent() const override
+        {
+            return getRecord(1).toVector();
+        }
+
+        /**
+         *
+         */
+        const std::vector<uint8_t> getContent(const uint8_t numRecord) const override
+        {
+            return getRecord(numRecord).toVector();
+        }
+
+        /**
+         *
+         */
+        const std::vector<uint8_t> getContent(const uint8_t numRecord,
+                                              const uint8_t dataOffset,
+                                              const uint8_t dataLength) const override
+        {
+            if (dataLength < 1) {
+                throw IllegalArgumentException("The data length must be greater or equal to 1.");
+            }
+
+            const ByteView record = getRecord(numRecord);
+            if (record.empty()) {
+                return std::vector<uint8_t>();
+            }
+
+            if (dataOffset >= record.size()) {
+                throw IndexOutOfBoundsException("Offset >= content length.");
+            }
+
+            return record.subView(dataOffset, dataLength).toVector();
+        }
+
+        /**
+         *
+         */
+        const ByteView getContentView() const override
+        {
+            return getRecord(1);
+        }
+
+        /**
+         *
+         */
+        const ByteView getContentView(const uint8_t numRecord) const override
+        {
+            return getRecord(numRecord);
+        }
+
+        /**
+         * Built on the first call.
+         */
+        const std::map<const uint8_t, std::vector<uint8_t>>& getAllRecordsContent() const override
+        {
+            std::call_once(mRecordsFlag, [this]() {
+                for (int numRecord = 1; numRecord <= mRecordsNumber && numRecord <= 0xFF;
+                     numRecord++) {
+                    const ByteView record = getRecord(numRecord);
+                    if (!record.empty()) {
+                        mRecords.insert({static_cast<uint8_t>(numRecord), record.toVector()});
+                    }
+                }
+            });
+
+            return mRecords;
+        }
+
+        /**
+         * Built on the first call.
+         */
+        const RecordStore& getRecordStore() const override
+        {
+            std::call_once(mStoreFlag, [this]() {
+                mStore.resize(mRecordsNumber, mSlotSize);
+                for (int numRecord = 1; numRecord <= mRecordsNumber; numRecord++) {
+                    const ByteView record = getRecord(numRecord);
+                    const std::size_t knownOffset = getKnownOffset(numRecord);
+                    if (knownOffset < record.size()) {
+                        mStore.setRecordPart(numRecord,
+                                             static_cast<int>(knownOffset),
+                                             record.subView(knownOffset,
+                                                            record.size() - knownOffset));
+                    }
+                }
+            });
+
+            return mStore;
+        }
+
+        /**
+         *
+         */
+        const std::shared_ptr<int> getContentAsCounterValue(const int numCounter) const override
+        {
+            if (numCounter < 1) {
+                throw IllegalArgumentException("The counter number must be greater or equal to 1.");
+            }
+
+            const ByteView record = getRecord(1);
+            const std::size_t counterIndex = (numCounter - 1) * 3;
+            if (counterIndex >= record.size()) {
+                return nullptr;
+            }
+
+            if (counterIndex + 3 > record.size()) {
+                throw IndexOutOfBoundsException("The counter value is truncated.");
+            }
+
+            return std::make_shared<int>(getCountersView().getValue(numCounter));
+        }
+
+        /**
+         *
+         */
+        const std::map<const int, const int> getAllCountersValue() const override
+        {
+            std::map<const int, const int> counters;
+
+            const CounterView view = getCountersView();
+            for (int numCounter = 1; numCounter <= view.getCountersNumber(); numCounter++) {
+                counters.insert({numCounter, view.getValue(numCounter)});
+            }
+
+            return counters;
+        }
+
+        /**
+         *
+         */
+        const CounterView getCountersView() const override
+        {
+            return CounterView(getRecord(1));
+        }
+
+    private:
+        /**
+         * The known length is bounded by the slot size, the snapshot being possibly corrupted.
+         */
+        ByteView getRecord(const int numRecord) const
+        {
+            if (numRecord < 1 || numRecord > mRecordsNumber) {
+                return ByteView();
+            }
+
+            const uint8_t* const length = mLengths + (numRecord - 1) * 2;
+
+            return ByteView(mSlots + (numRecord - 1) * mSlotSize,
+                            std::min<std::size_t>(length[0] | length[1] << 8, mSlotSize));
+        }
+
+        /**
+         * The known offset is bounded by the slot size, like the known length.
+         */
+        std::size_t getKnownOffset(const int numRecord) const
+        {
+            const uint8_t* const knownOffset = mKnownOffsets + (numRecord - 1) * 2;
+
+            return std::min<std::size_t>(knownOffset[0] | knownOffset[1] << 8, mSlotSize);
+        }
+
+        /**
+         *
+         */
+        const int mRecordsNumber;
+
+        /**
+         *
+         */
+        const int mSlotSize;
+
+        /**
+         *
+         */
+        const uint8_t* const mLengths;
+
+        /**
+         *
+         */
+        const uint8_t* const mSlots;
+
+        /**
+         *
+         */
+        const uint8_t* const mKnownOffsets;
+
+        /**
+         *
+         */
+        mutable std::once_flag mRecordsFlag;
+
+        /**
+         *
+         */
+        mutable std::map<const uint8_t, std::vector<uint8_t>> mRecords;
+
+        /**
+         *
+         */
+        mutable std::once_flag mStoreFlag;
+
+        /**
+         *
+         */
+        mutable RecordStore mStore;
+    };
+
+    /**
+     * ElementaryFile of a file descriptor.
+     */
+    class SnapshotElementaryFile final : public ElementaryFile {
+    public:
+        /**
+         *
+         */
+        SnapshotElementaryFile(const CardImageSnapshot& snapshot, const std::size_t entry)
+        : mSfi(snapshot.getUint8(entry + CardImageSnapshot::SFI_OFFSET)),
+          mData(std::make_shared<SnapshotFileData>(snapshot, entry))
+        {
+            if ((snapshot.getUint8(entry + CardImageSnapshot::FILE_FLAGS_OFFSET) &
+                 CardImageSnapshot::HEADER_PRESENT) != 0) {
+                mHeader = std::make_shared<SnapshotFileHeader>(snapshot, entry);
+            }
+        }
+
+        /**
+         *
+         */
+        uint8_t getSfi() const override
+        {
+            return mSfi;
+        }
+
+        /**
+         *
+         */
+        const std::shared_ptr<FileHeader> getHeader() const override
+        {
+            return mHeader;
+        }
+
+        /**
+         *
+         */
+        const std::shared_ptr<FileData> getData() const override
+        {
+            return mData;
+        }
+
+    private:
+        /**
+         *
+         */
+        const uint8_t mSfi;
+
+        /**
+         *
+         */
+        std::shared_ptr<FileHeader> mHeader;
+
+        /**
+         *
+         */
+        const std::shared_ptr<FileData> mData;
+    };
+
+    /**
+     * DirectoryHeader of the snapshot header.
+     */
+    class SnapshotDirectoryHeader final : public DirectoryHeader {
+    public:
+        /**
+         *
+         */
+        explicit SnapshotDirectoryHeader(const CardImageSnapshot& snapshot)
+        : mLid(snapshot.getUint16(CardImageSnapshot::DF_LID_OFFSET)),
+          mDfStatus(snapshot.getUint8(CardImageSnapshot::DF_STATUS_OFFSET)),
+          mAccessConditions(snapshot.getBlob(CardImageSnapshot::DF_ACCESS_CONDITIONS).toVector()),
+          mKeyIndexes(snapshot.getBlob(CardImageSnapshot::DF_KEY_INDEXES).toVector())
+        {
+            for (int level = 0; level < 3; level++) {
+                mKif[level] = snapshot.getUint8(CardImageSnapshot::DF_KIF_OFFSET + level);
+                mKvc[level] = snapshot.getUint8(CardImageSnapshot::DF_KVC_OFFSET + level);
+            }
+        }
+
+        /**
+         *
+         */
+        uint16_t getLid() const override
+        {
+            return mLid;
+        }
+
+        /**
+         *
+         */
+        uint8_t getDfStatus() const override
+        {
+            return mDfStatus;
+        }
+
+        /**
+         *
+         */
+        const std::vector<uint8_t>& getAccessConditions() const override
+        {
+            return mAccessConditions;
+        }
+
+        /**
+         *
+         */
+        const std::vector<uint8_t>& getKeyIndexes() const override
+        {
+            return mKeyIndexes;
+        }
+
+        /**
+         *
+         */
+        uint8_t getKif(const WriteAccessLevel writeAccessLevel) const override
+        {
+            return mKif[static_cast<int>(writeAccessLevel)];
+        }
+
+        /**
+         *
+         */
+        uint8_t getKvc(const WriteAccessLevel writeAccessLevel) const override
+        {
+            return mKvc[static_cast<int>(writeAccessLevel)];
+        }
+
+    private:
+        /**
+         *
+         */
+        const uint16_t mLid;
+
+        /**
+         *
+         */
+        const uint8_t mDfStatus;
+
+        /**
+         *
+         */
+        const std::vector<uint8_t> mAccessConditions;
+
+        /**
+         *
+         */
+        const std::vector<uint8_t> mKeyIndexes;
+
+        /**
+         *
+         */
+        uint8_t mKif[3];
+
+        /**
+         *
+         */
+        uint8_t mKvc[3];
+    };
+
+    /**
+     * SvLoadLogRecord decoded from its raw data.
+     */
+    class SnapshotSvLoadLogRecord final : public SvLoadLogRecord {
+    public:
+        /**
+         *
+         */
+        static const std::size_t RECORD_SIZE = 22;
+
+        /**
+         *
+         */
+        explicit SnapshotSvLoadLogRecord(const ByteView& rawData) : mRawData(rawData.toVector()) {}
+
+        /**
+         *
+         */
+        const std::vector<uint8_t>& getRawData() const override
+        {
+            return mRawData;
+        }
+
+        /**
+         *
+         */
+        const ByteView getRawDataView() const override
+        {
+            return mRawData;
+        }
+
+        /**
+         *
+         */
+        const std::vector<uint8_t> getLoadDate() const override
+        {
+            return std::vector<uint8_t>(mRawData.begin(), mRawData.begin() + 2);
+        }
+
+        /**
+         *
+         */
+        const std::vector<uint8_t> getLoadTime() const override
+        {
+            return std::vector<uint8_t>(mRawData.begin() + 10, mRawData.begin() + 12);
+        }
+
+        /**
+         *
+         */
+        int getAmount() const override
+        {
+            return getSignedInt24(6);
+        }
+
+        /**
+         *
+         */
+        int getBalance() const override
+        {
+            return getSignedInt24(3);
+        }
+
+        /**
+         *
+         */
+        const std::vector<uint8_t> getFreeData() const override
+        {
+            return std::vector<uint8_t>({mRawData[2], mRawData[9]});
+        }
+
+        /**
+         *
+         */
+        uint8_t getKvc() const override
+        {
+            return mRawData[12];
+        }
+
+        /**
+         *
+         */
+        const std::vector<uint8_t> getSamId() const override
+        {
+            return std::vector<uint8_t>(mRawData.begin() + 13, mRawData.begin() + 17);
+        }
+
+        /**
+         *
+         */
+        int getSamTNum() const override
+        {
+            return mRawData[17] << 16 | mRawData[18] << 8 | mRawData[19];
+        }
+
+        /**
+         *
+         */
+        int getSvTNum() const override
+        {
+            return mRawData[20] << 8 | mRawData[21];
+        }
+
+    private:
+        /**
+         *
+         */
+        int getSignedInt24(const std::size_t offset) const
+        {
+            const int value =
+                mRawData[offset] << 16 | mRawData[offset + 1] << 8 | mRawData[offset + 2];
+
+            return (value & 0x800000) != 0 ? value - 0x1000000 : value;
+        }
+
+        /**
+         *
+         */
+        const std::vector<uint8_t> mRawData;
+    };
+
+    /**
+     * SvDebitLogRecord decoded from its raw data.
+     */
+    class SnapshotSvDebitLogRecord final : public SvDebitLogRecord {
+    public:
+        /**
+         *
+         */
+        static const std::size_t RECORD_SIZE = 19;
+
+        /**
+         *
+         */
+        explicit SnapshotSvDebitLogRecord(const ByteView& rawData) : mRawData(rawData.toVector()) {}
+
+        /**
+         *
+         */
+        const std::vector<uint8_t>& getRawData() const override
+        {
+            return mRawData;
+        }
+
+        /**
+         *
+         */
+        const ByteView getRawDataView() const override
+        {
+            return mRawData;
+        }
+
+        /**
+         *
+         */
+        const std::vector<uint8_t> getDebitDate() const override
+        {
+            return std::vector<uint8_t>(mRawData.begin() + 2, mRawData.begin() + 4);
+        }
+
+        /**
+         *
+         */
+        const std::vector<uint8_t> getDebitTime() const override
+        {
+            return std::vector<uint8_t>(mRawData.begin() + 4, mRawData.begin() + 6);
+        }
+
+        /**
+         *
+         */
+        int getAmount() const override
+        {
+            return static_cast<int16_t>(mRawData[0] << 8 | mRawData[1]);
+        }
+
+        /**
+         *
+         */
+        int getBalance() const override
+        {
+            const int balance = mRawData[14] << 16 | mRawData[15] << 8 | mRawData[16];
+
+            return (balance & 0x800000) != 0 ? balance - 0x1000000 : balance;
+        }
+
+        /**
+         *
+         */
+        uint8_t getKvc() const override
+        {
+            return mRawData[6];
+        }
+
+        /**
+         *
+         */
+        const std::vector<uint8_t> getSamId() const override
+        {
+            return std::vector<uint8_t>(mRawData.begin() + 7, mRawData.begin() + 11);
+        }
+
+        /**
+         *
+         */
+        int getSamTNum() const override
+        {
+            return mRawData[11] << 16 | mRawData[12] << 8 | mRawData[13];
+        }
+
+        /**
+         *
+         */
+        int getSvTNum() const override
+        {
+            return mRawData[17] << 8 | mRawData[18];
+        }
+
+    private:
+        /**
+         *
+         */
+        const std::vector<uint8_t> mRawData;
+    };
+
+    /**
+     * Creates the objects of the card image from the snapshot.
+     */
+    void load()
+    {
+        mProductType = static_cast<ProductType>(
+            mSnapshot.getUint8(CardImageSnapshot::PRODUCT_TYPE_OFFSET));
+
+        const ByteView powerOnData = mSnapshot.getBlob(CardImageSnapshot::POWER_ON_DATA);
+        mPowerOnData.assign(powerOnData.begin(), powerOnData.end());
+        mDfName = mSnapshot.getBlob(CardImageSnapshot::DF_NAME).toVector();
+        mStartupInfo = mSnapshot.getBlob(CardImageSnapshot::STARTUP_INFO).toVector();
+
+        if (mSnapshot.hasFlag(CardImageSnapshot::DIRECTORY_HEADER_PRESENT)) {
+            mDirectoryHeader = std::make_shared<SnapshotDirectoryHeader>(mSnapshot);
+        }
+
+        const ByteView svLoadLog = mSnapshot.getBlob(CardImageSnapshot::SV_LOAD_LOG);
+        if (!svLoadLog.empty()) {
+            if (svLoadLog.size() < SnapshotSvLoadLogRecord::RECORD_SIZE) {
+                throw IllegalArgumentException("Invalid SV load log in the card image snapshot.");
+            }
+
+            mSvLoadLogRecord = std::make_shared<SnapshotSvLoadLogRecord>(svLoadLog);
+        }
+
+        const ByteView svDebitLogs = mSnapshot.getBlob(CardImageSnapshot::SV_DEBIT_LOGS);
+        const std::size_t svDebitLogsNumber =
+            mSnapshot.getUint16(CardImageSnapshot::SV_DEBIT_LOGS_NUMBER_OFFSET);
+        if (svDebitLogsNumber != 0) {
+            const std::size_t logSize = svDebitLogs.size() / svDebitLogsNumber;
+            if (logSize < SnapshotSvDebitLogRecord::RECORD_SIZE ||
+                logSize * svDebitLogsNumber != svDebitLogs.size()) {
+                throw IllegalArgumentException("Invalid SV debit logs in the card image snapshot.");
+            }
+
+            mSvDebitLogRecords.reserve(svDebitLogsNumber);
+            for (std::size_t i = 0; i < svDebitLogsNumber; i++) {
+                mSvDebitLogRecords.push_back(std::make_shared<SnapshotSvDebitLogRecord>(
+                    svDebitLogs.subView(i * logSize, logSize)));
+            }
+        }
+
+        for (int i = 0; i < mSnapshot.getFilesNumber(); i++) {
+            mIndex.put(std::make_shared<SnapshotElementaryFile>(mSnapshot,
+                                                                mSnapshot.getFileEntryOffset(i)));
+        }
+    }
+
+    /**
+     *
+     */
+    void checkPinStatus() const
+    {
+        if (!mSnapshot.hasFlag(CardImageSnapshot::PIN_STATUS_KNOWN)) {
+            throw IllegalStateException("PIN status not available.");
+        }
+    }
+
+    /**
+     *
+     */
+    void checkSvStatus() const
+    {
+        if (!mSnapshot.hasFlag(CardImageSnapshot::SV_STATUS_KNOWN)) {
+            throw IllegalStateException("No SV Get command has been executed.");
+        }
+    }
+
+    /**
+     *
+     */
+    const std::vector<uint8_t> mOwnedImage;
+
+    /**
+     *
+     */
+    const CardImageSnapshot mSnapshot;
+
+    /**
+     *
+     */
+    ProductType mProductType;
+
+    /**
+     *
+     */
+    std::string mPowerOnData;
+
+    /**
+     *
+     */
+    std::vector<uint8_t> mDfName;
+
+    /**
+     *
+     */
+    std::vector<uint8_t> mStartupInfo;
+
+    /**
+     *
+     */
+    std::shared_ptr<DirectoryHeader> mDirectoryHeader;
+
+    /**
+     *
+     */
+    std::shared_ptr<SvLoadLogRecord> mSvLoadLogRecord;
+
+    /**
+     *
+     */
+    std::vector<std::shared_ptr<SvDebitLogRecord>> mSvDebitLogRecords;
+
+    /**
+     *
+     */
+    ElementaryFileIndex mIndex;
+};
+
+}
+}
+}
+}
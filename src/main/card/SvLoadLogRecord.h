@@ -15,6 +15,9 @@
 #include <cstdint>
 #include <vector>
 
+/* Calypsonet Terminal Calypso */
+#include "ByteView.h"
+
 namespace calypsonet {
 namespace terminal {
 namespace calypso {
@@ -35,6 +38,16 @@ public:
      */
     virtual const std::vector<uint8_t>& getRawData() const = 0;
 
+    /**
+     * Gets a view on the raw data of the SV load log record, without copy.
+     *
+     * <p>The view is only valid as long as this record is alive.
+     *
+     * @return A byte view.
+     * @since 1.5.0
+     */
+    virtual const ByteView getRawDataView() const = 0;
+
     /**
      * Gets the load date as an array of bytes
      *
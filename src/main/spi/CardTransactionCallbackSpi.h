@@ -0,0 +1,74 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <exception>
+
+namespace calypsonet {
+namespace terminal {
+namespace calypso {
+namespace transaction {
+
+class CardTransactionManager;
+
+}
+
+namespace spi {
+
+using namespace calypsonet::terminal::calypso::transaction;
+
+/**
+ * Service to be implemented in order to be notified of the completion of an asynchronous card
+ * transaction step.
+ *
+ * <p>The methods are invoked from the task run by the TransactionExecutorSpi provided to the
+ * asynchronous "process" method, so they should return quickly.
+ *
+ * @since 1.5.0
+ */
+class CardTransactionCallbackSpi {
+public:
+    /**
+     *
+     */
+    virtual ~CardTransactionCallbackSpi() = default;
+
+    /**
+     * Invoked when the asynchronous processing has completed successfully.
+     *
+     * <p>The CalypsoCard image is up to date when this method is invoked.
+     *
+     * @param transactionManager The card transaction manager that performed the processing.
+     * @since 1.5.0
+     */
+    virtual void onTransactionSuccess(CardTransactionManager& transactionManager) = 0;
+
+    /**
+     * Invoked when the asynchronous processing has failed.
+     *
+     * <p>The provided error is the exception that the synchronous version of the "process" method
+     * would have thrown (e.g. CardIOException, SamIOException, ...). It may be rethrown with
+     * std::rethrow_exception to be analyzed.
+     *
+     * @param transactionManager The card transaction manager that performed the processing.
+     * @param error The exception that interrupted the processing.
+     * @since 1.5.0
+     */
+    virtual void onTransactionFailure(CardTransactionManager& transactionManager,
+                                      const std::exception_ptr error) = 0;
+};
+
+}
+}
+}
+}
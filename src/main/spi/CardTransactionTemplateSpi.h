@@ -0,0 +1,80 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+/* Calypsonet Terminal Calypso */
+#include "WriteAccessLevel.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace calypso {
+namespace transaction {
+
+class CardTransactionManager;
+
+}
+
+namespace spi {
+
+using namespace calypsonet::terminal::calypso;
+using namespace calypsonet::terminal::calypso::transaction;
+
+/**
+ * Service to be implemented in order to describe the secure session to be performed on each card
+ * of a batch (see CardBatchTransactionManager).
+ *
+ * <p>The methods are invoked once per card with the card transaction manager dedicated to this
+ * card. They must only invoke "prepare" methods: the "process" methods are invoked by the batch
+ * manager itself. Card specific data (e.g. personalization data depending on the application
+ * serial number) can be obtained from CardTransactionManager::getCalypsoCard().
+ *
+ * @since 1.5.0
+ */
+class CardTransactionTemplateSpi {
+public:
+    /**
+     *
+     */
+    virtual ~CardTransactionTemplateSpi() = default;
+
+    /**
+     * Gets the write access level to use to open the secure session.
+     *
+     * @return A WriteAccessLevel enum entry.
+     * @since 1.5.0
+     */
+    virtual WriteAccessLevel getWriteAccessLevel() const = 0;
+
+    /**
+     * Prepares the commands to be executed with the opening of the secure session (typically the
+     * reading of the data needed to compute the updates).
+     *
+     * @param cardTransactionManager The card transaction manager of the current card.
+     * @since 1.5.0
+     */
+    virtual void prepareOpening(CardTransactionManager& cardTransactionManager) = 0;
+
+    /**
+     * Prepares the commands to be executed with the closing of the secure session (typically the
+     * updates). The data read at opening are available in the CalypsoCard image.
+     *
+     * @param cardTransactionManager The card transaction manager of the current card.
+     * @since 1.5.0
+     */
+    virtual void prepareClosing(CardTransactionManager& cardTransactionManager) = 0;
+};
+
+}
+}
+}
+}
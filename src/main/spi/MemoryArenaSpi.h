@@ -0,0 +1,66 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+
+namespace calypsonet {
+namespace terminal {
+namespace calypso {
+namespace spi {
+
+/**
+ * Service to be implemented in order to provide the memory in which the objects of a transaction
+ * (card image, files, headers, log records, ...) are allocated.
+ *
+ * <p>It is typically an arena released in one step at the end of each transaction, giving a
+ * predictable allocation time on targets with a fragmented heap (see MonotonicArena).
+ *
+ * <p>The arena is used by a single transaction at a time and doesn't need to be thread safe.
+ *
+ * @since 1.5.0
+ */
+class MemoryArenaSpi {
+public:
+    /**
+     *
+     */
+    virtual ~MemoryArenaSpi() = default;
+
+    /**
+     * Allocates a memory block.
+     *
+     * @param size The size of the block in bytes.
+     * @param alignment The required alignment of the block (a power of 2).
+     * @return A not null pointer.
+     * @throw std::bad_alloc If the memory cannot be allocated.
+     * @since 1.5.0
+     */
+    virtual void* allocate(const std::size_t size, const std::size_t alignment) = 0;
+
+    /**
+     * Releases a memory block previously allocated by this arena.
+     *
+     * <p>An arena releasing all its memory in one step may implement this method as a no-op.
+     *
+     * @param block The block to release.
+     * @param size The size of the block in bytes.
+     * @since 1.5.0
+     */
+    virtual void deallocate(void* block, const std::size_t size) = 0;
+};
+
+}
+}
+}
+}
@@ -0,0 +1,109 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <memory>
+
+/* Calypsonet Terminal Calypso */
+#include "CalypsoSam.h"
+
+/* Calypsonet Terminal Reader */
+#include "CardReader.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace calypso {
+namespace spi {
+
+using namespace calypsonet::terminal::calypso::sam;
+using namespace calypsonet::terminal::reader;
+
+/**
+ * Service to be implemented in order to share a set of SAMs between the transactions, each
+ * transaction using a SAM allocated from the pool for the duration of a secure session (or of a
+ * SAM transaction).
+ *
+ * <p>The pool is provided to the transactions with
+ * calypsonet::terminal::calypso::transaction::CommonSecuritySetting::setControlSamResourcePool().
+ * Its methods may be invoked concurrently by several transaction managers.
+ *
+ * @since 1.5.0
+ */
+class SamResourcePoolSpi {
+public:
+    /**
+     * A SAM of the pool and the reader through which it is accessible.
+     *
+     * @since 1.5.0
+     */
+    class SamResource {
+    public:
+        /**
+         *
+         */
+        virtual ~SamResource() = default;
+
+        /**
+         * Gets the reader of the SAM.
+         *
+         * @return A not null reference.
+         * @since 1.5.0
+         */
+        virtual const std::shared_ptr<CardReader> getSamReader() const = 0;
+
+        /**
+         * Gets the SAM.
+         *
+         * @return A not null reference.
+         * @since 1.5.0
+         */
+        virtual const std::shared_ptr<CalypsoSam> getCalypsoSam() const = 0;
+    };
+
+    /**
+     *
+     */
+    virtual ~SamResourcePoolSpi() = default;
+
+    /**
+     * Allocates a SAM for a new secure session or SAM transaction.
+     *
+     * <p>A SAM holds the state of a single session digest: a SAM must not be allocated again
+     * before being released.
+     *
+     * @return Null if no SAM is currently available (i.e. all the SAMs are allocated or out of
+     *         order).
+     * @since 1.5.0
+     */
+    virtual const std::shared_ptr<SamResource> allocateSamResource() = 0;
+
+    /**
+     * Releases a SAM previously allocated by allocateSamResource().
+     *
+     * @param samResource The SAM to release.
+     * @param busyTime The time spent communicating with the SAM during the allocation.
+     * @param failed True if the allocation ended with a communication error with the SAM (i.e. a
+     *        calypsonet::terminal::calypso::transaction::SamIOException), in which case the pool
+     *        should not hand out this SAM again for a while.
+     * @since 1.5.0
+     */
+    virtual void releaseSamResource(const std::shared_ptr<SamResource> samResource,
+                                    const std::chrono::microseconds busyTime,
+                                    const bool failed) = 0;
+};
+
+}
+}
+}
+}
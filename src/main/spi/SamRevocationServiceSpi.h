@@ -12,6 +12,8 @@
 
 #pragma once
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 
@@ -27,6 +29,72 @@ namespace spi {
  */
 class SamRevocationServiceSpi {
 public:
+    /**
+     * A SAM to check in a batch (see areSamsRevoked()).
+     *
+     * @since 1.5.0
+     */
+    struct RevocationQuery {
+        /**
+         * Value of counterValue when only the serial number has to be checked.
+         *
+         * @since 1.5.0
+         */
+        static const int NO_COUNTER = -1;
+
+        /**
+         * Creates a query on a complete serial number.
+         *
+         * @param serialNumber The complete SAM serial number.
+         * @param counterValue The SAM counter value, or NO_COUNTER.
+         * @since 1.5.0
+         */
+        RevocationQuery(const std::array<uint8_t, 4>& serialNumber, const int counterValue)
+        : serialNumber(serialNumber), isPartialSerialNumber(false), counterValue(counterValue) {}
+
+        /**
+         * Creates a query on a partial serial number.
+         *
+         * @param serialNumber The 3 LSBytes of the SAM serial number.
+         * @param counterValue The SAM counter value, or NO_COUNTER.
+         * @since 1.5.0
+         */
+        RevocationQuery(const std::array<uint8_t, 3>& serialNumber, const int counterValue)
+        : serialNumber({{0, serialNumber[0], serialNumber[1], serialNumber[2]}}),
+          isPartialSerialNumber(true),
+          counterValue(counterValue) {}
+
+        /**
+         * Creates an empty query (complete serial number 00000000h, no counter).
+         *
+         * @since 1.5.0
+         */
+        RevocationQuery()
+        : serialNumber({{0, 0, 0, 0}}), isPartialSerialNumber(false), counterValue(NO_COUNTER) {}
+
+        /**
+         * The SAM serial number; when partial, the 3 LSBytes are in the last 3 bytes and the
+         * first byte is ignored.
+         *
+         * @since 1.5.0
+         */
+        std::array<uint8_t, 4> serialNumber;
+
+        /**
+         * True if only the 3 LSBytes of the serial number are known.
+         *
+         * @since 1.5.0
+         */
+        bool isPartialSerialNumber;
+
+        /**
+         * The SAM counter value, or NO_COUNTER.
+         *
+         * @since 1.5.0
+         */
+        int counterValue;
+    };
+
     /**
      * Checks if the SAM with the provided serial number is revoked or not.
      *
@@ -51,6 +119,85 @@ public:
      */
     virtual bool isSamRevoked(const std::vector<uint8_t>& serialNumber, const int counterValue)
         const = 0;
+
+    /**
+     * Checks if the SAM with the provided complete serial number, and optionally the associated
+     * counter value, is revoked or not.
+     *
+     * <p>Same as isSamRevoked(const std::vector<uint8_t>&) and isSamRevoked(const
+     * std::vector<uint8_t>&, const int) but without building a vector. The default implementation
+     * copies the serial number into a vector and forwards the call to one of them; implementations
+     * able to answer without allocation should override it.
+     *
+     * @param serialNumber The complete SAM serial number to check.
+     * @param counterValue The SAM counter value, or RevocationQuery::NO_COUNTER to check the
+     *        serial number only.
+     * @return True if the SAM is revoked, otherwise false.
+     * @since 1.5.0
+     */
+    virtual bool isSamRevokedBySerial4(const std::array<uint8_t, 4>& serialNumber,
+                                       const int counterValue) const
+    {
+        const std::vector<uint8_t> serialNumberVector(serialNumber.begin(), serialNumber.end());
+
+        return counterValue == RevocationQuery::NO_COUNTER
+                   ? isSamRevoked(serialNumberVector)
+                   : isSamRevoked(serialNumberVector, counterValue);
+    }
+
+    /**
+     * Checks if the SAM with the provided partial serial number (3 LSBytes), and optionally the
+     * associated counter value, is revoked or not.
+     *
+     * <p>See isSamRevokedBySerial4().
+     *
+     * @param serialNumber The partial SAM serial number to check.
+     * @param counterValue The SAM counter value, or RevocationQuery::NO_COUNTER to check the
+     *        serial number only.
+     * @return True if the SAM is revoked, otherwise false.
+     * @since 1.5.0
+     */
+    virtual bool isSamRevokedBySerial3(const std::array<uint8_t, 3>& serialNumber,
+                                       const int counterValue) const
+    {
+        const std::vector<uint8_t> serialNumberVector(serialNumber.begin(), serialNumber.end());
+
+        return counterValue == RevocationQuery::NO_COUNTER
+                   ? isSamRevoked(serialNumberVector)
+                   : isSamRevoked(serialNumberVector, counterValue);
+    }
+
+    /**
+     * Checks the revocation status of a batch of SAMs.
+     *
+     * <p>The result of the query at index i is stored at index i of the output, which is resized
+     * to the number of queries. A batch typically contains many signatures of few SAMs:
+     * implementations backed by a database or a remote list should answer all the queries in one
+     * pass. The default implementation checks each query with the corresponding single SAM
+     * method.
+     *
+     * @param queries The SAMs to check.
+     * @param revoked The output receiving true for each revoked SAM, otherwise false.
+     * @since 1.5.0
+     */
+    virtual void areSamsRevoked(const std::vector<RevocationQuery>& queries,
+                                std::vector<bool>& revoked) const
+    {
+        revoked.assign(queries.size(), false);
+
+        for (std::size_t i = 0; i < queries.size(); i++) {
+            const RevocationQuery& query = queries[i];
+
+            if (query.isPartialSerialNumber) {
+                const std::array<uint8_t, 3> partial = {{query.serialNumber[1],
+                                                         query.serialNumber[2],
+                                                         query.serialNumber[3]}};
+                revoked[i] = isSamRevokedBySerial3(partial, query.counterValue);
+            } else {
+                revoked[i] = isSamRevokedBySerial4(query.serialNumber, query.counterValue);
+            }
+        }
+    }
 };
 
 }
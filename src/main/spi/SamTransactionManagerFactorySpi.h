@@ -0,0 +1,67 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <memory>
+
+/* Calypsonet Terminal Calypso */
+#include "SamResourcePoolSpi.h"
+#include "SamRevocationServiceSpi.h"
+#include "SamTransactionManager.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace calypso {
+namespace spi {
+
+using namespace calypsonet::terminal::calypso::transaction;
+
+/**
+ * Service to be implemented in order to create the SAM transaction managers used by the
+ * components driving several SAMs on their own (see
+ * calypsonet::terminal::calypso::transaction::ParallelSignatureVerifier).
+ *
+ * <p>It is typically implemented on top of the factory of the Calypso extension, the security
+ * settings of the created manager being built with the provided revocation service.
+ *
+ * @since 1.5.0
+ */
+class SamTransactionManagerFactorySpi {
+public:
+    /**
+     *
+     */
+    virtual ~SamTransactionManagerFactorySpi() = default;
+
+    /**
+     * Creates a SAM transaction manager for a SAM of a pool.
+     *
+     * <p>The method may be invoked concurrently by several threads. The created manager is only
+     * used by the thread which requested it.
+     *
+     * @param samResource The SAM on which the transaction is performed.
+     * @param samRevocationService The revocation service to register in the security settings of
+     *        the transaction (see CommonSecuritySetting::setSamRevocationService()), null if the
+     *        revocation status of the SAMs does not have to be checked.
+     * @return A not null reference.
+     * @since 1.5.0
+     */
+    virtual std::shared_ptr<SamTransactionManager> createSamTransactionManager(
+        const std::shared_ptr<SamResourcePoolSpi::SamResource> samResource,
+        const std::shared_ptr<SamRevocationServiceSpi> samRevocationService) = 0;
+};
+
+}
+}
+}
+}
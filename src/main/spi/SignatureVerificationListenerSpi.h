@@ -0,0 +1,67 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <exception>
+
+namespace calypsonet {
+namespace terminal {
+namespace calypso {
+namespace spi {
+
+/**
+ * Service to be implemented in order to receive the results of a parallel signature verification
+ * as soon as they are available (see
+ * calypsonet::terminal::calypso::transaction::ParallelSignatureVerifier).
+ *
+ * <p>The methods are invoked concurrently from the worker threads of the verifier, in no
+ * particular order, exactly once for each verification request. They must therefore be
+ * thread-safe and should return quickly.
+ *
+ * @since 1.5.0
+ */
+class SignatureVerificationListenerSpi {
+public:
+    /**
+     *
+     */
+    virtual ~SignatureVerificationListenerSpi() = default;
+
+    /**
+     * Invoked when a signature has been verified.
+     *
+     * @param index The index of the request in the list provided to the verifier.
+     * @param isSignatureValid True if the signature is valid.
+     * @since 1.5.0
+     */
+    virtual void onSignatureVerified(const int index, const bool isSignatureValid) = 0;
+
+    /**
+     * Invoked when a signature could not be verified.
+     *
+     * <p>The provided error is the exception that the sequential verification would have thrown
+     * (e.g. SamRevokedException, SamIOException, IllegalArgumentException, ...). It may be rethrown
+     * with std::rethrow_exception to be analyzed.
+     *
+     * @param index The index of the request in the list provided to the verifier.
+     * @param error The exception that prevented the verification.
+     * @since 1.5.0
+     */
+    virtual void onSignatureVerificationFailure(const int index, const std::exception_ptr error)
+        = 0;
+};
+
+}
+}
+}
+}
@@ -0,0 +1,50 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <functional>
+
+namespace calypsonet {
+namespace terminal {
+namespace calypso {
+namespace spi {
+
+/**
+ * Service to be implemented in order to run the asynchronous processing of a transaction on an
+ * execution resource chosen by the application (e.g. a thread pool shared by several readers).
+ *
+ * @since 1.5.0
+ */
+class TransactionExecutorSpi {
+public:
+    /**
+     *
+     */
+    virtual ~TransactionExecutorSpi() = default;
+
+    /**
+     * Executes the provided task.
+     *
+     * <p>The task may be run synchronously in the caller's thread or later in any other thread, but
+     * it must be run exactly once.
+     *
+     * @param task The task to execute.
+     * @since 1.5.0
+     */
+    virtual void execute(const std::function<void()>& task) = 0;
+};
+
+}
+}
+}
+}
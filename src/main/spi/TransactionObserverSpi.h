@@ -0,0 +1,65 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+/* Calypsonet Terminal Calypso */
+#include "ApduExchangeEvent.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace calypso {
+namespace spi {
+
+using namespace calypsonet::terminal::calypso::transaction;
+
+/**
+ * Service to be implemented in order to observe the APDUs exchanged by a transaction manager
+ * with the card and the SAM (e.g. for latency measurement).
+ *
+ * <p>The observer is notified synchronously after each exchange, from the thread performing the
+ * exchange: its processing time adds up to the transaction time and should therefore be kept
+ * minimal.
+ *
+ * <p>By default, all the exchanges are performed by the thread processing the transaction. When
+ * the SAM digest pipelining is enabled (see
+ * calypsonet::terminal::calypso::transaction::CardSecuritySetting::enableSamDigestPipelining()),
+ * the queued SAM exchanges are performed, and therefore notified, by a thread of the provided
+ * executor, concurrently with the card exchanges notified by the thread processing the
+ * transaction. The exchanges of each target are notified in their order of execution, but the
+ * relative order of the card and SAM notifications is then not defined.
+ *
+ * <p>Consequently, an observer used with the pipelining, or shared by several transaction
+ * managers, must be thread-safe.
+ *
+ * @since 1.5.0
+ */
+class TransactionObserverSpi {
+public:
+    /**
+     *
+     */
+    virtual ~TransactionObserverSpi() = default;
+
+    /**
+     * Invoked after each APDU exchange, including failed ones.
+     *
+     * @param event The description of the exchange, only valid during the invocation.
+     * @since 1.5.0
+     */
+    virtual void onApduExchanged(const ApduExchangeEvent& event) = 0;
+};
+
+}
+}
+}
+}
@@ -0,0 +1,236 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace calypsonet {
+namespace terminal {
+namespace calypso {
+namespace transaction {
+
+/**
+ * Description of an APDU exchanged with a card or a SAM during a transaction, notified to the
+ * TransactionObserverSpi.
+ *
+ * <p>The object is only valid during the notification: the observer must copy the data it wants
+ * to keep.
+ *
+ * @since 1.5.0
+ */
+class ApduExchangeEvent {
+public:
+    /**
+     * The targets of the APDUs.
+     *
+     * @since 1.5.0
+     */
+    enum class Target {
+        /**
+         * The Calypso card.
+         *
+         * @since 1.5.0
+         */
+        CARD,
+
+        /**
+         * The Calypso SAM.
+         *
+         * @since 1.5.0
+         */
+        SAM
+    };
+
+    /**
+     * The transaction phases producing the APDUs.
+     *
+     * @since 1.5.0
+     */
+    enum class Phase {
+        /**
+         * CardTransactionManager::processOpening(WriteAccessLevel).
+         *
+         * @since 1.5.0
+         */
+        OPENING,
+
+        /**
+         * CommonTransactionManager::processCommands() or
+         * CardTransactionManager::processCardCommands().
+         *
+         * @since 1.5.0
+         */
+        COMMANDS,
+
+        /**
+         * CardTransactionManager::processClosing().
+         *
+         * @since 1.5.0
+         */
+        CLOSING,
+
+        /**
+         * CardTransactionManager::processCancel().
+         *
+         * @since 1.5.0
+         */
+        CANCEL,
+
+        /**
+         * CardTransactionManager::processVerifyPin(const std::vector<uint8_t>&) or
+         * CardTransactionManager::processChangePin(const std::vector<uint8_t>&).
+         *
+         * @since 1.5.0
+         */
+        PIN,
+
+        /**
+         * CardTransactionManager::processChangeKey(uint8_t, uint8_t, uint8_t, uint8_t,
+         * uint8_t).
+         *
+         * @since 1.5.0
+         */
+        CHANGE_KEY
+    };
+
+    /**
+     *
+     */
+    virtual ~ApduExchangeEvent() = default;
+
+    /**
+     * Gets the target of the APDU.
+     *
+     * @return A Target enum entry.
+     * @since 1.5.0
+     */
+    virtual Target getTarget() const = 0;
+
+    /**
+     * Gets the transaction phase which produced the APDU.
+     *
+     * <p>Note that Stored Value commands are produced by the phase during which they are processed
+     * and are identified by their command name.
+     *
+     * @return A Phase enum entry.
+     * @since 1.5.0
+     */
+    virtual Phase getPhase() const = 0;
+
+    /**
+     * Gets the name of the command (e.g. "READ_RECORDS", "SV_DEBIT", "DIGEST_UPDATE").
+     *
+     * @return A not empty string.
+     * @since 1.5.0
+     */
+    virtual const std::string& getCommandName() const = 0;
+
+    /**
+     * Gets the command APDU.
+     *
+     * @return A not empty byte array.
+     * @since 1.5.0
+     */
+    virtual const std::vector<uint8_t>& getApdu() const = 0;
+
+    /**
+     * Gets the response APDU, including the status word.
+     *
+     * @return An empty array if no response has been received.
+     * @since 1.5.0
+     */
+    virtual const std::vector<uint8_t>& getResponse() const = 0;
+
+    /**
+     * Gets the status word of the response.
+     *
+     * @return The status word (e.g. 9000h), 0 if no response has been received.
+     * @since 1.5.0
+     */
+    virtual int getStatusWord() const = 0;
+
+    /**
+     * Gets the time at which the APDU was handed over to the reader.
+     *
+     * <p>APDUs transmitted in a single card request share the time of the request.
+     *
+     * @return A time point of the steady clock.
+     * @since 1.5.0
+     */
+    virtual std::chrono::steady_clock::time_point getRequestTime() const = 0;
+
+    /**
+     * Gets the time at which the response was received from the reader.
+     *
+     * <p>APDUs transmitted in a single card request share the time of the response.
+     *
+     * @return A time point of the steady clock.
+     * @since 1.5.0
+     */
+    virtual std::chrono::steady_clock::time_point getResponseTime() const = 0;
+};
+
+inline std::ostream& operator<<(std::ostream& os, const ApduExchangeEvent::Target& t)
+{
+    switch (t) {
+    case ApduExchangeEvent::Target::CARD:
+        os << "CARD";
+        break;
+    case ApduExchangeEvent::Target::SAM:
+        os << "SAM";
+        break;
+    default:
+        os << "UNKNOWN";
+        break;
+    }
+
+    return os;
+}
+
+inline std::ostream& operator<<(std::ostream& os, const ApduExchangeEvent::Phase& p)
+{
+    switch (p) {
+    case ApduExchangeEvent::Phase::OPENING:
+        os << "OPENING";
+        break;
+    case ApduExchangeEvent::Phase::COMMANDS:
+        os << "COMMANDS";
+        break;
+    case ApduExchangeEvent::Phase::CLOSING:
+        os << "CLOSING";
+        break;
+    case ApduExchangeEvent::Phase::CANCEL:
+        os << "CANCEL";
+        break;
+    case ApduExchangeEvent::Phase::PIN:
+        os << "PIN";
+        break;
+    case ApduExchangeEvent::Phase::CHANGE_KEY:
+        os << "CHANGE_KEY";
+        break;
+    default:
+        os << "UNKNOWN";
+        break;
+    }
+
+    return os;
+}
+
+}
+}
+}
+}
@@ -0,0 +1,303 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/* Calypsonet Terminal Calypso */
+#include "ApduExchangeEvent.h"
+#include "ByteView.h"
+
+/* Keyple Core Util */
+#include "IllegalArgumentException.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace calypso {
+namespace transaction {
+
+using namespace calypsonet::terminal::calypso;
+using namespace keyple::core::util::cpp::exception;
+
+/**
+ * Sequential reader of an APDU trace, as produced by ApduTraceRecorder.
+ *
+ * <p>A trace is a single buffer which can be stored as is and later read in place, for example
+ * from a memory-mapped file. It is made of a header (magic "CATR" and format version, HEADER_SIZE
+ * bytes) followed by the exchanges in the order they occurred, card and SAM exchanges being
+ * interleaved. Each exchange is encoded as:
+ *
+ * <ul>
+ *   <li>A descriptor byte: the target (TARGET_SAM flag), the phase (PHASE_SHIFT and PHASE_MASK)
+ *       and the NEW_COMMAND_NAME flag.
+ *   <li>The command name: the index of a name already defined by a previous exchange, or, when
+ *       NEW_COMMAND_NAME is set, the length and the bytes of a name which receives the next index.
+ *   <li>The delay between the end of the previous exchange and the request, and the latency of
+ *       the reader (time between the request and the response), in microseconds.
+ *   <li>The length and the bytes of the command APDU, then of the response APDU.
+ * </ul>
+ *
+ * <p>All the integers (indexes, lengths and durations) are unsigned LEB128 varints.
+ *
+ * <p>The reader does not own the buffer, which must remain valid and unchanged as long as the
+ * reader and the exchanges it returned are used. It can be copied to remember a position.
+ *
+ * @since 1.5.0
+ */
+class ApduTraceReader final {
+public:
+    /**
+     * Version of the format.
+     *
+     * @since 1.5.0
+     */
+    static const uint8_t FORMAT_VERSION = 1;
+
+    /**
+     * Magic number ("CATR").
+     *
+     * @since 1.5.0
+     */
+    static const uint32_t MAGIC = 0x52544143;
+
+    /**
+     * Size of the header: magic (4 bytes), version (1 byte), reserved (3 bytes).
+     *
+     * @since 1.5.0
+     */
+    static const std::size_t HEADER_SIZE = 8;
+
+    /**
+     * Bits of the descriptor byte of an exchange.
+     *
+     * @since 1.5.0
+     */
+    enum Descriptor {
+        TARGET_SAM = 0x01,
+        PHASE_SHIFT = 1,
+        PHASE_MASK = 0x0E,
+        NEW_COMMAND_NAME = 0x10
+    };
+
+    /**
+     * An exchange of the trace, whose data are views on the trace buffer.
+     *
+     * @since 1.5.0
+     */
+    struct Exchange {
+        /**
+         * The target of the APDU.
+         *
+         * @since 1.5.0
+         */
+        ApduExchangeEvent::Target target;
+
+        /**
+         * The transaction phase which produced the APDU.
+         *
+         * @since 1.5.0
+         */
+        ApduExchangeEvent::Phase phase;
+
+        /**
+         * The name of the command.
+         *
+         * @since 1.5.0
+         */
+        ByteView commandName;
+
+        /**
+         * The command APDU.
+         *
+         * @since 1.5.0
+         */
+        ByteView apdu;
+
+        /**
+         * The response APDU, including the status word; empty if no response was received.
+         *
+         * @since 1.5.0
+         */
+        ByteView response;
+
+        /**
+         * The time elapsed between the end of the previous exchange and the request.
+         *
+         * @since 1.5.0
+         */
+        std::chrono::microseconds delay;
+
+        /**
+         * The time elapsed between the request and the response.
+         *
+         * @since 1.5.0
+         */
+        std::chrono::microseconds latency;
+    };
+
+    /**
+     * Opens a trace.
+     *
+     * @param trace The trace buffer.
+     * @throw IllegalArgumentException If the buffer does not start with a valid header of a
+     *        supported version.
+     * @since 1.5.0
+     */
+    explicit ApduTraceReader(const ByteView& trace)
+    : mTrace(trace), mPosition(HEADER_SIZE), mExchangesNumber(0)
+    {
+        if (trace.size() < HEADER_SIZE ||
+            (static_cast<uint32_t>(trace[0]) | static_cast<uint32_t>(trace[1]) << 8 |
+             static_cast<uint32_t>(trace[2]) << 16 | static_cast<uint32_t>(trace[3]) << 24) !=
+                MAGIC ||
+            trace[4] != FORMAT_VERSION) {
+            throw IllegalArgumentException("Invalid APDU trace header.");
+        }
+    }
+
+    /**
+     * Reads the next exchange.
+     *
+     * @param exchange The exchange receiving the data.
+     * @return False if the end of the trace is reached, in which case the exchange is unchanged.
+     * @throw IllegalArgumentException If the exchange is truncated or malformed.
+     * @since 1.5.0
+     */
+    bool next(Exchange& exchange)
+    {
+        if (mPosition == mTrace.size()) {
+            return false;
+        }
+
+        const uint8_t descriptor = mTrace[mPosition++];
+        const int phase = (descriptor & PHASE_MASK) >> PHASE_SHIFT;
+        if (phase > static_cast<int>(ApduExchangeEvent::Phase::CHANGE_KEY)) {
+            throw IllegalArgumentException("Invalid APDU trace exchange phase.");
+        }
+
+        ByteView commandName;
+        if ((descriptor & NEW_COMMAND_NAME) != 0) {
+            commandName = readBytes();
+            mCommandNames.push_back(commandName);
+        } else {
+            const uint64_t index = readVarint();
+            if (index >= mCommandNames.size()) {
+                throw IllegalArgumentException("Invalid APDU trace command name index.");
+            }
+            commandName = mCommandNames[static_cast<std::size_t>(index)];
+        }
+
+        exchange.delay = std::chrono::microseconds(readVarint());
+        exchange.latency = std::chrono::microseconds(readVarint());
+        exchange.apdu = readBytes();
+        exchange.response = readBytes();
+        exchange.commandName = commandName;
+        exchange.target = (descriptor & TARGET_SAM) != 0 ? ApduExchangeEvent::Target::SAM :
+                                                           ApduExchangeEvent::Target::CARD;
+        exchange.phase = static_cast<ApduExchangeEvent::Phase>(phase);
+        mExchangesNumber++;
+
+        return true;
+    }
+
+    /**
+     * Goes back to the first exchange.
+     *
+     * @since 1.5.0
+     */
+    void rewind()
+    {
+        mPosition = HEADER_SIZE;
+        mCommandNames.clear();
+        mExchangesNumber = 0;
+    }
+
+    /**
+     * Gets the number of exchanges read since the opening or the last rewind().
+     *
+     * @return A positive or zero value.
+     * @since 1.5.0
+     */
+    long getExchangesNumber() const
+    {
+        return mExchangesNumber;
+    }
+
+private:
+    /**
+     *
+     */
+    uint64_t readVarint()
+    {
+        uint64_t value = 0;
+
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (mPosition == mTrace.size()) {
+                throw IllegalArgumentException("Truncated APDU trace exchange.");
+            }
+
+            const uint8_t b = mTrace[mPosition++];
+            value |= static_cast<uint64_t>(b & 0x7F) << shift;
+            if ((b & 0x80) == 0) {
+                return value;
+            }
+        }
+
+        throw IllegalArgumentException("Invalid APDU trace varint.");
+    }
+
+    /**
+     *
+     */
+    ByteView readBytes()
+    {
+        const uint64_t length = readVarint();
+        if (length > mTrace.size() - mPosition) {
+            throw IllegalArgumentException("Truncated APDU trace exchange.");
+        }
+
+        const ByteView bytes = mTrace.subView(mPosition, static_cast<std::size_t>(length));
+        mPosition += static_cast<std::size_t>(length);
+
+        return bytes;
+    }
+
+    /**
+     *
+     */
+    ByteView mTrace;
+
+    /**
+     *
+     */
+    std::size_t mPosition;
+
+    /**
+     *
+     */
+    std::vector<ByteView> mCommandNames;
+
+    /**
+     *
+     */
+    long mExchangesNumber;
+};
+
+}
+}
+}
+}
@@ -0,0 +1,236 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/* Calypsonet Terminal Calypso */
+#include "ApduExchangeEvent.h"
+#include "ApduTraceReader.h"
+#include "TransactionObserverSpi.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace calypso {
+namespace transaction {
+
+using namespace calypsonet::terminal::calypso::spi;
+
+/**
+ * TransactionObserverSpi recording all the APDUs exchanged with the card and the SAM into an APDU
+ * trace (see ApduTraceReader for the format).
+ *
+ * <p>The same recorder should be set as the observer of the CardTransactionManager and of the
+ * SamTransactionManager of a transaction, so that the card and SAM exchanges are interleaved in
+ * the order they occurred. The trace is kept in memory and obtained with getTrace(), typically to
+ * be written as is to a file at the end of the transaction; it can then be replayed with a
+ * ReplayCardReader per target.
+ *
+ * <p>Recording an exchange costs a copy of the APDUs and, the first time a command name is seen,
+ * of its name: the trace buffer grows geometrically and can be reused with clear().
+ *
+ * <p>This class is thread-safe.
+ *
+ * @since 1.5.0
+ */
+class ApduTraceRecorder final : public TransactionObserverSpi {
+public:
+    /**
+     * Creates a recorder with an empty trace.
+     *
+     * @since 1.5.0
+     */
+    ApduTraceRecorder() : mFirstExchange(true)
+    {
+        writeHeader();
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    void onApduExchanged(const ApduExchangeEvent& event) override
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        uint8_t descriptor = static_cast<uint8_t>(static_cast<int>(event.getPhase())
+                                                  << ApduTraceReader::PHASE_SHIFT);
+        if (event.getTarget() == ApduExchangeEvent::Target::SAM) {
+            descriptor |= ApduTraceReader::TARGET_SAM;
+        }
+
+        const auto name = mCommandNames.find(event.getCommandName());
+        if (name == mCommandNames.end()) {
+            mCommandNames.insert({event.getCommandName(), mCommandNames.size()});
+            mTrace.push_back(descriptor | ApduTraceReader::NEW_COMMAND_NAME);
+            writeBytes(reinterpret_cast<const uint8_t*>(event.getCommandName().data()),
+                       event.getCommandName().size());
+        } else {
+            mTrace.push_back(descriptor);
+            writeVarint(name->second);
+        }
+
+        /* The exchanges of a single card request share their times */
+        const std::chrono::steady_clock::time_point previousResponseTime =
+            mFirstExchange ? event.getRequestTime() : mLastResponseTime;
+        writeVarint(toMicroseconds(event.getRequestTime() - previousResponseTime));
+        writeVarint(toMicroseconds(event.getResponseTime() - event.getRequestTime()));
+        mLastResponseTime = std::max(mLastResponseTime, event.getResponseTime());
+        mFirstExchange = false;
+
+        writeBytes(event.getApdu().data(), event.getApdu().size());
+        writeBytes(event.getResponse().data(), event.getResponse().size());
+    }
+
+    /**
+     * Gets a copy of the trace recorded so far.
+     *
+     * @return A not empty byte array, containing at least the header.
+     * @since 1.5.0
+     */
+    std::vector<uint8_t> getTrace() const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        return mTrace;
+    }
+
+    /**
+     * Moves the trace recorded so far into the provided buffer and starts a new trace.
+     *
+     * <p>Unlike getTrace(), no copy is made: the buffers are swapped, so that passing back the
+     * same buffer at each call lets the recorder reuse its memory.
+     *
+     * @param trace The buffer receiving the trace, whose previous content is discarded.
+     * @since 1.5.0
+     */
+    void takeTrace(std::vector<uint8_t>& trace)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mTrace.swap(trace);
+        reset();
+    }
+
+    /**
+     * Discards the trace recorded so far and starts a new trace, keeping the allocated memory.
+     *
+     * @since 1.5.0
+     */
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        reset();
+    }
+
+private:
+    /**
+     *
+     */
+    static uint64_t toMicroseconds(const std::chrono::steady_clock::duration duration)
+    {
+        const auto us = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+
+        return us < 0 ? 0 : static_cast<uint64_t>(us);
+    }
+
+    /**
+     *
+     */
+    void reset()
+    {
+        mTrace.clear();
+        mCommandNames.clear();
+        mFirstExchange = true;
+        mLastResponseTime = std::chrono::steady_clock::time_point();
+        writeHeader();
+    }
+
+    /**
+     *
+     */
+    void writeHeader()
+    {
+        const uint32_t magic = ApduTraceReader::MAGIC;
+        const uint8_t version = ApduTraceReader::FORMAT_VERSION;
+
+        mTrace.push_back(static_cast<uint8_t>(magic));
+        mTrace.push_back(static_cast<uint8_t>(magic >> 8));
+        mTrace.push_back(static_cast<uint8_t>(magic >> 16));
+        mTrace.push_back(static_cast<uint8_t>(magic >> 24));
+        mTrace.push_back(version);
+        mTrace.resize(ApduTraceReader::HEADER_SIZE, 0);
+    }
+
+    /**
+     *
+     */
+    void writeVarint(uint64_t value)
+    {
+        while (value >= 0x80) {
+            mTrace.push_back(static_cast<uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+
+        mTrace.push_back(static_cast<uint8_t>(value));
+    }
+
+    /**
+     *
+     */
+    void writeBytes(const uint8_t* const data, const std::size_t length)
+    {
+        writeVarint(length);
+        mTrace.insert(mTrace.end(), data, data + length);
+    }
+
+    /**
+     *
+     */
+    mutable std::mutex mMutex;
+
+    /**
+     *
+     */
+    std::vector<uint8_t> mTrace;
+
+    /**
+     *
+     */
+    std::unordered_map<std::string, std::size_t> mCommandNames;
+
+    /**
+     *
+     */
+    bool mFirstExchange;
+
+    /**
+     *
+     */
+    std::chrono::steady_clock::time_point mLastResponseTime;
+};
+
+}
+}
+}
+}
@@ -0,0 +1,452 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/* Calypsonet Terminal Calypso */
+#include "SamRevocationServiceSpi.h"
+
+/* Keyple Core Util */
+#include "IllegalArgumentException.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace calypso {
+namespace transaction {
+
+using namespace calypsonet::terminal::calypso::spi;
+using namespace keyple::core::util::cpp::exception;
+
+/**
+ * SamRevocationServiceSpi remembering the answers of a slower revocation service, for example a
+ * service querying a back office database.
+ *
+ * <p>An answer is reused until its time to live expires or until invalidate() is invoked, e.g.
+ * when the revocation list is known to have changed. The serial-only and the serial and counter
+ * checks, on complete or partial serial numbers, are remembered separately.
+ *
+ * <p>The answers are kept in a fixed-size table in which each check has a single possible slot,
+ * a newer answer replacing the previous one of the slot. The reads never block: a slot being
+ * updated by another thread is simply considered as empty. The checks which cannot be cached
+ * (serial number neither 3 nor 4 bytes long, counter value out of range) are always forwarded.
+ *
+ * <p>This class is thread-safe.
+ *
+ * @since 1.5.0
+ */
+class CachingSamRevocationService final : public SamRevocationServiceSpi {
+public:
+    /**
+     * Creates a cache.
+     *
+     * @param samRevocationService The revocation service whose answers are cached.
+     * @param capacity The number of slots of the table (should be {@code >=} 1), rounded up to
+     *        a power of 2.
+     * @param timeToLive The duration during which an answer is reused, limited to about 34 years
+     *        (2^40 - 1 ms).
+     * @throw IllegalArgumentException If the service is null or if one of the other arguments is
+     *        out of range.
+     * @since 1.5.0
+     */
+    CachingSamRevocationService(
+        const std::shared_ptr<const SamRevocationServiceSpi> samRevocationService,
+        const int capacity,
+        const std::chrono::milliseconds timeToLive)
+    : mSamRevocationService(samRevocationService),
+      mTimeToLive(static_cast<uint64_t>(timeToLive.count()) < MAX_EXPIRY_TIME ?
+                      timeToLive.count() : MAX_EXPIRY_TIME),
+      mStart(std::chrono::steady_clock::now()),
+      mGeneration(0),
+      mHitsNumber(0),
+      mMissesNumber(0)
+    {
+        if (samRevocationService == nullptr || capacity < 1 || capacity > MAX_CAPACITY ||
+            timeToLive.count() < 0) {
+            throw IllegalArgumentException("Invalid SAM revocation cache parameters.");
+        }
+
+        std::size_t size = 1;
+        while (size < static_cast<std::size_t>(capacity)) {
+            size <<= 1;
+        }
+
+        mMask = size - 1;
+        mSlots.reset(new Slot[size]);
+        for (std::size_t i = 0; i < size; i++) {
+            mSlots[i].sequence.store(0);
+            mSlots[i].key.store(0);
+            mSlots[i].value.store(0);
+        }
+    }
+
+    /**
+     * Forgets all the remembered answers.
+     *
+     * <p>The checks in progress at the time of the invalidation may still store their answer,
+     * which is marked with the generation read before querying the revocation service and
+     * therefore never reused.
+     *
+     * @since 1.5.0
+     */
+    void invalidate()
+    {
+        mGeneration.fetch_add(1);
+    }
+
+    /**
+     * Gets the number of checks answered from the cache.
+     *
+     * @return A positive or zero value.
+     * @since 1.5.0
+     */
+    long getHitsNumber() const
+    {
+        return mHitsNumber.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Gets the number of checks forwarded to the revocation service.
+     *
+     * @return A positive or zero value.
+     * @since 1.5.0
+     */
+    long getMissesNumber() const
+    {
+        return mMissesNumber.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    bool isSamRevoked(const std::vector<uint8_t>& serialNumber) const override
+    {
+        const uint64_t key = makeKey(serialNumber.data(), serialNumber.size(), NO_COUNTER);
+        bool isRevoked = false;
+        if (!get(key, isRevoked)) {
+            const uint32_t generation = mGeneration.load();
+            isRevoked = mSamRevocationService->isSamRevoked(serialNumber);
+            put(key, isRevoked, generation);
+        }
+
+        return isRevoked;
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    bool isSamRevoked(const std::vector<uint8_t>& serialNumber, const int counterValue)
+        const override
+    {
+        const uint64_t key = makeKey(serialNumber.data(), serialNumber.size(), counterValue);
+        bool isRevoked = false;
+        if (!get(key, isRevoked)) {
+            const uint32_t generation = mGeneration.load();
+            isRevoked = mSamRevocationService->isSamRevoked(serialNumber, counterValue);
+            put(key, isRevoked, generation);
+        }
+
+        return isRevoked;
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    bool isSamRevokedBySerial4(const std::array<uint8_t, 4>& serialNumber,
+                               const int counterValue) const override
+    {
+        const uint64_t key = makeKey(serialNumber.data(), 4, counterValue);
+        bool isRevoked = false;
+        if (!get(key, isRevoked)) {
+            const uint32_t generation = mGeneration.load();
+            isRevoked = mSamRevocationService->isSamRevokedBySerial4(serialNumber, counterValue);
+            put(key, isRevoked, generation);
+        }
+
+        return isRevoked;
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    bool isSamRevokedBySerial3(const std::array<uint8_t, 3>& serialNumber,
+                               const int counterValue) const override
+    {
+        const uint64_t key = makeKey(serialNumber.data(), 3, counterValue);
+        bool isRevoked = false;
+        if (!get(key, isRevoked)) {
+            const uint32_t generation = mGeneration.load();
+            isRevoked = mSamRevocationService->isSamRevokedBySerial3(serialNumber, counterValue);
+            put(key, isRevoked, generation);
+        }
+
+        return isRevoked;
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * <p>The queries not answered from the cache are forwarded in a single batch.
+     *
+     * @since 1.5.0
+     */
+    void areSamsRevoked(const std::vector<RevocationQuery>& queries,
+                        std::vector<bool>& revoked) const override
+    {
+        revoked.assign(queries.size(), false);
+
+        std::vector<RevocationQuery> missedQueries;
+        std::vector<std::size_t> missedIndexes;
+
+        for (std::size_t i = 0; i < queries.size(); i++) {
+            const RevocationQuery& query = queries[i];
+            bool isRevoked = false;
+            if (get(makeKey(query), isRevoked)) {
+                revoked[i] = isRevoked;
+            } else {
+                missedQueries.push_back(query);
+                missedIndexes.push_back(i);
+            }
+        }
+
+        if (missedQueries.empty()) {
+            return;
+        }
+
+        const uint32_t generation = mGeneration.load();
+        std::vector<bool> missedRevoked;
+        mSamRevocationService->areSamsRevoked(missedQueries, missedRevoked);
+
+        for (std::size_t i = 0; i < missedQueries.size(); i++) {
+            revoked[missedIndexes[i]] = missedRevoked[i];
+            put(makeKey(missedQueries[i]), missedRevoked[i], generation);
+        }
+    }
+
+private:
+    /**
+     * A remembered answer, protected by a sequence number which is odd while the slot is being
+     * written.
+     */
+    struct Slot {
+        std::atomic<uint32_t> sequence;
+        std::atomic<uint64_t> key;
+        std::atomic<uint64_t> value;
+    };
+
+    /**
+     *
+     */
+    static const int MAX_CAPACITY = 1 << 24;
+
+    /**
+     *
+     */
+    static const int NO_COUNTER = RevocationQuery::NO_COUNTER;
+
+    /**
+     *
+     */
+    static const int MAX_COUNTER = 0xFFFFFF;
+
+    /**
+     *
+     */
+    static const uint64_t GENERATION_MASK = 0x7FFFFF;
+
+    /**
+     * Largest expiry time fitting in the 40 bits of a slot value (about 34 years).
+     */
+    static const uint64_t MAX_EXPIRY_TIME = (static_cast<uint64_t>(1) << 40) - 1;
+
+    /**
+     * Packs a check in a not null key: valid flag (bit 63), partial serial number flag (bit 62),
+     * counter flag (bit 61), serial number (bits 24 to 55) and counter value (bits 0 to 23).
+     *
+     * @return 0 if the check cannot be cached.
+     */
+    static uint64_t makeKey(const uint8_t* const serialNumber,
+                            const std::size_t length,
+                            const int counterValue)
+    {
+        if ((length != 3 && length != 4) || counterValue < NO_COUNTER ||
+            counterValue > MAX_COUNTER) {
+            return 0;
+        }
+
+        uint64_t serial = 0;
+        for (std::size_t i = 0; i < length; i++) {
+            serial = (serial << 8) | serialNumber[i];
+        }
+
+        return (static_cast<uint64_t>(1) << 63) |
+               (static_cast<uint64_t>(length == 3) << 62) |
+               (static_cast<uint64_t>(counterValue != NO_COUNTER) << 61) |
+               (serial << 24) |
+               static_cast<uint64_t>(counterValue & MAX_COUNTER);
+    }
+
+    /**
+     *
+     */
+    static uint64_t makeKey(const RevocationQuery& query)
+    {
+        return query.isPartialSerialNumber ?
+                   makeKey(query.serialNumber.data() + 1, 3, query.counterValue) :
+                   makeKey(query.serialNumber.data(), 4, query.counterValue);
+    }
+
+    /**
+     *
+     */
+    Slot& getSlot(const uint64_t key) const
+    {
+        return mSlots[static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ULL) >> 32) & mMask];
+    }
+
+    /**
+     * Milliseconds elapsed since the creation of the cache.
+     */
+    uint64_t getTime() const
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                   std::chrono::steady_clock::now() - mStart).count());
+    }
+
+    /**
+     * Looks for a valid answer, updating the statistics.
+     *
+     * @return False if no answer is available.
+     */
+    bool get(const uint64_t key, bool& isRevoked) const
+    {
+        if (key != 0) {
+            const Slot& slot = getSlot(key);
+
+            const uint32_t sequence = slot.sequence.load(std::memory_order_acquire);
+            const uint64_t slotKey = slot.key.load(std::memory_order_relaxed);
+            const uint64_t value = slot.value.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            /* Value: answer (bit 0), generation (bits 1 to 23), expiry time (bits 24 to 63) */
+            if ((sequence & 1) == 0 &&
+                slot.sequence.load(std::memory_order_relaxed) == sequence &&
+                slotKey == key &&
+                ((value >> 1) & GENERATION_MASK) == (mGeneration.load() & GENERATION_MASK) &&
+                (value >> 24) > getTime()) {
+                mHitsNumber.fetch_add(1, std::memory_order_relaxed);
+                isRevoked = (value & 1) != 0;
+                return true;
+            }
+        }
+
+        mMissesNumber.fetch_add(1, std::memory_order_relaxed);
+
+        return false;
+    }
+
+    /**
+     * Remembers an answer, unless the slot is being written by another thread.
+     *
+     * @param generation The generation read before requesting the answer to the revocation
+     *        service, so that an answer obtained across an invalidation is never reused.
+     */
+    void put(const uint64_t key, const bool isRevoked, const uint32_t generation) const
+    {
+        if (key == 0) {
+            return;
+        }
+
+        uint64_t expiryTime = getTime() + mTimeToLive;
+        if (expiryTime > MAX_EXPIRY_TIME) {
+            expiryTime = MAX_EXPIRY_TIME;
+        }
+
+        const uint64_t value = (expiryTime << 24) |
+                               ((generation & GENERATION_MASK) << 1) |
+                               static_cast<uint64_t>(isRevoked);
+
+        Slot& slot = getSlot(key);
+        uint32_t sequence = slot.sequence.load(std::memory_order_relaxed);
+        if ((sequence & 1) != 0 ||
+            !slot.sequence.compare_exchange_strong(sequence, sequence + 1,
+                                                   std::memory_order_acquire)) {
+            return;
+        }
+
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.key.store(key, std::memory_order_relaxed);
+        slot.value.store(value, std::memory_order_relaxed);
+        slot.sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    /**
+     *
+     */
+    const std::shared_ptr<const SamRevocationServiceSpi> mSamRevocationService;
+
+    /**
+     *
+     */
+    const uint64_t mTimeToLive;
+
+    /**
+     *
+     */
+    const std::chrono::steady_clock::time_point mStart;
+
+    /**
+     *
+     */
+    std::size_t mMask;
+
+    /**
+     *
+     */
+    std::unique_ptr<Slot[]> mSlots;
+
+    /**
+     *
+     */
+    std::atomic<uint32_t> mGeneration;
+
+    /**
+     *
+     */
+    mutable std::atomic<long> mHitsNumber;
+
+    /**
+     *
+     */
+    mutable std::atomic<long> mMissesNumber;
+};
+
+}
+}
+}
+}
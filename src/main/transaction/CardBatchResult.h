@@ -0,0 +1,94 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <exception>
+#include <memory>
+
+/* Calypsonet Terminal Calypso */
+#include "CalypsoCard.h"
+
+/* Calypsonet Terminal Reader */
+#include "CardReader.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace calypso {
+namespace transaction {
+
+using namespace calypsonet::terminal::calypso::card;
+using namespace calypsonet::terminal::reader;
+
+/**
+ * Result of the processing of one card of a batch (see CardBatchTransactionManager).
+ *
+ * @since 1.5.0
+ */
+class CardBatchResult {
+public:
+    /**
+     *
+     */
+    virtual ~CardBatchResult() = default;
+
+    /**
+     * Gets the reader through which the card has been processed.
+     *
+     * @return A not null reference.
+     * @since 1.5.0
+     */
+    virtual const std::shared_ptr<CardReader> getCardReader() const = 0;
+
+    /**
+     * Gets the image of the processed card.
+     *
+     * @return A not null reference, updated with the data collected during the transaction.
+     * @since 1.5.0
+     */
+    virtual const std::shared_ptr<CalypsoCard> getCalypsoCard() const = 0;
+
+    /**
+     * Indicates if the secure session of the card has been successfully closed.
+     *
+     * @return True if the transaction succeeded.
+     * @since 1.5.0
+     */
+    virtual bool isSuccessful() const = 0;
+
+    /**
+     * Gets the error that interrupted the transaction.
+     *
+     * <p>It is the exception that would have been thrown by the corresponding CardTransactionManager
+     * "process" method (e.g. CardIOException, InvalidCardSignatureException, ...). It may be
+     * rethrown with std::rethrow_exception to be analyzed.
+     *
+     * @return Null if the transaction succeeded.
+     * @since 1.5.0
+     */
+    virtual const std::exception_ptr getError() const = 0;
+
+    /**
+     * Gets the time elapsed between the beginning of the opening and the end of the closing of the
+     * secure session of the card.
+     *
+     * @return A positive duration.
+     * @since 1.5.0
+     */
+    virtual std::chrono::microseconds getProcessingTime() const = 0;
+};
+
+}
+}
+}
+}
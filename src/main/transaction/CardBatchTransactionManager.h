@@ -0,0 +1,158 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+/* Calypsonet Terminal Calypso */
+#include "CalypsoCard.h"
+#include "CardBatchResult.h"
+#include "CardSecuritySetting.h"
+#include "CardTransactionTemplateSpi.h"
+
+/* Calypsonet Terminal Reader */
+#include "CardReader.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace calypso {
+namespace transaction {
+
+using namespace calypsonet::terminal::calypso::card;
+using namespace calypsonet::terminal::calypso::spi;
+using namespace calypsonet::terminal::reader;
+
+/**
+ * Service providing the high-level API to perform the same secure session on a batch of Calypso
+ * cards (e.g. for personalization or reloading runs).
+ *
+ * <p>The application registers the cards to process, each one with its reader, and describes the
+ * secure session to perform with a CardTransactionTemplateSpi. For each card, the batch manager
+ * then executes the sequence:
+ *
+ * <ul>
+ *   <li>CardTransactionTemplateSpi::prepareOpening(CardTransactionManager&)
+ *   <li>CardTransactionManager::processOpening(WriteAccessLevel)
+ *   <li>CardTransactionTemplateSpi::prepareClosing(CardTransactionManager&)
+ *   <li>CardTransactionManager::processClosing()
+ * </ul>
+ *
+ * <p>The cards are processed in their registration order, but the SAM operations not depending
+ * on the card responses (e.g. the selection of the diversifier and the retrieval of the terminal
+ * challenge for the card N+1) are pipelined with the exchanges of the card N, so that the SAM
+ * latency is hidden behind the card latency.
+ *
+ * <p>The failure of a card does not interrupt the batch: it is reported in the associated
+ * CardBatchResult and the next card is processed.
+ *
+ * <p>This API only defines the contract: the batch processing, including the pipelining, is
+ * implemented and tested by the Calypso extension. The readers of the simulation library
+ * (SimulatedCardReader, with a CalypsoCardSimulator or a CalypsoSamSimulator inserted) implement
+ * the ProxyReaderApi used by the extension and allow a batch to be run without any card or SAM.
+ *
+ * @since 1.5.0
+ */
+class CardBatchTransactionManager {
+public:
+    /**
+     *
+     */
+    virtual ~CardBatchTransactionManager() = default;
+
+    /**
+     * Gets the settings defining the security parameters of the transactions.
+     *
+     * @return A not null reference.
+     * @since 1.5.0
+     */
+    virtual const std::shared_ptr<CardSecuritySetting> getSecuritySetting() const = 0;
+
+    /**
+     * Registers a card to be processed by the next invocation of processBatch().
+     *
+     * @param cardReader The reader through which the card communicates.
+     * @param calypsoCard The initial card image, as provided by the selection process.
+     * @return The current instance.
+     * @throw IllegalArgumentException If one of the arguments is null or if the product type of the
+     *        card is CalypsoCard::ProductType::UNKNOWN.
+     * @since 1.5.0
+     */
+    virtual CardBatchTransactionManager& addCard(const std::shared_ptr<CardReader> cardReader,
+                                                 const std::shared_ptr<CalypsoCard> calypsoCard)
+        = 0;
+
+    /**
+     * Sets the description of the secure session to perform on each card.
+     *
+     * @param transactionTemplate The transaction template.
+     * @return The current instance.
+     * @throw IllegalArgumentException If the provided template is null.
+     * @since 1.5.0
+     */
+    virtual CardBatchTransactionManager& setTransactionTemplate(
+        const std::shared_ptr<CardTransactionTemplateSpi> transactionTemplate) = 0;
+
+    /**
+     * Processes all the registered cards, then clears the list of registered cards.
+     *
+     * <p>Errors related to a card are reported in the corresponding result and do not interrupt
+     * the batch.
+     *
+     * @return A not null list containing one result per registered card, in the registration
+     *         order.
+     * @throw IllegalStateException If no transaction template has been set.
+     * @throw SamIOException If a communication error with the SAM occurs, making the processing
+     *        of the remaining cards impossible.
+     * @since 1.5.0
+     */
+    virtual const std::vector<std::shared_ptr<CardBatchResult>>& processBatch() = 0;
+
+    /**
+     * Gets the number of cards processed since the creation of the batch manager.
+     *
+     * @return A positive or zero value.
+     * @since 1.5.0
+     */
+    virtual int getProcessedCardsNumber() const = 0;
+
+    /**
+     * Gets the number of cards whose transaction failed since the creation of the batch manager.
+     *
+     * @return A positive or zero value.
+     * @since 1.5.0
+     */
+    virtual int getFailedCardsNumber() const = 0;
+
+    /**
+     * Gets the cumulated duration of all the processBatch() invocations.
+     *
+     * @return A positive or zero duration.
+     * @since 1.5.0
+     */
+    virtual std::chrono::microseconds getTotalProcessingTime() const = 0;
+
+    /**
+     * Gets the average throughput observed since the creation of the batch manager.
+     *
+     * @return The number of cards processed per second, 0 if no card has been processed.
+     * @since 1.5.0
+     */
+    virtual double getThroughput() const = 0;
+};
+
+}
+}
+}
+}
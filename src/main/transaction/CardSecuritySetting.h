@@ -17,6 +17,7 @@
 /* Calypsonet Terminal Calypso */
 #include "CalypsoSam.h"
 #include "CommonSecuritySetting.h"
+#include "TransactionExecutorSpi.h"
 #include "WriteAccessLevel.h"
 
 /* Calypsonet Terminal Reader */
@@ -29,6 +30,7 @@ namespace transaction {
 
 using namespace calypsonet::terminal::calypso;
 using namespace calypsonet::terminal::calypso::sam;
+using namespace calypsonet::terminal::calypso::spi;
 using namespace calypsonet::terminal::reader;
 
 /**
@@ -191,6 +193,42 @@ public:
     virtual CardSecuritySetting& setPinModificationCipheringKey(const uint8_t kif,
                                                                 const uint8_t kvc) = 0;
 
+    /**
+     * Enables the pipelining of the SAM commands computing the session digest with the card
+     * exchanges.
+     *
+     * <p>By default, each APDU exchanged with the card during a secure session is followed by the
+     * transmission of the corresponding <b>Digest Update</b> commands to the control SAM, so that
+     * the SAM latency adds up to the card latency.
+     *
+     * <p>When the pipelining is enabled, the <b>Digest Update</b> commands are queued and
+     * transmitted to the control SAM by tasks submitted to the provided executor, while the
+     * exchanges with the card go on. The card transaction only synchronizes with the SAM when the
+     * result of the digest is needed, that is to say before the <b>Digest Close</b> command of the
+     * session closing (or of the closing of an intermediate session in multiple session mode).
+     * The commands are transmitted to the SAM in the order of the card exchanges and the
+     * calypsonet::terminal::calypso::spi::TransactionObserverSpi, if any, is notified of them in
+     * that same order, from a thread of the executor and concurrently with the notifications of
+     * the card exchanges (see TransactionObserverSpi for the resulting thread-safety
+     * requirement).
+     *
+     * <p>A failure of a queued SAM command (e.g. SamIOException) is reported at the
+     * synchronization point by the method closing the session, which then aborts the card
+     * session. The commands still in the queue are discarded.
+     *
+     * <p>A transaction manager never has more than one pending task, so the executor does not
+     * need to preserve any ordering; it should not run the tasks in the calling thread, otherwise
+     * no overlap occurs. It may be shared by several transaction managers.
+     *
+     * <p>By default, the pipelining is disabled.
+     *
+     * @param executor The executor running the transmission of the queued SAM commands.
+     * @return The current instance.
+     * @throw IllegalArgumentException If the executor is null.
+     * @since 1.5.0
+     */
+    virtual CardSecuritySetting& enableSamDigestPipelining(
+        const std::shared_ptr<TransactionExecutorSpi> executor) = 0;
 };
 
 }
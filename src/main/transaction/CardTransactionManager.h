@@ -13,18 +13,24 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <vector>
 #include <string>
 
 /* Calypsonet Terminal Calypso */
 #include "CalypsoCard.h"
 #include "CardSecuritySetting.h"
+#include "CardTransactionCallbackSpi.h"
+#include "CardTransactionPlan.h"
 #include "CommonTransactionManager.h"
 #include "GetDataTag.h"
+#include "MemoryArenaSpi.h"
 #include "SearchCommandData.h"
 #include "SelectFileControl.h"
+#include "SessionBufferUsage.h"
 #include "SvAction.h"
 #include "SvOperation.h"
+#include "TransactionExecutorSpi.h"
 
 /* Calypsonet Terminal Reader */
 #include "CardReader.h"
@@ -39,6 +45,7 @@ namespace transaction {
 
 using namespace calypsonet::terminal::calypso;
 using namespace calypsonet::terminal::calypso::card;
+using namespace calypsonet::terminal::calypso::spi;
 using namespace calypsonet::terminal::reader;
 
 /**
@@ -108,6 +115,52 @@ public:
      */
     virtual const std::shared_ptr<CardSecuritySetting> getCardSecuritySetting() const = 0;
 
+    /**
+     * Reinitializes the transaction manager to perform a new transaction with another card,
+     * keeping the same security settings.
+     *
+     * <p>All the prepared commands and the state of the previous transaction (secure session,
+     * audit data, ...) are discarded, but the internal resources (buffers, command lists, SAM
+     * context) are kept in order to be reused. This allows a terminal to process successive
+     * transactions without any allocation related to the transaction manager itself.
+     *
+     * <p>The transaction manager then behaves as if it had just been created with the provided
+     * arguments.
+     *
+     * <p>A secure session is never closed or cancelled implicitly: if a secure session is open,
+     * the method fails and the manager is left unchanged. The session must be ended beforehand,
+     * either by processClosing() or by processCancel().
+     *
+     * @param cardReader The reader through which the card communicates.
+     * @param calypsoCard The initial card image, as provided by the selection process.
+     * @return The current instance.
+     * @throw IllegalArgumentException If one of the arguments is null or if the product type of
+     *        the card is CalypsoCard::ProductType::UNKNOWN.
+     * @throw IllegalStateException If a secure session is open or if an asynchronous processing
+     *        is in progress.
+     * @since 1.5.0
+     */
+    virtual CardTransactionManager& reset(const std::shared_ptr<CardReader> cardReader,
+                                          const std::shared_ptr<CalypsoCard> calypsoCard) = 0;
+
+    /**
+     * Sets the arena in which the objects created during the transaction are allocated (files,
+     * headers and data added to the card image, SV log records, counter values, ...).
+     *
+     * <p>By default, the arena set in the CalypsoCardSelection which produced the card image is
+     * used, or the heap if there is none.
+     *
+     * <p>The arena must outlive all these objects. Used with reset(const
+     * std::shared_ptr<CardReader>, const std::shared_ptr<CalypsoCard>), it allows the whole
+     * memory of a transaction to be released in one step before the next one.
+     *
+     * @param arena The arena to use, or null to use the heap.
+     * @return The current instance.
+     * @see CalypsoCardSelection::setMemoryArena(const std::shared_ptr<MemoryArenaSpi>)
+     * @since 1.5.0
+     */
+    virtual CardTransactionManager& setMemoryArena(const std::shared_ptr<MemoryArenaSpi> arena) = 0;
+
     /**
      * Schedules the execution of a <b>Select File</b> command based on the file's LID.
      *
@@ -491,6 +544,36 @@ public:
     virtual CardTransactionManager& prepareSearchRecords(
         const std::shared_ptr<SearchCommandData> data) = 0;
 
+    /**
+     * Performs the search described by the provided SearchCommandData on the records already
+     * present in the CalypsoCard image, without any communication with the card.
+     *
+     * <p>The search follows the same rules as the <b>Search Record Multiple</b> command (see
+     * prepareSearchRecords(const std::shared_ptr<SearchCommandData>) and RecordSearchEngine) and
+     * produces the same SearchCommandData::getMatchingRecordNumbers() result. Since the records
+     * are already in the card image, the SearchCommandData::fetchFirstMatchingResult() option has
+     * no effect.
+     *
+     * <p>The local search is only possible if the header of the EF is known (to determine its
+     * last record and the size of its records) and if, in all the records to analyze, the range
+     * to analyze has actually been read. A record read only partially (see
+     * RecordStore::getKnownOffset()) is never considered as matching or not matching on the basis
+     * of bytes which have not been read. Otherwise, the method returns false and the search can
+     * be scheduled on the card with prepareSearchRecords(const
+     * std::shared_ptr<SearchCommandData>).
+     *
+     * <p>Note that the search is performed on the card image, which may differ from the actual
+     * card content if the records have been modified outside the current transaction.
+     *
+     * @param data The input/output data containing the parameters of the search.
+     * @return True if the search has been performed, false if the card image does not contain
+     *         all the needed records.
+     * @throw IllegalArgumentException If the input data is inconsistent.
+     * @since 1.5.0
+     */
+    virtual bool searchRecordsInCardImage(const std::shared_ptr<SearchCommandData> data) const
+        = 0;
+
     /**
      * Schedules the execution of a <b>Verify Pin</b> command without PIN presentation in order to
      * get the attempt counter.
@@ -969,6 +1052,90 @@ public:
      */
     virtual CardTransactionManager& prepareReleaseCardChannel() = 0;
 
+    /**
+     * Enables the merging of compatible prepared commands into fewer APDUs.
+     *
+     * <p>When enabled, before each "process" method, consecutive prepared commands targeting the
+     * same EF are merged as follows:
+     *
+     * <ul>
+     *   <li>Readings of contiguous records are merged into a single <b>Read Records</b> command.
+     *   <li>Readings of the same part of contiguous records are merged into a single <b>Read Record
+     *       Multiple</b> command, if this command is supported by the card.
+     *   <li>A counter reading is merged with a reading of the record #1 of the same EF.
+     *   <li>Readings of adjacent or overlapping parts of a Binary EF are merged into a single
+     *       <b>Read Binary</b> command, within the limit of the card's APDU payload capacity.
+     *   <li>Increase (resp. Decrease) commands on counters of the same EF are merged into a single
+     *       <b>Increase Multiple</b> (resp. <b>Decrease Multiple</b>) command, if this command is
+     *       supported by the card.
+     * </ul>
+     *
+     * <p>The support of the commands is determined from CalypsoCard::getProductType() and
+     * CalypsoCard::isExtendedModeSupported(). Commands are never reordered. A merge is only done
+     * if it never increases the session buffer usage and never changes the resulting CalypsoCard
+     * image compared to the execution of the original commands; otherwise the commands are kept
+     * as prepared. Inside a secure session, merged commands keep the strict mode behavior: the
+     * failure of a merged command is reported for all the commands it replaces.
+     *
+     * <p>By default, the merging is disabled.
+     *
+     * @return The current instance.
+     * @since 1.5.0
+     */
+    virtual CardTransactionManager& enableCommandsMerging() = 0;
+
+    /**
+     * Compiles all the commands prepared so far into an immutable CardTransactionPlan, and
+     * removes them from the list of prepared commands.
+     *
+     * <p>The APDUs are encoded and split according to the characteristics of the current card,
+     * and the session buffer budget is computed once and for all. The resulting plan may then be
+     * replayed at each transaction with prepareTransactionPlan(const
+     * std::shared_ptr<CardTransactionPlan>), typically on a new CardTransactionManager.
+     *
+     * <p>Commands whose APDU depends on data collected during the transaction (e.g. SV
+     * operations, which depend on the result of the SV Get command) are kept in the plan in their
+     * prepared form and encoded when the plan is processed.
+     *
+     * @return A not null reference.
+     * @throw IllegalStateException If no command has been prepared.
+     * @since 1.5.0
+     */
+    virtual const std::shared_ptr<CardTransactionPlan> compileTransactionPlan() = 0;
+
+    /**
+     * Predicts how the commands prepared so far will use the card session buffer, without any
+     * communication with the card or the SAM.
+     *
+     * <p>The prediction is based on CalypsoCard::getSessionModification() and takes into account
+     * the budget already consumed if a secure session is open. Otherwise, it assumes that the
+     * commands will be executed by processOpening(const WriteAccessLevel).
+     *
+     * <p>It allows the application to reorder or reduce the prepared commands before processing
+     * them, in order to avoid a SessionBufferOverflowException or the cost of additional sessions
+     * in multiple session mode.
+     *
+     * @return A not null reference.
+     * @since 1.5.0
+     */
+    virtual const std::shared_ptr<SessionBufferUsage> getSessionBufferUsage() const = 0;
+
+    /**
+     * Schedules the execution of all the commands of the provided plan, as if the corresponding
+     * "prepare" methods had been invoked.
+     *
+     * <p>The pre-encoded APDUs of the plan are added as is to the list of prepared commands.
+     *
+     * @param plan The plan to replay.
+     * @return The current instance.
+     * @throw IllegalArgumentException If the plan is null or if it has been compiled for a card
+     *        profile different from the one of the current card.
+     * @see compileTransactionPlan()
+     * @since 1.5.0
+     */
+    virtual CardTransactionManager& prepareTransactionPlan(
+        const std::shared_ptr<CardTransactionPlan> plan) = 0;
+
     /**
      * Process all previously prepared card commands outside or inside a Secure Session.
      *
@@ -1295,6 +1462,71 @@ public:
      * @since 1.0.0
      */
     virtual CardTransactionManager& processCancel() = 0;
+
+    /**
+     * Asynchronous version of processOpening(WriteAccessLevel).
+     *
+     * <p>The method returns immediately after having submitted the processing to the provided
+     * executor. The outcome is then notified to the provided callback, from the executor's thread.
+     *
+     * <p>The arguments are checked synchronously; all the other errors that processOpening(const
+     * WriteAccessLevel) would have thrown are passed to
+     * CardTransactionCallbackSpi::onTransactionFailure(CardTransactionManager&, const
+     * std::exception_ptr).
+     *
+     * <p>The transaction manager is not thread safe: no other method of this instance may be
+     * invoked until the callback has been notified.
+     *
+     * @param writeAccessLevel An calypsonet::terminal::calypso::WriteAccessLevel enum entry.
+     * @param executor The executor in charge of running the processing.
+     * @param callback The callback to notify at the end of the processing.
+     * @throw IllegalArgumentException If the executor or the callback is null.
+     * @throw IllegalStateException If no CardSecuritySetting is available or if an asynchronous
+     *        processing is already in progress.
+     * @see processOpening(const WriteAccessLevel)
+     * @since 1.5.0
+     */
+    virtual void processOpeningAsync(const WriteAccessLevel writeAccessLevel,
+                                     const std::shared_ptr<TransactionExecutorSpi> executor,
+                                     const std::shared_ptr<CardTransactionCallbackSpi> callback)
+        = 0;
+
+    /**
+     * Asynchronous version of processCommands().
+     *
+     * <p>The behavior regarding the executor, the callback and the errors is the same as for
+     * processOpeningAsync(const WriteAccessLevel, const std::shared_ptr<TransactionExecutorSpi>,
+     * const std::shared_ptr<CardTransactionCallbackSpi>).
+     *
+     * @param executor The executor in charge of running the processing.
+     * @param callback The callback to notify at the end of the processing.
+     * @throw IllegalArgumentException If the executor or the callback is null.
+     * @throw IllegalStateException If an asynchronous processing is already in progress.
+     * @see processCommands()
+     * @since 1.5.0
+     */
+    virtual void processCommandsAsync(const std::shared_ptr<TransactionExecutorSpi> executor,
+                                      const std::shared_ptr<CardTransactionCallbackSpi> callback)
+        = 0;
+
+    /**
+     * Asynchronous version of processClosing().
+     *
+     * <p>The behavior regarding the executor, the callback and the errors is the same as for
+     * processOpeningAsync(const WriteAccessLevel, const std::shared_ptr<TransactionExecutorSpi>,
+     * const std::shared_ptr<CardTransactionCallbackSpi>).
+     *
+     * @param executor The executor in charge of running the processing.
+     * @param callback The callback to notify at the end of the processing.
+     * @throw IllegalArgumentException If the executor or the callback is null.
+     * @throw IllegalStateException If no session is open or if an asynchronous processing is
+     *        already in progress.
+     * @see processClosing()
+     * @since 1.5.0
+     */
+    virtual void processClosingAsync(const std::shared_ptr<TransactionExecutorSpi> executor,
+                                     const std::shared_ptr<CardTransactionCallbackSpi> callback)
+        = 0;
 };
 
 }
@@ -0,0 +1,102 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+/* Calypsonet Terminal Calypso */
+#include "CalypsoCard.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace calypso {
+namespace transaction {
+
+using namespace calypsonet::terminal::calypso::card;
+
+/**
+ * Immutable and reusable sequence of card commands compiled by
+ * CardTransactionManager::compileTransactionPlan().
+ *
+ * <p>A plan is the result of the preparation step done once: the APDUs are already encoded,
+ * already split according to the session buffer capacity of the card and the session buffer
+ * budget is already computed. Replaying it with
+ * CardTransactionManager::prepareTransactionPlan(const std::shared_ptr<CardTransactionPlan>)
+ * therefore avoids any command building work at each transaction.
+ *
+ * <p>A plan is built for a given card profile (product type, extended mode support and session
+ * modification byte) and can only be replayed on cards having the same profile.
+ *
+ * <p>Since a plan is immutable, it may be shared between several transaction managers, including
+ * from different threads.
+ *
+ * @since 1.5.0
+ */
+class CardTransactionPlan {
+public:
+    /**
+     *
+     */
+    virtual ~CardTransactionPlan() = default;
+
+    /**
+     * Gets the product type of the cards on which the plan can be replayed.
+     *
+     * @return A not null reference.
+     * @since 1.5.0
+     */
+    virtual const CalypsoCard::ProductType& getProductType() const = 0;
+
+    /**
+     * Gets the session modification byte of the cards on which the plan can be replayed.
+     *
+     * @return The Session Modification byte.
+     * @see CalypsoCard::getSessionModification()
+     * @since 1.5.0
+     */
+    virtual uint8_t getSessionModification() const = 0;
+
+    /**
+     * Gets the number of prepared commands compiled in the plan.
+     *
+     * @return A positive or zero value.
+     * @since 1.5.0
+     */
+    virtual int getCommandsNumber() const = 0;
+
+    /**
+     * Gets the number of pre-encoded APDUs of the plan.
+     *
+     * <p>It may be greater than the number of commands, for example when a reading has been split
+     * into several APDUs.
+     *
+     * @return A positive or zero value.
+     * @since 1.5.0
+     */
+    virtual int getApdusNumber() const = 0;
+
+    /**
+     * Gets the part of the session buffer consumed by the commands of the plan when executed
+     * inside a secure session.
+     *
+     * <p>The unit depends on the card: a number of bytes or a number of modifying commands (see
+     * CalypsoCard::getSessionModification()).
+     *
+     * @return A positive or zero value.
+     * @since 1.5.0
+     */
+    virtual int getSessionBufferBudget() const = 0;
+};
+
+}
+}
+}
+}
@@ -16,6 +16,7 @@
 
 /* Calypsonet Terminal Calypso */
 #include "CalypsoSam.h"
+#include "SamResourcePoolSpi.h"
 #include "SamRevocationServiceSpi.h"
 
 /* Calypsonet Terminal Reader */
@@ -58,6 +59,36 @@ public:
         const std::shared_ptr<CardReader> samReader,
         const std::shared_ptr<CalypsoSam> calypsoSam) = 0;
 
+    /**
+     * Defines a pool of control SAMs to be used instead of a single control SAM.
+     *
+     * <p>A SAM is allocated from the pool for each secure session (or SAM transaction) and
+     * released at its end, together with the time spent communicating with it, so that the
+     * sessions of concurrent transactions are spread over all the SAMs of the pool.
+     *
+     * <p>If no SAM is available (SamResourcePoolSpi::allocateSamResource() returns null), the
+     * method requiring a SAM fails with a
+     * calypsonet::terminal::calypso::transaction::SamIOException before any exchange with the
+     * card related to the SAM operation; in particular, no card session is opened.
+     *
+     * <p>If a SamIOException occurs, the SAM is released as failed. Outside a card session, the
+     * SAM operation in progress is retried once on another SAM allocated from the pool, and the
+     * exception is only propagated if no other SAM is available or if the retry fails too.
+     * During a card session, the digest state held by the SAM cannot be moved to another SAM: the
+     * card session is aborted and the exception is propagated. Another SAM of the pool is only
+     * used from the next session on.
+     *
+     * <p>This setting replaces any SAM previously defined by setControlSamResource(const
+     * std::shared_ptr<CardReader>, const std::shared_ptr<CalypsoSam>), and vice versa.
+     *
+     * @param pool The pool of control SAMs.
+     * @return The current instance.
+     * @throw IllegalArgumentException If the provided pool is null.
+     * @since 1.5.0
+     */
+    virtual CommonSecuritySetting& setControlSamResourcePool(
+        const std::shared_ptr<SamResourcePoolSpi> pool) = 0;
+
     /**
      * Sets the service to be used to dynamically check if a SAM is revoked or not.
      *
@@ -13,11 +13,18 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <vector>
 
 /* Calypsonet Terminal Calypso */
+#include "BasicSignatureComputationData.h"
+#include "BasicSignatureVerificationData.h"
+#include "CommonSecuritySetting.h"
 #include "CommonSignatureComputationData.h"
 #include "CommonSignatureVerificationData.h"
+#include "TraceableSignatureComputationData.h"
+#include "TraceableSignatureVerificationData.h"
+#include "TransactionObserverSpi.h"
 
 /* Keyple Core Util */
 #include "Any.h"
@@ -27,6 +34,7 @@ namespace terminal {
 namespace calypso {
 namespace transaction {
 
+using namespace calypsonet::terminal::calypso::spi;
 using namespace keyple::core::util::cpp;
 
 /**
@@ -62,6 +70,18 @@ public:
      */
     virtual const std::vector<std::vector<uint8_t>>& getTransactionAuditData() const = 0;
 
+    /**
+     * Sets the observer to be notified of each APDU exchanged with the card or the SAM.
+     *
+     * <p>When no observer is set, no event is built and no time is measured, so that the
+     * observation has no cost.
+     *
+     * @param observer The observer to set, or null to remove the current observer.
+     * @return The current instance.
+     * @since 1.5.0
+     */
+    virtual T& setTransactionObserver(const std::shared_ptr<TransactionObserverSpi> observer) = 0;
+
     /**
      * Schedules the execution of a "Data Cipher" or "PSO Compute Signature" SAM command.
      *
@@ -92,6 +112,36 @@ public:
      */
     virtual T& prepareComputeSignature(const any data) = 0;
 
+    /**
+     * Schedules the execution of a "Data Cipher" SAM command.
+     *
+     * <p>Same as prepareComputeSignature(const any) with a BasicSignatureComputationData, but
+     * without type erasure: the dispatch is resolved at compile time and no intermediate object is
+     * allocated.
+     *
+     * @param data The input/output data containing the parameters of the command.
+     * @return The current instance.
+     * @throw IllegalArgumentException If the input data is null or inconsistent.
+     * @since 1.5.0
+     */
+    virtual T& prepareComputeBasicSignature(
+        const std::shared_ptr<BasicSignatureComputationData> data) = 0;
+
+    /**
+     * Schedules the execution of a "PSO Compute Signature" SAM command.
+     *
+     * <p>Typed counterpart of prepareComputeSignature(const any) for a
+     * TraceableSignatureComputationData (see prepareComputeBasicSignature(const
+     * std::shared_ptr<BasicSignatureComputationData>)).
+     *
+     * @param data The input/output data containing the parameters of the command.
+     * @return The current instance.
+     * @throw IllegalArgumentException If the input data is null or inconsistent.
+     * @since 1.5.0
+     */
+    virtual T& prepareComputeTraceableSignature(
+        const std::shared_ptr<TraceableSignatureComputationData> data) = 0;
+
     /**
      * Schedules the execution of a "Data Cipher" or "PSO Verify Signature" SAM command.
      *
@@ -111,6 +161,38 @@ public:
      */
     virtual T& prepareVerifySignature(const any data) = 0;
 
+    /**
+     * Schedules the execution of a "Data Cipher" SAM command to verify a basic signature.
+     *
+     * <p>Typed counterpart of prepareVerifySignature(const any) for a
+     * BasicSignatureVerificationData (see prepareComputeBasicSignature(const
+     * std::shared_ptr<BasicSignatureComputationData>)).
+     *
+     * @param data The input/output data containing the parameters of the command.
+     * @return The current instance.
+     * @throw IllegalArgumentException If the input data is null or inconsistent.
+     * @since 1.5.0
+     */
+    virtual T& prepareVerifyBasicSignature(
+        const std::shared_ptr<BasicSignatureVerificationData> data) = 0;
+
+    /**
+     * Schedules the execution of a "PSO Verify Signature" SAM command.
+     *
+     * <p>Typed counterpart of prepareVerifySignature(const any) for a
+     * TraceableSignatureVerificationData (see prepareComputeBasicSignature(const
+     * std::shared_ptr<BasicSignatureComputationData>)).
+     *
+     * @param data The input/output data containing the parameters of the command.
+     * @return The current instance.
+     * @throw IllegalArgumentException If the input data is null or inconsistent.
+     * @throw SamRevokedException If the signature has been computed in "SAM traceability" mode and
+     *        the SAM revocation status check has been requested and the SAM is revoked.
+     * @since 1.5.0
+     */
+    virtual T& prepareVerifyTraceableSignature(
+        const std::shared_ptr<TraceableSignatureVerificationData> data) = 0;
+
     /**
      * Process all previously prepared commands.
      *
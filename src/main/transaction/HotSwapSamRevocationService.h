@@ -0,0 +1,250 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/* Calypsonet Terminal Calypso */
+#include "SamRevocationServiceSpi.h"
+
+/* Keyple Core Util */
+#include "IllegalArgumentException.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace calypso {
+namespace transaction {
+
+using namespace calypsonet::terminal::calypso::spi;
+using namespace keyple::core::util::cpp::exception;
+
+/**
+ * SamRevocationServiceSpi forwarding the checks to a revocation service which can be replaced at
+ * any time, typically a SamRevocationIndex built from the last received revocation list.
+ *
+ * <p>The checks never block: a check started before a replacement completes with the previous
+ * service, the following ones use the new service. The replacement waits for the checks still
+ * using the previous service to complete before releasing it.
+ *
+ * <p>This class is thread-safe.
+ *
+ * @since 1.5.0
+ */
+class HotSwapSamRevocationService final : public SamRevocationServiceSpi {
+public:
+    /**
+     * Creates an instance.
+     *
+     * @param samRevocationService The initial revocation service.
+     * @throw IllegalArgumentException If the service is null.
+     * @since 1.5.0
+     */
+    explicit HotSwapSamRevocationService(
+        const std::shared_ptr<const SamRevocationServiceSpi> samRevocationService)
+    : mSamRevocationService(samRevocationService),
+      mCurrent(samRevocationService.get()),
+      mVersion(0)
+    {
+        if (samRevocationService == nullptr) {
+            throw IllegalArgumentException("The SAM revocation service must not be null.");
+        }
+
+        mReaders[0] = 0;
+        mReaders[1] = 0;
+    }
+
+    /**
+     * Replaces the revocation service.
+     *
+     * <p>The method returns once no check uses the previous service anymore.
+     *
+     * @param samRevocationService The new revocation service.
+     * @return The previous revocation service.
+     * @throw IllegalArgumentException If the service is null.
+     * @since 1.5.0
+     */
+    std::shared_ptr<const SamRevocationServiceSpi> swap(
+        const std::shared_ptr<const SamRevocationServiceSpi> samRevocationService)
+    {
+        if (samRevocationService == nullptr) {
+            throw IllegalArgumentException("The SAM revocation service must not be null.");
+        }
+
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        /*
+         * Left-right scheme: a check registers itself in the reader counter of the current
+         * version before loading the service. Once the new service is published, the readers of
+         * both versions are drained, so that none of them can still use the previous service.
+         */
+        mCurrent.store(samRevocationService.get());
+
+        const unsigned int version = mVersion.load();
+        waitForReaders((version + 1) & 1);
+        mVersion.store(version + 1);
+        waitForReaders(version & 1);
+
+        std::shared_ptr<const SamRevocationServiceSpi> previous = mSamRevocationService;
+        mSamRevocationService = samRevocationService;
+
+        return previous;
+    }
+
+    /**
+     * Gets the current revocation service.
+     *
+     * @return A not null reference.
+     * @since 1.5.0
+     */
+    std::shared_ptr<const SamRevocationServiceSpi> getSamRevocationService() const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        return mSamRevocationService;
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    bool isSamRevoked(const std::vector<uint8_t>& serialNumber) const override
+    {
+        const Reader reader(*this);
+
+        return reader.service->isSamRevoked(serialNumber);
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    bool isSamRevoked(const std::vector<uint8_t>& serialNumber, const int counterValue)
+        const override
+    {
+        const Reader reader(*this);
+
+        return reader.service->isSamRevoked(serialNumber, counterValue);
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    bool isSamRevokedBySerial4(const std::array<uint8_t, 4>& serialNumber,
+                               const int counterValue) const override
+    {
+        const Reader reader(*this);
+
+        return reader.service->isSamRevokedBySerial4(serialNumber, counterValue);
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    bool isSamRevokedBySerial3(const std::array<uint8_t, 3>& serialNumber,
+                               const int counterValue) const override
+    {
+        const Reader reader(*this);
+
+        return reader.service->isSamRevokedBySerial3(serialNumber, counterValue);
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * <p>All the queries of the batch are answered by the same service.
+     *
+     * @since 1.5.0
+     */
+    void areSamsRevoked(const std::vector<RevocationQuery>& queries,
+                        std::vector<bool>& revoked) const override
+    {
+        const Reader reader(*this);
+
+        reader.service->areSamsRevoked(queries, revoked);
+    }
+
+private:
+    /**
+     * Registration of a check in the reader counter of the current version, for its duration.
+     */
+    class Reader final {
+    public:
+        explicit Reader(const HotSwapSamRevocationService& parent)
+        : counter(parent.mReaders[parent.mVersion.load() & 1])
+        {
+            counter++;
+            service = parent.mCurrent.load();
+        }
+
+        ~Reader()
+        {
+            counter--;
+        }
+
+        std::atomic<int>& counter;
+        const SamRevocationServiceSpi* service;
+    };
+
+    /**
+     *
+     */
+    void waitForReaders(const unsigned int index) const
+    {
+        while (mReaders[index].load() != 0) {
+            std::this_thread::yield();
+        }
+    }
+
+    /**
+     * Owner of the current service, only accessed under the mutex.
+     */
+    std::shared_ptr<const SamRevocationServiceSpi> mSamRevocationService;
+
+    /**
+     *
+     */
+    std::atomic<const SamRevocationServiceSpi*> mCurrent;
+
+    /**
+     *
+     */
+    std::atomic<unsigned int> mVersion;
+
+    /**
+     *
+     */
+    mutable std::atomic<int> mReaders[2];
+
+    /**
+     *
+     */
+    mutable std::mutex mMutex;
+};
+
+}
+}
+}
+}
@@ -0,0 +1,277 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/* Calypsonet Terminal Calypso */
+#include "CalypsoSam.h"
+#include "SamResourcePoolSpi.h"
+
+/* Calypsonet Terminal Reader */
+#include "CardReader.h"
+
+/* Keyple Core Util */
+#include "IllegalArgumentException.h"
+#include "IndexOutOfBoundsException.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace calypso {
+namespace transaction {
+
+using namespace calypsonet::terminal::calypso::sam;
+using namespace calypsonet::terminal::calypso::spi;
+using namespace calypsonet::terminal::reader;
+using namespace keyple::core::util::cpp::exception;
+
+/**
+ * Reference implementation of SamResourcePoolSpi handing out the least loaded idle SAM.
+ *
+ * <p>Only the SAMs which are not currently allocated are handed out; among them, the one with the
+ * lowest cumulated busy time is chosen. A SAM released as failed is put in quarantine for a
+ * configurable duration, during which it is not handed out.
+ *
+ * <p>The statistics of each SAM (busy time, allocations and failures) are available by index, in
+ * the order in which the SAMs have been added.
+ *
+ * <p>This class is thread-safe. The SAMs must all be added before the pool is shared.
+ *
+ * @since 1.5.0
+ */
+class LoadBalancedSamResourcePool final : public SamResourcePoolSpi {
+public:
+    /**
+     * Creates an empty pool.
+     *
+     * @param quarantineDuration The duration during which a failed SAM is not handed out.
+     * @since 1.5.0
+     */
+    explicit LoadBalancedSamResourcePool(const std::chrono::milliseconds quarantineDuration)
+    : mQuarantineDuration(quarantineDuration) {}
+
+    /**
+     * Adds a SAM to the pool.
+     *
+     * @param samReader The SAM reader.
+     * @param calypsoSam The Calypso SAM.
+     * @return The current instance.
+     * @throw IllegalArgumentException If one of the arguments is null or if the product type of
+     *        CalypsoSam is equal to CalypsoSam::ProductType::UNKNOWN.
+     * @since 1.5.0
+     */
+    LoadBalancedSamResourcePool& addSamResource(const std::shared_ptr<CardReader> samReader,
+                                                const std::shared_ptr<CalypsoSam> calypsoSam)
+    {
+        if (samReader == nullptr || calypsoSam == nullptr ||
+            calypsoSam->getProductType() == CalypsoSam::ProductType::UNKNOWN) {
+            throw IllegalArgumentException("Invalid SAM resource.");
+        }
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        mEntries.push_back(std::make_shared<Entry>(samReader, calypsoSam, mEntries.size()));
+
+        return *this;
+    }
+
+    /**
+     * Gets the number of SAMs of the pool.
+     *
+     * @return A positive or zero value.
+     * @since 1.5.0
+     */
+    int getSamResourcesNumber() const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        return static_cast<int>(mEntries.size());
+    }
+
+    /**
+     * Gets the cumulated time spent communicating with a SAM.
+     *
+     * @param index The index of the SAM.
+     * @return A positive or zero duration.
+     * @throw IndexOutOfBoundsException If the index is out of range.
+     * @since 1.5.0
+     */
+    std::chrono::microseconds getBusyTime(const int index) const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        return getEntry(index).busyTime;
+    }
+
+    /**
+     * Gets the number of allocations of a SAM since its addition to the pool.
+     *
+     * @param index The index of the SAM.
+     * @return A positive or zero value.
+     * @throw IndexOutOfBoundsException If the index is out of range.
+     * @since 1.5.0
+     */
+    long getAllocationsNumber(const int index) const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        return getEntry(index).allocationsNumber;
+    }
+
+    /**
+     * Gets the number of allocations of a SAM which ended with a failure.
+     *
+     * @param index The index of the SAM.
+     * @return A positive or zero value.
+     * @throw IndexOutOfBoundsException If the index is out of range.
+     * @since 1.5.0
+     */
+    long getFailuresNumber(const int index) const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        return getEntry(index).failuresNumber;
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    const std::shared_ptr<SamResource> allocateSamResource() override
+    {
+        const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        Entry* best = nullptr;
+        for (const auto& entry : mEntries) {
+            if (entry->allocated || entry->quarantineEnd > now) {
+                continue;
+            }
+
+            if (best == nullptr || entry->busyTime < best->busyTime) {
+                best = entry.get();
+            }
+        }
+
+        if (best == nullptr) {
+            return nullptr;
+        }
+
+        best->allocated = true;
+        best->allocationsNumber++;
+
+        return mEntries[best->index];
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @throw IllegalArgumentException If the SAM has not been allocated by this pool.
+     * @since 1.5.0
+     */
+    void releaseSamResource(const std::shared_ptr<SamResource> samResource,
+                            const std::chrono::microseconds busyTime,
+                            const bool failed) override
+    {
+        const std::shared_ptr<Entry> entry = std::dynamic_pointer_cast<Entry>(samResource);
+
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        if (entry == nullptr || entry->index >= mEntries.size() ||
+            mEntries[entry->index] != entry || !entry->allocated) {
+            throw IllegalArgumentException("The SAM resource has not been allocated by this pool.");
+        }
+
+        entry->allocated = false;
+        entry->busyTime += busyTime;
+
+        if (failed) {
+            entry->failuresNumber++;
+            entry->quarantineEnd = std::chrono::steady_clock::now() + mQuarantineDuration;
+        }
+    }
+
+private:
+    /**
+     *
+     */
+    class Entry final : public SamResource {
+    public:
+        Entry(const std::shared_ptr<CardReader> samReader,
+              const std::shared_ptr<CalypsoSam> calypsoSam,
+              const std::size_t index)
+        : samReader(samReader),
+          calypsoSam(calypsoSam),
+          index(index),
+          allocated(false),
+          allocationsNumber(0),
+          failuresNumber(0),
+          busyTime(0) {}
+
+        const std::shared_ptr<CardReader> getSamReader() const override
+        {
+            return samReader;
+        }
+
+        const std::shared_ptr<CalypsoSam> getCalypsoSam() const override
+        {
+            return calypsoSam;
+        }
+
+        const std::shared_ptr<CardReader> samReader;
+        const std::shared_ptr<CalypsoSam> calypsoSam;
+        const std::size_t index;
+        bool allocated;
+        long allocationsNumber;
+        long failuresNumber;
+        std::chrono::microseconds busyTime;
+        std::chrono::steady_clock::time_point quarantineEnd;
+    };
+
+    /**
+     *
+     */
+    const Entry& getEntry(const int index) const
+    {
+        if (index < 0 || index >= static_cast<int>(mEntries.size())) {
+            throw IndexOutOfBoundsException("The SAM index is out of range.");
+        }
+
+        return *mEntries[index];
+    }
+
+    /**
+     *
+     */
+    const std::chrono::milliseconds mQuarantineDuration;
+
+    /**
+     *
+     */
+    std::vector<std::shared_ptr<Entry>> mEntries;
+
+    /**
+     *
+     */
+    mutable std::mutex mMutex;
+};
+
+}
+}
+}
+}
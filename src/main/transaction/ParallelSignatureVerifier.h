@@ -0,0 +1,616 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/* Calypsonet Terminal Calypso */
+#include "InvalidSignatureException.h"
+#include "SamIOException.h"
+#include "SamResourcePoolSpi.h"
+#include "SamRevocationServiceSpi.h"
+#include "SamTransactionManager.h"
+#include "SamTransactionManagerFactorySpi.h"
+#include "SignatureVerificationListenerSpi.h"
+#include "TraceableSignatureVerificationData.h"
+
+/* Keyple Core Util */
+#include "IllegalArgumentException.h"
+#include "IllegalStateException.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace calypso {
+namespace transaction {
+
+using namespace calypsonet::terminal::calypso::spi;
+using namespace keyple::core::util::cpp::exception;
+
+/**
+ * Verifies large sets of traceable signatures by spreading them over the SAMs of a pool and over
+ * several worker threads.
+ *
+ * <p>The requests are split into batches of a configurable size. Each worker thread takes the
+ * next batch, allocates a SAM from the pool, prepares a "PSO Verify Signature" command per
+ * request with a SAM transaction manager dedicated to this SAM, and processes them at once. The
+ * result of each request is provided to a SignatureVerificationListenerSpi as soon as its batch
+ * is processed, so that the results can be consumed while the verification goes on.
+ *
+ * <p>When the revocation status of the signing SAMs has to be checked (see
+ * TraceableSignatureVerificationData::withSamTraceabilityMode()), the provided revocation service
+ * is wrapped in a service remembering the answers, so that a given SAM (serial number and
+ * counter) is looked up only once per verify() invocation, whatever the number of signatures it
+ * produced.
+ *
+ * <p>A batch whose processing fails with a SamIOException is retried on another SAM, up to
+ * MAX_SAM_ATTEMPTS times; the failing SAM is released as failed so that the pool can put it in
+ * quarantine. If no SAM can be obtained from the pool (none available before the allocation
+ * timeout, or an exception raised by the pool), the requests of the batch are reported as failed.
+ *
+ * <p>verify() must not be invoked concurrently on the same instance.
+ *
+ * @since 1.5.0
+ */
+class ParallelSignatureVerifier final {
+public:
+    /**
+     * Maximum number of SAMs on which a batch is attempted before its requests are reported as
+     * failed.
+     *
+     * @since 1.5.0
+     */
+    static const int MAX_SAM_ATTEMPTS = 3;
+
+    /**
+     * Creates a verifier.
+     *
+     * @param samResourcePool The pool providing the SAMs.
+     * @param samTransactionManagerFactory The factory of the SAM transaction managers.
+     * @param samRevocationService The revocation service, null if the revocation status of the
+     *        signing SAMs is never checked.
+     * @param workersNumber The number of worker threads (should be {@code >=} 1).
+     * @param batchSize The maximum number of requests processed with a single SAM allocation
+     *        (should be {@code >=} 1).
+     * @param samAllocationTimeout The maximum time a worker waits for a SAM of the pool before
+     *        reporting the requests of its batch as failed.
+     * @throw IllegalArgumentException If one of the arguments is null or out of range.
+     * @since 1.5.0
+     */
+    ParallelSignatureVerifier(
+        const std::shared_ptr<SamResourcePoolSpi> samResourcePool,
+        const std::shared_ptr<SamTransactionManagerFactorySpi> samTransactionManagerFactory,
+        const std::shared_ptr<SamRevocationServiceSpi> samRevocationService,
+        const int workersNumber,
+        const int batchSize,
+        const std::chrono::milliseconds samAllocationTimeout)
+    : mSamResourcePool(samResourcePool),
+      mSamTransactionManagerFactory(samTransactionManagerFactory),
+      mSamRevocationService(
+          samRevocationService != nullptr ?
+              std::make_shared<DedupingSamRevocationService>(samRevocationService) : nullptr),
+      mWorkersNumber(workersNumber),
+      mBatchSize(batchSize),
+      mSamAllocationTimeout(samAllocationTimeout)
+    {
+        if (samResourcePool == nullptr || samTransactionManagerFactory == nullptr ||
+            workersNumber < 1 || batchSize < 1) {
+            throw IllegalArgumentException("Invalid parallel signature verifier parameters.");
+        }
+    }
+
+    /**
+     * Verifies the provided signatures and blocks until all the results have been provided to the
+     * listener.
+     *
+     * <p>Once this method has returned, the result of each request is also available with
+     * TraceableSignatureVerificationData::isSignatureValid(), except for the failed ones.
+     *
+     * @param data The verification requests.
+     * @param listener The listener receiving the result of each request, which must not throw.
+     * @throw IllegalArgumentException If one of the requests is null.
+     * @since 1.5.0
+     */
+    void verify(const std::vector<std::shared_ptr<TraceableSignatureVerificationData>>& data,
+                SignatureVerificationListenerSpi& listener)
+    {
+        if (std::find(data.begin(), data.end(), nullptr) != data.end()) {
+            throw IllegalArgumentException("The verification requests must not be null.");
+        }
+
+        if (mSamRevocationService != nullptr) {
+            mSamRevocationService->clear();
+        }
+
+        std::atomic<size_t> nextRequest(0);
+
+        const size_t batchesNumber = (data.size() + mBatchSize - 1) / mBatchSize;
+        const size_t threadsNumber =
+            std::min(static_cast<size_t>(mWorkersNumber), batchesNumber);
+
+        std::vector<std::thread> threads;
+        for (size_t i = 1; i < threadsNumber; i++) {
+            threads.emplace_back([this, &data, &listener, &nextRequest] {
+                runWorker(data, listener, nextRequest);
+            });
+        }
+
+        runWorker(data, listener, nextRequest);
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    /**
+     * Gets the number of revocation checks requested by the SAM transaction managers since the
+     * creation of the verifier.
+     *
+     * @return 0 if no revocation service has been provided.
+     * @since 1.5.0
+     */
+    long getRevocationChecksNumber() const
+    {
+        return mSamRevocationService != nullptr ? mSamRevocationService->getChecksNumber() : 0;
+    }
+
+    /**
+     * Gets the number of revocation checks actually forwarded to the revocation service since the
+     * creation of the verifier, the other ones having been answered from the previous answers.
+     *
+     * @return 0 if no revocation service has been provided.
+     * @since 1.5.0
+     */
+    long getRevocationLookupsNumber() const
+    {
+        return mSamRevocationService != nullptr ? mSamRevocationService->getLookupsNumber() : 0;
+    }
+
+private:
+    /**
+     * Revocation service forwarding each distinct check once, then answering from memory.
+     */
+    class DedupingSamRevocationService final : public SamRevocationServiceSpi {
+    public:
+        /**
+         *
+         */
+        explicit DedupingSamRevocationService(
+            const std::shared_ptr<SamRevocationServiceSpi> samRevocationService)
+        : mSamRevocationService(samRevocationService), mChecksNumber(0), mLookupsNumber(0) {}
+
+        /**
+         *
+         */
+        bool isSamRevoked(const std::vector<uint8_t>& serialNumber) const override
+        {
+            return check(serialNumber, NO_COUNTER);
+        }
+
+        /**
+         *
+         */
+        bool isSamRevoked(const std::vector<uint8_t>& serialNumber, const int counterValue)
+            const override
+        {
+            return check(serialNumber, counterValue);
+        }
+
+        /**
+         *
+         */
+        void clear()
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mAnswers.clear();
+        }
+
+        /**
+         *
+         */
+        long getChecksNumber() const
+        {
+            return mChecksNumber;
+        }
+
+        /**
+         *
+         */
+        long getLookupsNumber() const
+        {
+            return mLookupsNumber;
+        }
+
+    private:
+        /**
+         *
+         */
+        static const int NO_COUNTER = -1;
+
+        /**
+         *
+         */
+        static const int MAX_COUNTER = 0xFFFFFF;
+
+        /**
+         * Packs the size and the value of the serial number (up to 4 bytes) and the counter
+         * (3 bytes) in a single key.
+         */
+        static bool makeKey(const std::vector<uint8_t>& serialNumber,
+                            const int counterValue,
+                            uint64_t& key)
+        {
+            if (serialNumber.size() > 4 ||
+                counterValue < NO_COUNTER ||
+                counterValue > MAX_COUNTER) {
+                return false;
+            }
+
+            uint64_t serial = 0;
+            for (const uint8_t b : serialNumber) {
+                serial = (serial << 8) | b;
+            }
+
+            key = (static_cast<uint64_t>(serialNumber.size()) << 60) |
+                  (static_cast<uint64_t>(counterValue != NO_COUNTER) << 59) |
+                  (serial << 24) |
+                  static_cast<uint64_t>(counterValue & MAX_COUNTER);
+
+            return true;
+        }
+
+        /**
+         *
+         */
+        bool check(const std::vector<uint8_t>& serialNumber, const int counterValue) const
+        {
+            mChecksNumber++;
+
+            uint64_t key = 0;
+            const bool isCacheable = makeKey(serialNumber, counterValue, key);
+
+            if (isCacheable) {
+                std::lock_guard<std::mutex> lock(mMutex);
+
+                const auto it = mAnswers.find(key);
+                if (it != mAnswers.end()) {
+                    return it->second;
+                }
+            }
+
+            /* The lookup is done outside the lock, concurrent misses on a same SAM being rare */
+            mLookupsNumber++;
+            const bool isRevoked =
+                counterValue == NO_COUNTER ?
+                    mSamRevocationService->isSamRevoked(serialNumber) :
+                    mSamRevocationService->isSamRevoked(serialNumber, counterValue);
+
+            if (isCacheable) {
+                std::lock_guard<std::mutex> lock(mMutex);
+                mAnswers[key] = isRevoked;
+            }
+
+            return isRevoked;
+        }
+
+        /**
+         *
+         */
+        const std::shared_ptr<SamRevocationServiceSpi> mSamRevocationService;
+
+        /**
+         *
+         */
+        mutable std::mutex mMutex;
+
+        /**
+         *
+         */
+        mutable std::unordered_map<uint64_t, bool> mAnswers;
+
+        /**
+         *
+         */
+        mutable std::atomic<long> mChecksNumber;
+
+        /**
+         *
+         */
+        mutable std::atomic<long> mLookupsNumber;
+    };
+
+    /**
+     * SAM transaction managers of a worker, by SAM. The SAMs are weakly referenced and ordered by
+     * owner, so that a SAM resource recreated by the pool (possibly at the address of a destroyed
+     * one) never gets the manager of another resource.
+     */
+    using ManagerMap = std::map<std::weak_ptr<SamResourcePoolSpi::SamResource>,
+                                std::shared_ptr<SamTransactionManager>,
+                                std::owner_less<std::weak_ptr<SamResourcePoolSpi::SamResource>>>;
+
+    /**
+     *
+     */
+    void runWorker(const std::vector<std::shared_ptr<TraceableSignatureVerificationData>>& data,
+                   SignatureVerificationListenerSpi& listener,
+                   std::atomic<size_t>& nextRequest) const
+    {
+        ManagerMap managers;
+        std::vector<int> pending;
+        pending.reserve(mBatchSize);
+
+        for (;;) {
+            const size_t start = nextRequest.fetch_add(mBatchSize);
+            if (start >= data.size()) {
+                return;
+            }
+
+            const size_t end = std::min(start + mBatchSize, data.size());
+
+            pending.clear();
+            for (size_t i = start; i < end; i++) {
+                pending.push_back(static_cast<int>(i));
+            }
+
+            verifyBatch(data, pending, managers, listener);
+        }
+    }
+
+    /**
+     *
+     */
+    void verifyBatch(const std::vector<std::shared_ptr<TraceableSignatureVerificationData>>& data,
+                     std::vector<int>& pending,
+                     ManagerMap& managers,
+                     SignatureVerificationListenerSpi& listener) const
+    {
+        int attempts = 0;
+
+        while (!pending.empty()) {
+            std::shared_ptr<SamResourcePoolSpi::SamResource> samResource;
+            std::chrono::steady_clock::time_point startTime;
+            std::exception_ptr error;
+            bool isSamFailed = false;
+
+            try {
+                samResource = allocateSamResource();
+                if (samResource == nullptr) {
+                    throw IllegalStateException("No SAM available in the pool.");
+                }
+
+                startTime = std::chrono::steady_clock::now();
+                verifyPending(*getManager(managers, samResource), data, pending, listener);
+
+            } catch (const SamIOException&) {
+                error = std::current_exception();
+                isSamFailed = samResource != nullptr;
+                managers.erase(samResource);
+
+            } catch (...) {
+                /* The manager may hold commands left by the failed processing */
+                error = std::current_exception();
+                managers.erase(samResource);
+            }
+
+            if (samResource == nullptr) {
+                reportFailure(pending, error, listener);
+                return;
+            }
+
+            mSamResourcePool->releaseSamResource(
+                samResource,
+                std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - startTime),
+                isSamFailed);
+
+            if (error != nullptr && (!isSamFailed || ++attempts >= MAX_SAM_ATTEMPTS)) {
+                reportFailure(pending, error, listener);
+                return;
+            }
+        }
+    }
+
+    /**
+     * Gets the manager of a SAM, creating it if needed. The entries of the SAMs destroyed by the
+     * pool are removed at that time.
+     */
+    std::shared_ptr<SamTransactionManager> getManager(
+        ManagerMap& managers,
+        const std::shared_ptr<SamResourcePoolSpi::SamResource> samResource) const
+    {
+        std::shared_ptr<SamTransactionManager>& manager = managers[samResource];
+        if (manager != nullptr) {
+            return manager;
+        }
+
+        manager = mSamTransactionManagerFactory->createSamTransactionManager(samResource,
+                                                                             mSamRevocationService);
+        const std::shared_ptr<SamTransactionManager> created = manager;
+
+        for (auto it = managers.begin(); it != managers.end();) {
+            it = it->first.expired() ? managers.erase(it) : std::next(it);
+        }
+
+        return created;
+    }
+
+    /**
+     * Verifies the pending requests with the provided manager, removing them from the list as
+     * their result is reported. When an exception is thrown, the pending list contains exactly the
+     * requests whose result has not been reported yet.
+     */
+    static void verifyPending(
+        SamTransactionManager& manager,
+        const std::vector<std::shared_ptr<TraceableSignatureVerificationData>>& data,
+        std::vector<int>& pending,
+        SignatureVerificationListenerSpi& listener)
+    {
+        std::vector<int> prepared;
+        prepared.reserve(pending.size());
+
+        while (!pending.empty()) {
+            prepared.clear();
+            for (auto it = pending.begin(); it != pending.end(); ++it) {
+                try {
+                    manager.prepareVerifyTraceableSignature(data[*it]);
+                    prepared.push_back(*it);
+
+                } catch (const SamIOException&) {
+                    /* The requests already reported as failed are not retried */
+                    prepared.insert(prepared.end(), it, pending.end());
+                    pending.swap(prepared);
+                    throw;
+
+                } catch (...) {
+                    /* Inconsistent data or revoked SAM */
+                    listener.onSignatureVerificationFailure(*it, std::current_exception());
+                }
+            }
+
+            pending.clear();
+
+            try {
+                manager.processCommands();
+
+            } catch (const InvalidSignatureException&) {
+                /*
+                 * The processing stopped at the first invalid signature: the results of the
+                 * commands processed before are available and the following commands have to be
+                 * prepared again.
+                 */
+                if (reportResults(data, prepared, pending, listener) == 0) {
+                    reportFailure(pending, std::current_exception(), listener);
+                    pending.clear();
+                }
+                continue;
+
+            } catch (...) {
+                pending.swap(prepared);
+                throw;
+            }
+
+            if (reportResults(data, prepared, pending, listener) != prepared.size()) {
+                reportFailure(pending, std::make_exception_ptr(
+                    IllegalStateException("The signature verification has not been processed.")),
+                    listener);
+                pending.clear();
+            }
+        }
+    }
+
+    /**
+     * Reports the available results of the prepared requests, appends the other ones to the
+     * pending list and returns the number of reported results.
+     */
+    static size_t reportResults(
+        const std::vector<std::shared_ptr<TraceableSignatureVerificationData>>& data,
+        const std::vector<int>& prepared,
+        std::vector<int>& pending,
+        SignatureVerificationListenerSpi& listener)
+    {
+        size_t reportedNumber = 0;
+
+        for (const int index : prepared) {
+            bool isSignatureValid = false;
+            try {
+                isSignatureValid = data[index]->isSignatureValid();
+
+            } catch (const IllegalStateException&) {
+                pending.push_back(index);
+                continue;
+            }
+
+            listener.onSignatureVerified(index, isSignatureValid);
+            reportedNumber++;
+        }
+
+        return reportedNumber;
+    }
+
+    /**
+     *
+     */
+    static void reportFailure(const std::vector<int>& indexes,
+                              const std::exception_ptr error,
+                              SignatureVerificationListenerSpi& listener)
+    {
+        for (const int index : indexes) {
+            listener.onSignatureVerificationFailure(index, error);
+        }
+    }
+
+    /**
+     * Allocates a SAM, waiting for one to be available until the allocation timeout expires.
+     */
+    std::shared_ptr<SamResourcePoolSpi::SamResource> allocateSamResource() const
+    {
+        const std::chrono::steady_clock::time_point deadline =
+            std::chrono::steady_clock::now() + mSamAllocationTimeout;
+
+        for (;;) {
+            std::shared_ptr<SamResourcePoolSpi::SamResource> samResource =
+                mSamResourcePool->allocateSamResource();
+
+            if (samResource != nullptr || std::chrono::steady_clock::now() >= deadline) {
+                return samResource;
+            }
+
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+
+    /**
+     *
+     */
+    const std::shared_ptr<SamResourcePoolSpi> mSamResourcePool;
+
+    /**
+     *
+     */
+    const std::shared_ptr<SamTransactionManagerFactorySpi> mSamTransactionManagerFactory;
+
+    /**
+     *
+     */
+    const std::shared_ptr<DedupingSamRevocationService> mSamRevocationService;
+
+    /**
+     *
+     */
+    const int mWorkersNumber;
+
+    /**
+     *
+     */
+    const int mBatchSize;
+
+    /**
+     *
+     */
+    const std::chrono::milliseconds mSamAllocationTimeout;
+};
+
+}
+}
+}
+}
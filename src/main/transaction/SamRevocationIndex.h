@@ -0,0 +1,523 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/* Calypsonet Terminal Calypso */
+#include "ByteView.h"
+#include "SamRevocationServiceSpi.h"
+
+/* Keyple Core Util */
+#include "IllegalArgumentException.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace calypso {
+namespace transaction {
+
+using namespace calypsonet::terminal::calypso;
+using namespace calypsonet::terminal::calypso::spi;
+using namespace keyple::core::util::cpp::exception;
+
+/**
+ * Reference implementation of SamRevocationServiceSpi answering from an immutable, compact
+ * revocation list.
+ *
+ * <p>The list is encoded in a flat binary image (see Builder) which can be saved as is and later
+ * used in place, for example from a memory-mapped file, without any parsing or copy:
+ *
+ * <ul>
+ *   <li>Header (16 bytes): magic "SRVI", format version, log2 of the number of bits of the Bloom
+ *       filter, 2 RFU bytes, number of entries (4 bytes), 4 RFU bytes.
+ *   <li>Bloom filter on the 3 LSBytes of the revoked serial numbers.
+ *   <li>Entries (8 bytes each): complete serial number (4 bytes) and counter value from which the
+ *       signatures of the SAM are revoked (4 bytes), sorted by the 3 LSBytes of the serial number,
+ *       then by complete serial number.
+ * </ul>
+ *
+ * <p>All the multi-byte values are little-endian and are read byte per byte, so that the image
+ * has no alignment requirement.
+ *
+ * <p>A SAM is revoked if its serial number is in the list and, when a counter value is provided,
+ * if this value is greater than or equal to the threshold of the entry. A partial serial number
+ * (3 LSBytes) matches all the entries having the same 3 LSBytes. Most of the not revoked SAMs are
+ * rejected by the Bloom filter; the other ones cost a binary search.
+ *
+ * <p>This class is immutable and thus thread-safe. The index is replaced as a whole when a new
+ * list is available (see HotSwapSamRevocationService).
+ *
+ * @since 1.5.0
+ */
+class SamRevocationIndex final : public SamRevocationServiceSpi {
+public:
+    /**
+     * Version of the binary format produced by the Builder.
+     *
+     * @since 1.5.0
+     */
+    static const uint8_t FORMAT_VERSION = 1;
+
+    /**
+     * Builds the binary image of a revocation list.
+     *
+     * @since 1.5.0
+     */
+    class Builder final {
+    public:
+        /**
+         * Adds a revoked SAM.
+         *
+         * <p>When the same SAM is added several times, the lowest counter value is kept.
+         *
+         * @param serialNumber The complete SAM serial number (4 bytes).
+         * @param fromCounterValue The counter value from which the signatures of the SAM are
+         *        revoked, 0 if all of them are.
+         * @return The current instance.
+         * @throw IllegalArgumentException If the serial number is not 4 bytes long or if the
+         *        counter value is out of range [0..FFFFFFh].
+         * @since 1.5.0
+         */
+        Builder& addRevokedSam(const std::vector<uint8_t>& serialNumber,
+                               const int fromCounterValue)
+        {
+            if (serialNumber.size() != 4 || fromCounterValue < 0 ||
+                fromCounterValue > MAX_COUNTER) {
+                throw IllegalArgumentException("Invalid revoked SAM.");
+            }
+
+            const uint32_t serial = toUint32(serialNumber.data(), 4);
+            mEntries.push_back((static_cast<uint64_t>(serial & LSB_MASK) << 32) |
+                               (static_cast<uint64_t>(serial >> 24) << 24) |
+                               static_cast<uint64_t>(fromCounterValue));
+
+            return *this;
+        }
+
+        /**
+         * Encodes the revocation list.
+         *
+         * @return The binary image of the list, to be provided to SamRevocationIndex.
+         * @since 1.5.0
+         */
+        std::vector<uint8_t> build() const
+        {
+            /*
+             * The packed entries (3 LSBytes, MSByte, counter value) sort in the order of the image,
+             * the lowest counter value of a serial number coming first.
+             */
+            std::vector<uint64_t> entries(mEntries);
+            std::sort(entries.begin(), entries.end());
+            entries.erase(std::unique(entries.begin(), entries.end(),
+                                      [](const uint64_t a, const uint64_t b) {
+                                          return (a >> 24) == (b >> 24);
+                                      }),
+                          entries.end());
+
+            /* About 16 bits per entry, i.e. less than 0.5% of false positives with 3 probes */
+            uint8_t bloomBitsLog2 = MIN_BLOOM_BITS_LOG2;
+            while ((static_cast<std::size_t>(1) << bloomBitsLog2) < entries.size() * 16 &&
+                   bloomBitsLog2 < MAX_BLOOM_BITS_LOG2) {
+                bloomBitsLog2++;
+            }
+
+            const std::size_t bloomSize = (static_cast<std::size_t>(1) << bloomBitsLog2) / 8;
+
+            std::vector<uint8_t> image(HEADER_SIZE + bloomSize + entries.size() * ENTRY_SIZE, 0);
+            putUint32(MAGIC, &image[0]);
+            image[4] = FORMAT_VERSION;
+            image[5] = bloomBitsLog2;
+            putUint32(static_cast<uint32_t>(entries.size()), &image[8]);
+
+            uint8_t* const bloom = &image[HEADER_SIZE];
+            uint8_t* entry = bloom + bloomSize;
+            for (const uint64_t e : entries) {
+                const uint32_t lsb = static_cast<uint32_t>(e >> 32);
+                for (int i = 0; i < BLOOM_PROBES; i++) {
+                    const uint32_t bit = bloomBit(lsb, i, bloomBitsLog2);
+                    bloom[bit >> 3] |= static_cast<uint8_t>(1 << (bit & 7));
+                }
+                putUint32(static_cast<uint32_t>((e >> 24 & 0xFF) << 24) | lsb, entry);
+                putUint32(static_cast<uint32_t>(e & MAX_COUNTER), entry + 4);
+                entry += ENTRY_SIZE;
+            }
+
+            return image;
+        }
+
+    private:
+        /**
+         *
+         */
+        static void putUint32(const uint32_t value, uint8_t* const dest)
+        {
+            dest[0] = static_cast<uint8_t>(value);
+            dest[1] = static_cast<uint8_t>(value >> 8);
+            dest[2] = static_cast<uint8_t>(value >> 16);
+            dest[3] = static_cast<uint8_t>(value >> 24);
+        }
+
+        /**
+         *
+         */
+        std::vector<uint64_t> mEntries;
+    };
+
+    /**
+     * Creates an index owning its binary image.
+     *
+     * @param image The binary image produced by Builder::build().
+     * @throw IllegalArgumentException If the image is invalid.
+     * @since 1.5.0
+     */
+    explicit SamRevocationIndex(std::vector<uint8_t>&& image)
+    : mImage(std::move(image))
+    {
+        parse(ByteView(mImage));
+    }
+
+    /**
+     * Creates an index using a binary image stored outside of the instance, for example in a
+     * memory-mapped file.
+     *
+     * <p>The image is not copied: the memory must remain valid and unchanged as long as the index
+     * is used.
+     *
+     * @param image The binary image produced by Builder::build().
+     * @throw IllegalArgumentException If the image is invalid.
+     * @since 1.5.0
+     */
+    explicit SamRevocationIndex(const ByteView image)
+    {
+        parse(image);
+    }
+
+    /**
+     * Not available, to prevent an lvalue vector from being silently converted to a ByteView: use
+     * SamRevocationIndex(std::vector<uint8_t>&&) to move the image into the index, or
+     * SamRevocationIndex(const ByteView) to explicitly use it in place.
+     *
+     * @since 1.5.0
+     */
+    SamRevocationIndex(const std::vector<uint8_t>&) = delete;
+
+    /**
+     *
+     */
+    SamRevocationIndex(const SamRevocationIndex&) = delete;
+
+    /**
+     *
+     */
+    SamRevocationIndex& operator=(const SamRevocationIndex&) = delete;
+
+    /**
+     * Gets the binary image of the index, e.g. to save it in a file.
+     *
+     * @return A view on the image, valid as long as the index.
+     * @since 1.5.0
+     */
+    ByteView getImage() const
+    {
+        return ByteView(mHeader, mSize);
+    }
+
+    /**
+     * Gets the number of revoked SAMs.
+     *
+     * @return A positive or zero value.
+     * @since 1.5.0
+     */
+    int getEntriesNumber() const
+    {
+        return static_cast<int>(mEntriesNumber);
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @throw IllegalArgumentException If the serial number is neither 3 nor 4 bytes long.
+     * @since 1.5.0
+     */
+    bool isSamRevoked(const std::vector<uint8_t>& serialNumber) const override
+    {
+        checkSerialNumber(serialNumber);
+
+        return isRevoked(toUint32(serialNumber.data(), serialNumber.size()),
+                         serialNumber.size() == 3,
+                         NO_COUNTER);
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @throw IllegalArgumentException If the serial number is neither 3 nor 4 bytes long.
+     * @since 1.5.0
+     */
+    bool isSamRevoked(const std::vector<uint8_t>& serialNumber, const int counterValue)
+        const override
+    {
+        checkSerialNumber(serialNumber);
+
+        return isRevoked(toUint32(serialNumber.data(), serialNumber.size()),
+                         serialNumber.size() == 3,
+                         counterValue);
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    bool isSamRevokedBySerial4(const std::array<uint8_t, 4>& serialNumber,
+                               const int counterValue) const override
+    {
+        return isRevoked(toUint32(serialNumber.data(), 4), false, counterValue);
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    bool isSamRevokedBySerial3(const std::array<uint8_t, 3>& serialNumber,
+                               const int counterValue) const override
+    {
+        return isRevoked(toUint32(serialNumber.data(), 3), true, counterValue);
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    void areSamsRevoked(const std::vector<RevocationQuery>& queries,
+                        std::vector<bool>& revoked) const override
+    {
+        revoked.assign(queries.size(), false);
+
+        for (std::size_t i = 0; i < queries.size(); i++) {
+            const RevocationQuery& query = queries[i];
+            revoked[i] = isRevoked(toUint32(query.serialNumber.data(), 4),
+                                   query.isPartialSerialNumber,
+                                   query.counterValue);
+        }
+    }
+
+private:
+    /**
+     *
+     */
+    static const uint32_t MAGIC = 0x49565253; /* "SRVI" */
+
+    /**
+     *
+     */
+    static const std::size_t HEADER_SIZE = 16;
+
+    /**
+     *
+     */
+    static const std::size_t ENTRY_SIZE = 8;
+
+    /**
+     *
+     */
+    static const int BLOOM_PROBES = 3;
+
+    /**
+     *
+     */
+    static const uint8_t MIN_BLOOM_BITS_LOG2 = 6;
+
+    /**
+     *
+     */
+    static const uint8_t MAX_BLOOM_BITS_LOG2 = 28;
+
+    /**
+     *
+     */
+    static const uint32_t LSB_MASK = 0xFFFFFF;
+
+    /**
+     *
+     */
+    static const int MAX_COUNTER = 0xFFFFFF;
+
+    /**
+     *
+     */
+    static const int NO_COUNTER = RevocationQuery::NO_COUNTER;
+
+    /**
+     * Big-endian serial number to integer.
+     */
+    static uint32_t toUint32(const uint8_t* const serialNumber, const std::size_t length)
+    {
+        uint32_t value = 0;
+        for (std::size_t i = 0; i < length; i++) {
+            value = (value << 8) | serialNumber[i];
+        }
+
+        return value;
+    }
+
+    /**
+     * Little-endian image field to integer.
+     */
+    static uint32_t getUint32(const uint8_t* const src)
+    {
+        return static_cast<uint32_t>(src[0]) |
+               static_cast<uint32_t>(src[1]) << 8 |
+               static_cast<uint32_t>(src[2]) << 16 |
+               static_cast<uint32_t>(src[3]) << 24;
+    }
+
+    /**
+     * Index of the i-th bit of the Bloom filter for the provided 3 LSBytes (double hashing).
+     */
+    static uint32_t bloomBit(const uint32_t lsb, const int i, const uint8_t bloomBitsLog2)
+    {
+        const uint64_t h = (static_cast<uint64_t>(lsb) + 1) * 0x9E3779B97F4A7C15ULL;
+        const uint32_t h1 = static_cast<uint32_t>(h >> 32);
+        const uint32_t h2 = static_cast<uint32_t>(h) | 1;
+
+        return (h1 + static_cast<uint32_t>(i) * h2) &
+               ((static_cast<uint32_t>(1) << bloomBitsLog2) - 1);
+    }
+
+    /**
+     *
+     */
+    static void checkSerialNumber(const std::vector<uint8_t>& serialNumber)
+    {
+        if (serialNumber.size() != 3 && serialNumber.size() != 4) {
+            throw IllegalArgumentException("The SAM serial number must be 3 or 4 bytes long.");
+        }
+    }
+
+    /**
+     *
+     */
+    void parse(const ByteView image)
+    {
+        if (image.size() < HEADER_SIZE || getUint32(image.data()) != MAGIC ||
+            image[4] != FORMAT_VERSION || image[5] < MIN_BLOOM_BITS_LOG2 ||
+            image[5] > MAX_BLOOM_BITS_LOG2) {
+            throw IllegalArgumentException("Invalid SAM revocation index header.");
+        }
+
+        mHeader = image.data();
+        mSize = image.size();
+        mBloomBitsLog2 = image[5];
+        mEntriesNumber = getUint32(mHeader + 8);
+        mBloom = mHeader + HEADER_SIZE;
+        mEntries = mBloom + ((static_cast<std::size_t>(1) << mBloomBitsLog2) / 8);
+
+        if (static_cast<std::size_t>(mHeader + mSize - mEntries) / ENTRY_SIZE < mEntriesNumber ||
+            mEntries + mEntriesNumber * ENTRY_SIZE != mHeader + mSize) {
+            throw IllegalArgumentException("Invalid SAM revocation index size.");
+        }
+    }
+
+    /**
+     *
+     */
+    bool isRevoked(const uint32_t serialNumber, const bool isPartial, const int counterValue) const
+    {
+        const uint32_t lsb = serialNumber & LSB_MASK;
+
+        for (int i = 0; i < BLOOM_PROBES; i++) {
+            const uint32_t bit = bloomBit(lsb, i, mBloomBitsLog2);
+            if ((mBloom[bit >> 3] & (1 << (bit & 7))) == 0) {
+                return false;
+            }
+        }
+
+        /* Lower bound of the 3 LSBytes */
+        std::size_t low = 0;
+        std::size_t high = mEntriesNumber;
+        while (low < high) {
+            const std::size_t mid = low + (high - low) / 2;
+            if ((getUint32(mEntries + mid * ENTRY_SIZE) & LSB_MASK) < lsb) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+
+        for (const uint8_t* entry = mEntries + low * ENTRY_SIZE;
+             entry < mEntries + mEntriesNumber * ENTRY_SIZE;
+             entry += ENTRY_SIZE) {
+            const uint32_t entrySerialNumber = getUint32(entry);
+            if ((entrySerialNumber & LSB_MASK) != lsb) {
+                break;
+            }
+
+            if ((isPartial || entrySerialNumber == serialNumber) &&
+                (counterValue == NO_COUNTER ||
+                 static_cast<uint32_t>(counterValue) >= getUint32(entry + 4))) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     *
+     */
+    const std::vector<uint8_t> mImage;
+
+    /**
+     *
+     */
+    const uint8_t* mHeader;
+
+    /**
+     *
+     */
+    std::size_t mSize;
+
+    /**
+     *
+     */
+    uint8_t mBloomBitsLog2;
+
+    /**
+     *
+     */
+    uint32_t mEntriesNumber;
+
+    /**
+     *
+     */
+    const uint8_t* mBloom;
+
+    /**
+     *
+     */
+    const uint8_t* mEntries;
+};
+
+}
+}
+}
+}
@@ -12,6 +12,9 @@
 
 #pragma once
 
+/* Calypsonet Terminal Calypso */
+#include "CommonSecuritySetting.h"
+
 namespace calypsonet {
 namespace terminal {
 namespace calypso {
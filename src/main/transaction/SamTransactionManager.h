@@ -12,10 +12,17 @@
 
 #pragma once
 
+#include <memory>
+#include <vector>
+
 /* Calypsonet Terminal Calypso */
+#include "BasicSignatureComputationData.h"
 #include "CalypsoSam.h"
 #include "CommonTransactionManager.h"
+#include "SamRevocationServiceSpi.h"
 #include "SamSecuritySetting.h"
+#include "SignatureBatchOutput.h"
+#include "TraceableSignatureComputationData.h"
 
 /* Calypsonet Terminal Reader */
 #include "CardReader.h"
@@ -26,6 +33,7 @@ namespace calypso {
 namespace transaction {
 
 using namespace calypsonet::terminal::calypso::sam;
+using namespace calypsonet::terminal::calypso::spi;
 using namespace calypsonet::terminal::reader;
 
 /**
@@ -75,6 +83,72 @@ public:
      * @since 1.2.0
      */
     virtual const std::shared_ptr<CalypsoSam> getCalypsoSam() const = 0;
+
+    /**
+     * Schedules the computation of a batch of basic signatures ("Data Cipher" SAM commands).
+     *
+     * <p>Unlike prepareComputeSignature(const any), the requests are provided at once and the
+     * results are not stored in the request objects but in the provided output, at the index of
+     * their request, once processCommands() has been invoked. The request objects are therefore
+     * only read and may be reused for the next batch.
+     *
+     * <p>In order to reduce the number of exchanges with the SAM, the commands are sent in as few
+     * card requests as possible and the requests sharing the same key diversifier are grouped, so
+     * that a single "Select Diversifier" command is sent for each group. The order of the
+     * processing of the requests is thus not guaranteed.
+     *
+     * @param data The signature computation requests.
+     * @param output The buffer receiving the signatures, which is reset by this method.
+     * @return The current instance.
+     * @throw IllegalArgumentException If the list is empty, contains a null or inconsistent
+     *        request or exceeds the capacity of the output.
+     * @see SignatureBatchOutput
+     * @since 1.5.0
+     */
+    virtual SamTransactionManager& prepareComputeSignatures(
+        const std::vector<std::shared_ptr<BasicSignatureComputationData>>& data,
+        SignatureBatchOutput& output) = 0;
+
+    /**
+     * Schedules the computation of a batch of traceable signatures ("PSO Compute Signature" SAM
+     * commands).
+     *
+     * <p>The behavior is the same as for prepareComputeSignatures(const
+     * std::vector<std::shared_ptr<BasicSignatureComputationData>>&, SignatureBatchOutput&); the
+     * output also receives the signed data of each request.
+     *
+     * @param data The signature computation requests.
+     * @param output The buffer receiving the signatures and the signed data, which is reset by this
+     *        method.
+     * @return The current instance.
+     * @throw IllegalArgumentException If the list is empty, contains a null or inconsistent
+     *        request or exceeds the capacity of the output (number of requests or size of the
+     *        data to sign).
+     * @see SignatureBatchOutput
+     * @since 1.5.0
+     */
+    virtual SamTransactionManager& prepareComputeSignatures(
+        const std::vector<std::shared_ptr<TraceableSignatureComputationData>>& data,
+        SignatureBatchOutput& output) = 0;
+
+    /**
+     * Checks the revocation status of a batch of SAMs with the revocation service registered in
+     * the security settings, in a single invocation of the service.
+     *
+     * <p>This is typically used before verifying a large set of traceable signatures, the
+     * signatures of the revoked SAMs being then discarded without any SAM command.
+     *
+     * @param queries The SAMs to check.
+     * @param revoked The output receiving true for each revoked SAM, at the index of its query.
+     * @return The current instance.
+     * @throw IllegalStateException If no revocation service is registered (see
+     *        CommonSecuritySetting::setSamRevocationService()).
+     * @see SamRevocationServiceSpi::areSamsRevoked()
+     * @since 1.5.0
+     */
+    virtual SamTransactionManager& areSamsRevoked(
+        const std::vector<SamRevocationServiceSpi::RevocationQuery>& queries,
+        std::vector<bool>& revoked) = 0;
 };
 
 }
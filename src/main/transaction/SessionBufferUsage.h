@@ -0,0 +1,89 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <vector>
+
+namespace calypsonet {
+namespace terminal {
+namespace calypso {
+namespace transaction {
+
+/**
+ * Prediction of the use of the card session buffer by the prepared commands, provided by
+ * CardTransactionManager::getSessionBufferUsage().
+ *
+ * <p>Depending on the card, the session buffer is managed either in number of bytes or in number
+ * of modifying commands (see CalypsoCard::getSessionModification()). All the budgets are
+ * expressed in this unit.
+ *
+ * @since 1.5.0
+ */
+class SessionBufferUsage {
+public:
+    /**
+     *
+     */
+    virtual ~SessionBufferUsage() = default;
+
+    /**
+     * Indicates if the budgets are expressed in number of bytes or in number of commands.
+     *
+     * @return True if the budgets are expressed in number of bytes.
+     * @since 1.5.0
+     */
+    virtual bool isExpressedInBytes() const = 0;
+
+    /**
+     * Gets the capacity of the session buffer of the card.
+     *
+     * @return A positive value.
+     * @since 1.5.0
+     */
+    virtual int getSessionBufferSize() const = 0;
+
+    /**
+     * Gets the budget consumed by each prepared command, in the order of preparation.
+     *
+     * @return A not null list containing one entry per prepared command (0 for the commands which
+     *         do not modify the card).
+     * @since 1.5.0
+     */
+    virtual const std::vector<int>& getCommandBudgets() const = 0;
+
+    /**
+     * Gets the number of secure sessions needed to execute the prepared commands.
+     *
+     * <p>A value greater than 1 means that the execution will either fail with a
+     * SessionBufferOverflowException or be split into several sessions, depending on whether the
+     * multiple session mode is enabled or not (see CardSecuritySetting::enableMultipleSession()).
+     *
+     * @return 0 if no secure session is involved, a positive value otherwise.
+     * @since 1.5.0
+     */
+    virtual int getPredictedSessionsNumber() const = 0;
+
+    /**
+     * Gets the budget left in the last predicted session once all the prepared commands are
+     * executed.
+     *
+     * @return A positive or zero value.
+     * @since 1.5.0
+     */
+    virtual int getRemainingBudget() const = 0;
+};
+
+}
+}
+}
+}
@@ -0,0 +1,216 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <string>
+
+/* Calypsonet Terminal Calypso */
+#include "ByteView.h"
+#include "RecordStore.h"
+
+/* Keyple Core Util */
+#include "IllegalArgumentException.h"
+#include "IndexOutOfBoundsException.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace calypso {
+namespace transaction {
+
+using namespace calypsonet::terminal::calypso;
+using namespace calypsonet::terminal::calypso::card;
+using namespace keyple::core::util::cpp::exception;
+
+/**
+ * Preallocated buffer receiving the results of a batch of signature computations (see
+ * SamTransactionManager::prepareComputeSignatures()).
+ *
+ * <p>The result of the request at index i of the batch is stored in slot i: the signature (1 to
+ * 8 bytes) and, for a TraceableSignatureComputationData, the signed data. All the slots are
+ * allocated at construction, so that a buffer reused from one batch to another does not allocate
+ * memory as long as the batches fit in its capacity.
+ *
+ * <p>The views returned by the getters remain valid until the next modification of the buffer.
+ *
+ * @since 1.5.0
+ */
+class SignatureBatchOutput final {
+public:
+    /**
+     * Maximum size of a signature.
+     *
+     * @since 1.5.0
+     */
+    static const int MAX_SIGNATURE_SIZE = 8;
+
+    /**
+     * Creates a buffer.
+     *
+     * @param capacity The maximum number of requests of a batch (should be {@code >=} 1).
+     * @param maxSignedDataSize The maximum size of the data to sign (0 if only basic signatures
+     *        are computed).
+     * @throw IllegalArgumentException If one of the arguments is out of range.
+     * @since 1.5.0
+     */
+    SignatureBatchOutput(const int capacity, const int maxSignedDataSize)
+    : mCapacity(capacity), mSize(0)
+    {
+        if (capacity < 1 || maxSignedDataSize < 0) {
+            throw IllegalArgumentException("Invalid signature batch output dimensions.");
+        }
+
+        mSignatures.resize(capacity, MAX_SIGNATURE_SIZE);
+        mSignedData.resize(capacity, maxSignedDataSize);
+    }
+
+    /**
+     * Gets the maximum number of requests of a batch.
+     *
+     * @return A positive value.
+     * @since 1.5.0
+     */
+    int getCapacity() const
+    {
+        return mCapacity;
+    }
+
+    /**
+     * Gets the number of slots of the current batch.
+     *
+     * @return 0 if no batch has been processed since the last clear().
+     * @since 1.5.0
+     */
+    int getSize() const
+    {
+        return mSize;
+    }
+
+    /**
+     * Gets the signature computed for a request.
+     *
+     * @param index The index of the request in the batch.
+     * @return A not empty view.
+     * @throw IndexOutOfBoundsException If the index is out of range or if the signature has not
+     *        been computed.
+     * @since 1.5.0
+     */
+    ByteView getSignature(const int index) const
+    {
+        checkIndex(index);
+
+        const ByteView signature = mSignatures.getRecord(index + 1);
+        if (signature.empty()) {
+            throw IndexOutOfBoundsException("No signature computed at index " +
+                                            std::to_string(index));
+        }
+
+        return signature;
+    }
+
+    /**
+     * Gets the signed data of a traceable signature request.
+     *
+     * @param index The index of the request in the batch.
+     * @return An empty view for a basic signature request.
+     * @throw IndexOutOfBoundsException If the index is out of range.
+     * @since 1.5.0
+     */
+    ByteView getSignedData(const int index) const
+    {
+        checkIndex(index);
+
+        return mSignedData.getRecord(index + 1);
+    }
+
+    /**
+     * Prepares the buffer for a new batch of the provided size, all the slots being empty.
+     *
+     * <p>This method is invoked by the transaction manager when the batch is prepared.
+     *
+     * @param size The number of requests of the batch.
+     * @throw IllegalArgumentException If the size exceeds the capacity.
+     * @since 1.5.0
+     */
+    void reset(const int size)
+    {
+        if (size < 0 || size > mCapacity) {
+            throw IllegalArgumentException("The batch exceeds the capacity of the output.");
+        }
+
+        mSignatures.clear();
+        mSignedData.clear();
+        mSize = size;
+    }
+
+    /**
+     * Stores the result of a request.
+     *
+     * <p>This method is invoked by the transaction manager when the batch is processed.
+     *
+     * @param index The index of the request in the batch.
+     * @param signature The signature (1 to MAX_SIGNATURE_SIZE bytes).
+     * @param signedData The signed data (empty for a basic signature).
+     * @throw IndexOutOfBoundsException If the index is out of range.
+     * @throw IllegalArgumentException If the signature or the signed data is too long.
+     * @since 1.5.0
+     */
+    void setResult(const int index, const ByteView& signature, const ByteView& signedData)
+    {
+        checkIndex(index);
+
+        if (signature.empty() || static_cast<int>(signature.size()) > MAX_SIGNATURE_SIZE ||
+            static_cast<int>(signedData.size()) > mSignedData.getRecordSize()) {
+            throw IllegalArgumentException("The result does not fit in the output.");
+        }
+
+        mSignatures.setRecord(index + 1, signature);
+        mSignedData.setRecord(index + 1, signedData);
+    }
+
+private:
+    /**
+     *
+     */
+    void checkIndex(const int index) const
+    {
+        if (index < 0 || index >= mSize) {
+            throw IndexOutOfBoundsException("Index " + std::to_string(index) +
+                                            " out of the batch bounds.");
+        }
+    }
+
+    /**
+     *
+     */
+    const int mCapacity;
+
+    /**
+     *
+     */
+    int mSize;
+
+    /**
+     *
+     */
+    RecordStore mSignatures;
+
+    /**
+     *
+     */
+    RecordStore mSignedData;
+};
+
+}
+}
+}
+}
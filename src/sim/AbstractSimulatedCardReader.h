@@ -0,0 +1,270 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/* Calypsonet Terminal Calypso */
+#include "ByteView.h"
+
+/* Calypsonet Terminal Card */
+#include "ApduRequestSpi.h"
+#include "ApduResponseApi.h"
+#include "CardBrokenCommunicationException.h"
+#include "CardRequestSpi.h"
+#include "CardResponseApi.h"
+#include "ChannelControl.h"
+#include "ProxyReaderApi.h"
+#include "UnexpectedStatusWordException.h"
+
+/* Calypsonet Terminal Reader */
+#include "CardReader.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace calypso {
+namespace sim {
+
+using namespace calypsonet::terminal::calypso;
+using namespace calypsonet::terminal::card;
+using namespace calypsonet::terminal::card::spi;
+using namespace calypsonet::terminal::reader;
+
+/**
+ * Base of the simulated readers, implementing the ProxyReaderApi through which the transaction
+ * layer exchanges with the card or the SAM.
+ *
+ * <p>The transaction managers of the Calypso extension do not exchange APDU by APDU: they get
+ * the ProxyReaderApi of the reader provided by the application (by a dynamic cast of the
+ * CardReader) and transmit CardRequestSpi objects. This class implements
+ * transmitCardRequest() on top of the APDU level transmitApdu() of the concrete reader, with the
+ * behavior of a local reader:
+ *
+ * <ul>
+ *   <li>The APDUs of the request are transmitted in order, and a CardResponseApi containing one
+ *       ApduResponseApi per transmitted APDU is returned.
+ *   <li>If the request must stop on an unsuccessful status word, the first status word which is
+ *       not one of ApduRequestSpi::getSuccessfulStatusWords() raises an
+ *       UnexpectedStatusWordException containing the responses received so far.
+ *   <li>If no card is present, a CardBrokenCommunicationException is raised.
+ *   <li>The logical channel is opened by the first request and closed by a request with
+ *       ChannelControl::CLOSE_AFTER or by releaseChannel().
+ * </ul>
+ *
+ * <p>This class is not thread-safe.
+ *
+ * @since 1.5.0
+ */
+class AbstractSimulatedCardReader : public CardReader, public ProxyReaderApi {
+public:
+    /**
+     *
+     */
+    virtual ~AbstractSimulatedCardReader() = default;
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    const std::string& getName() const override
+    {
+        return mName;
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    bool isContactless() override
+    {
+        return mContactless;
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    const std::shared_ptr<CardResponseApi> transmitCardRequest(
+        const std::shared_ptr<CardRequestSpi> cardRequest,
+        const ChannelControl channelControl) override
+    {
+        auto cardResponse = std::make_shared<SimulatedCardResponse>();
+        const std::vector<std::shared_ptr<ApduRequestSpi>>& apduRequests =
+            cardRequest->getApduRequests();
+
+        if (!isCardPresent()) {
+            mLogicalChannelOpen = false;
+            throw CardBrokenCommunicationException(cardResponse,
+                                                   false,
+                                                   "No card present in reader " + mName);
+        }
+
+        mLogicalChannelOpen = true;
+        cardResponse->mLogicalChannelOpen = true;
+
+        for (std::size_t i = 0; i < apduRequests.size(); i++) {
+            auto apduResponse = std::make_shared<SimulatedApduResponse>();
+            transmitApdu(apduRequests[i]->getApdu(), apduResponse->mApdu);
+            cardResponse->mApduResponses.push_back(apduResponse);
+
+            if (cardRequest->stopOnUnsuccessfulStatusWord() &&
+                !isSuccessful(*apduRequests[i], apduResponse->getStatusWord())) {
+                throw UnexpectedStatusWordException(cardResponse,
+                                                    i + 1 == apduRequests.size(),
+                                                    "Unexpected status word in reader " + mName);
+            }
+        }
+
+        if (channelControl == ChannelControl::CLOSE_AFTER) {
+            releaseChannel();
+            cardResponse->mLogicalChannelOpen = false;
+        }
+
+        return cardResponse;
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    void releaseChannel() override
+    {
+        mLogicalChannelOpen = false;
+    }
+
+    /**
+     * Indicates if the logical channel is open.
+     *
+     * @return True if a request has been transmitted since the channel was last closed.
+     * @since 1.5.0
+     */
+    bool isLogicalChannelOpen() const
+    {
+        return mLogicalChannelOpen;
+    }
+
+    /**
+     * Transmits an APDU to the card.
+     *
+     * @param apdu The command APDU.
+     * @param response The buffer receiving the response APDU (data and status word).
+     * @since 1.5.0
+     */
+    virtual void transmitApdu(const ByteView& apdu, std::vector<uint8_t>& response) = 0;
+
+protected:
+    /**
+     * Creates a reader whose logical channel is closed.
+     *
+     * @param name The name of the reader.
+     * @param contactless True if the reader must be reported as contactless.
+     * @since 1.5.0
+     */
+    AbstractSimulatedCardReader(const std::string& name, const bool contactless)
+    : mName(name), mContactless(contactless), mLogicalChannelOpen(false) {}
+
+    /**
+     *
+     */
+    const std::string mName;
+
+private:
+    /**
+     * Response to an APDU, owning the received bytes.
+     */
+    class SimulatedApduResponse final : public ApduResponseApi {
+    public:
+        const std::vector<uint8_t>& getApdu() const override
+        {
+            return mApdu;
+        }
+
+        const std::vector<uint8_t> getDataOut() const override
+        {
+            return mApdu.size() < 2 ? std::vector<uint8_t>()
+                                    : std::vector<uint8_t>(mApdu.begin(), mApdu.end() - 2);
+        }
+
+        int getStatusWord() const override
+        {
+            return mApdu.size() < 2 ? 0 : (mApdu[mApdu.size() - 2] << 8) | mApdu.back();
+        }
+
+        /**
+         *
+         */
+        std::vector<uint8_t> mApdu;
+    };
+
+    /**
+     * Response to a card request.
+     */
+    class SimulatedCardResponse final : public CardResponseApi {
+    public:
+        SimulatedCardResponse() : mLogicalChannelOpen(false) {}
+
+        const std::vector<std::shared_ptr<ApduResponseApi>>& getApduResponses() const override
+        {
+            return mApduResponses;
+        }
+
+        bool isLogicalChannelOpen() const override
+        {
+            return mLogicalChannelOpen;
+        }
+
+        /**
+         *
+         */
+        std::vector<std::shared_ptr<ApduResponseApi>> mApduResponses;
+
+        /**
+         *
+         */
+        bool mLogicalChannelOpen;
+    };
+
+    /**
+     * Indicates if a status word is one of the successful status words of a request.
+     */
+    static bool isSuccessful(const ApduRequestSpi& apduRequest, const int statusWord)
+    {
+        const std::vector<int>& successfulStatusWords = apduRequest.getSuccessfulStatusWords();
+
+        return std::find(successfulStatusWords.begin(), successfulStatusWords.end(), statusWord) !=
+               successfulStatusWords.end();
+    }
+
+    /**
+     *
+     */
+    const bool mContactless;
+
+    /**
+     *
+     */
+    bool mLogicalChannelOpen;
+};
+
+}
+}
+}
+}
@@ -0,0 +1,1388 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+/* Calypsonet Terminal Calypso */
+#include "ByteView.h"
+#include "DirectoryHeader.h"
+#include "ElementaryFile.h"
+#include "FileHeader.h"
+#include "RecordStore.h"
+#include "SimulatedSessionMac.h"
+#include "SimulatedSmartCard.h"
+#include "WriteAccessLevel.h"
+
+/* Keyple Core Util */
+#include "IllegalArgumentException.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace calypso {
+namespace sim {
+
+using namespace calypsonet::terminal::calypso;
+using namespace calypsonet::terminal::calypso::card;
+using namespace keyple::core::util::cpp::exception;
+
+/**
+ * Calypso Prime Revision 3 card simulated in the process, for load testing and profiling of a
+ * transaction stack without any physical reader.
+ *
+ * <p>The file structure is built from a DirectoryHeader and from the FileHeader of each EF; the
+ * content of the files is held in RecordStore instances, all the records being initialized with
+ * zeros. The simulator supports:
+ *
+ * <ul>
+ *   <li>Select Application, Select File (by LID, first EF, next EF and current DF), Get
+ *       Challenge.
+ *   <li>Read Record(s), Read Binary, Update/Write/Append Record, Update/Write Binary.
+ *   <li>Increase/Decrease (single and multiple) on Counters files.
+ *   <li>Open/Close Secure Session (revision 3 format), including the abort of the session, the
+ *       ratification and the session buffer limit (in bytes, each modifying command consuming Lc +
+ *       6 bytes), with the rollback of all the modifications if the session is not closed
+ *       successfully.
+ *   <li>SV Get, SV Reload and SV Debit, the logs having the layout exposed by SvLoadLogRecord and
+ *       SvDebitLogRecord.
+ *   <li>Invalidate and Rehabilitate.
+ * </ul>
+ *
+ * <p>Access conditions are not checked and the session is signed with SimulatedSessionMac using
+ * the key derived from the master key, the KIF/KVC of the session and the serial number. A
+ * CalypsoSamSimulator built with the same master key is therefore able to open and close
+ * sessions with this card.
+ *
+ * <p>Once the card is set up, the processing of an APDU does not allocate memory, so that
+ * thousands of transactions per second can be run on a single core.
+ *
+ * <p>This class is not thread-safe.
+ *
+ * @since 1.5.0
+ */
+class CalypsoCardSimulator final : public SimulatedSmartCard {
+public:
+    /**
+     * Creates a card with an empty file structure and the SV feature disabled.
+     *
+     * <p>The default startup information announces a session buffer of 430 bytes (index 0x0A).
+     *
+     * @param dfName The DF name of the application (5 to 16 bytes).
+     * @param serialNumber The application serial number (8 bytes).
+     * @param directoryHeader The header of the application DF.
+     * @param masterKey The master key from which the session keys are derived.
+     * @throw IllegalArgumentException If one of the arguments is null or out of range.
+     * @since 1.5.0
+     */
+    CalypsoCardSimulator(const std::vector<uint8_t>& dfName,
+                         const std::vector<uint8_t>& serialNumber,
+                         const std::shared_ptr<DirectoryHeader> directoryHeader,
+                         const uint64_t masterKey)
+    : mDfName(dfName),
+      mSerialNumber(serialNumber),
+      mDirectoryHeader(directoryHeader),
+      mMasterKey(masterKey),
+      mStartupInfo({0x0A, 0x3C, 0x20, 0x05, 0x14, 0x10, 0x01}),
+      mSessionBufferSize(0),
+      mSessionBufferUsed(0),
+      mSessionOpen(false),
+      mRatified(true),
+      mRatificationPending(false),
+      mTransactionCounter(0x00FFFF),
+      mCurrentFile(NO_FILE),
+      mSvEnabled(false),
+      mSvOperationAllowed(false),
+      mRandom(0x9E3779B97F4A7C15ULL)
+    {
+        if (dfName.size() < 5 || dfName.size() > 16) {
+            throw IllegalArgumentException("The DF name must be 5 to 16 bytes long.");
+        }
+
+        if (serialNumber.size() != 8) {
+            throw IllegalArgumentException("The serial number must be 8 bytes long.");
+        }
+
+        if (directoryHeader == nullptr) {
+            throw IllegalArgumentException("The directory header must not be null.");
+        }
+
+        mSfiIndex.fill(static_cast<int>(NO_FILE));
+        mSessionBufferSize = computeSessionBufferSize(mStartupInfo[0]);
+
+        for (const uint8_t b : serialNumber) {
+            mRandom = (mRandom ^ b) * 0x00000100000001B3ULL;
+        }
+
+        mState.loadLog.resize(1, SV_LOAD_LOG_SIZE);
+        mState.loadLog.setRecord(1, std::vector<uint8_t>(SV_LOAD_LOG_SIZE));
+        mState.debitLog.resize(SV_DEBIT_LOGS_NUMBER, SV_DEBIT_LOG_SIZE);
+        for (int i = 1; i <= SV_DEBIT_LOGS_NUMBER; i++) {
+            mState.debitLog.setRecord(i, std::vector<uint8_t>(SV_DEBIT_LOG_SIZE));
+        }
+    }
+
+    /**
+     * Sets the startup information returned in the FCI (7 bytes: session modification, platform,
+     * application type, application subtype, software issuer, software version, software
+     * revision).
+     *
+     * <p>The SV bit of the application type is managed by enableSv(int).
+     *
+     * @param startupInfo The startup information.
+     * @return The current instance.
+     * @throw IllegalArgumentException If the length or the session modification byte is invalid.
+     * @since 1.5.0
+     */
+    CalypsoCardSimulator& setStartupInfo(const std::vector<uint8_t>& startupInfo)
+    {
+        if (startupInfo.size() != 7) {
+            throw IllegalArgumentException("The startup information must be 7 bytes long.");
+        }
+
+        mSessionBufferSize = computeSessionBufferSize(startupInfo[0]);
+        mStartupInfo = startupInfo;
+        setSvBit();
+
+        return *this;
+    }
+
+    /**
+     * Adds an EF to the application, all its records being set to zeros.
+     *
+     * @param sfi The SFI of the EF (1 to 30).
+     * @param header The header of the EF.
+     * @return The current instance.
+     * @throw IllegalArgumentException If the SFI is out of range or already used, if the header
+     *        is null or if its record size exceeds 250 bytes.
+     * @since 1.5.0
+     */
+    CalypsoCardSimulator& addFile(const uint8_t sfi, const std::shared_ptr<FileHeader> header)
+    {
+        if (sfi < 1 || sfi > 30 || mSfiIndex[sfi] != NO_FILE) {
+            throw IllegalArgumentException("The SFI is out of range or already used.");
+        }
+
+        if (header == nullptr) {
+            throw IllegalArgumentException("The file header must not be null.");
+        }
+
+        if (header->getRecordSize() > MAX_RECORD_SIZE) {
+            throw IllegalArgumentException("The record size must not exceed 250 bytes.");
+        }
+
+        SimulatedFile file;
+        file.sfi = sfi;
+        file.header = header;
+        file.journaled = false;
+
+        const int recordsNumber = header->getRecordsNumber();
+        const int recordSize = header->getRecordSize();
+        const std::vector<uint8_t> zeros(recordSize);
+        file.records.resize(recordsNumber, recordSize);
+        for (int i = 1; i <= recordsNumber; i++) {
+            file.records.setRecord(i, zeros);
+        }
+        file.backup = file.records;
+
+        mSfiIndex[sfi] = static_cast<int>(mFiles.size());
+        mFiles.push_back(std::move(file));
+
+        return *this;
+    }
+
+    /**
+     * Sets the content of a record of an EF.
+     *
+     * @param sfi The SFI of the EF.
+     * @param numRecord The record number (1 for a Binary or a Counters file).
+     * @param content The content, not longer than the record size.
+     * @return The current instance.
+     * @throw IllegalArgumentException If the EF or the record does not exist, or if the content
+     *        is too long.
+     * @since 1.5.0
+     */
+    CalypsoCardSimulator& setRecord(const uint8_t sfi, const int numRecord, const ByteView& content)
+    {
+        SimulatedFile& file = getFile(sfi);
+        if (!file.records.hasRecord(numRecord) ||
+            static_cast<int>(content.size()) > file.records.getRecordSize()) {
+            throw IllegalArgumentException("The record does not exist or the content is too long.");
+        }
+
+        file.records.setRecordPart(numRecord, 0, content);
+
+        return *this;
+    }
+
+    /**
+     * Gets the current content of a record of an EF.
+     *
+     * @param sfi The SFI of the EF.
+     * @param numRecord The record number.
+     * @return A view valid until the next modification of the EF.
+     * @throw IllegalArgumentException If the EF does not exist.
+     * @since 1.5.0
+     */
+    ByteView getRecord(const uint8_t sfi, const int numRecord)
+    {
+        return getFile(sfi).records.getRecord(numRecord);
+    }
+
+    /**
+     * Enables the SV feature with the provided balance.
+     *
+     * @param balance The initial balance.
+     * @return The current instance.
+     * @since 1.5.0
+     */
+    CalypsoCardSimulator& enableSv(const int balance)
+    {
+        mSvEnabled = true;
+        mState.balance = balance;
+        setSvBit();
+
+        return *this;
+    }
+
+    /**
+     * Sets the value of the transaction counter, decremented at each session opening.
+     *
+     * @param transactionCounter The value (0 to 16777215).
+     * @return The current instance.
+     * @since 1.5.0
+     */
+    CalypsoCardSimulator& setTransactionCounter(const int transactionCounter)
+    {
+        mTransactionCounter = transactionCounter & 0xFFFFFF;
+
+        return *this;
+    }
+
+    /**
+     * @return The current value of the transaction counter.
+     * @since 1.5.0
+     */
+    int getTransactionCounter() const
+    {
+        return mTransactionCounter;
+    }
+
+    /**
+     * @return The current SV balance.
+     * @since 1.5.0
+     */
+    int getSvBalance() const
+    {
+        return mState.balance;
+    }
+
+    /**
+     * @return The current SV transaction number.
+     * @since 1.5.0
+     */
+    int getSvTNum() const
+    {
+        return mState.tNum;
+    }
+
+    /**
+     * @return The size of the session buffer in bytes.
+     * @since 1.5.0
+     */
+    int getSessionBufferSize() const
+    {
+        return mSessionBufferSize;
+    }
+
+    /**
+     * @return True if a secure session is open.
+     * @since 1.5.0
+     */
+    bool isSessionOpen() const
+    {
+        return mSessionOpen;
+    }
+
+    /**
+     * @return True if the last session has been ratified.
+     * @since 1.5.0
+     */
+    bool isDfRatified() const
+    {
+        return mRatified;
+    }
+
+    /**
+     * @return True if the application is invalidated.
+     * @since 1.5.0
+     */
+    bool isDfInvalidated() const
+    {
+        return mState.dfInvalidated;
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    void processApdu(const ByteView& apdu, std::vector<uint8_t>& response) override
+    {
+        response.clear();
+
+        Command command;
+        uint16_t sw;
+        if (!parse(apdu, command)) {
+            sw = SW_WRONG_LENGTH;
+        } else {
+            if (mRatificationPending) {
+                mRatificationPending = false;
+                mRatified = true;
+            }
+
+            sw = dispatch(command, response);
+        }
+
+        if (sw != SW_SUCCESS && sw != SW_INVALIDATED) {
+            response.clear();
+        }
+
+        response.push_back(static_cast<uint8_t>(sw >> 8));
+        response.push_back(static_cast<uint8_t>(sw));
+
+        if (mSessionOpen && command.ins != INS_OPEN_SESSION && command.ins != INS_CLOSE_SESSION) {
+            mMac.update(apdu);
+            mMac.update(response);
+        }
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * <p>An open session is aborted and the pending ratification is lost.
+     *
+     * @since 1.5.0
+     */
+    void reset() override
+    {
+        if (mSessionOpen) {
+            rollback();
+        }
+
+        mRatificationPending = false;
+        mCurrentFile = NO_FILE;
+        mSvOperationAllowed = false;
+    }
+
+private:
+    /**
+     *
+     */
+    struct Command {
+        uint8_t ins = 0;
+        uint8_t p1 = 0;
+        uint8_t p2 = 0;
+        ByteView data;
+        int le = -1;
+    };
+
+    /**
+     *
+     */
+    struct SimulatedFile {
+        uint8_t sfi;
+        std::shared_ptr<FileHeader> header;
+        RecordStore records;
+        RecordStore backup;
+        bool journaled;
+    };
+
+    /**
+     * The part of the application state saved at the opening of a session, besides the EFs.
+     */
+    struct ApplicationState {
+        int balance = 0;
+        int tNum = 0;
+        RecordStore loadLog;
+        RecordStore debitLog;
+        bool dfInvalidated = false;
+    };
+
+    /**
+     *
+     */
+    static const int NO_FILE = -1;
+    static const int SV_LOAD_LOG_SIZE = 22;
+    static const int SV_DEBIT_LOG_SIZE = 19;
+    static const int SV_DEBIT_LOGS_NUMBER = 3;
+    static const int MAX_RECORD_SIZE = 250;
+
+    /**
+     *
+     */
+    static const uint8_t INS_INVALIDATE = 0x04;
+    static const uint8_t INS_DECREASE = 0x30;
+    static const uint8_t INS_INCREASE = 0x32;
+    static const uint8_t INS_DECREASE_MULTIPLE = 0x38;
+    static const uint8_t INS_INCREASE_MULTIPLE = 0x3A;
+    static const uint8_t INS_REHABILITATE = 0x44;
+    static const uint8_t INS_SV_GET = 0x7C;
+    static const uint8_t INS_GET_CHALLENGE = 0x84;
+    static const uint8_t INS_OPEN_SESSION = 0x8A;
+    static const uint8_t INS_CLOSE_SESSION = 0x8E;
+    static const uint8_t INS_SELECT = 0xA4;
+    static const uint8_t INS_READ_BINARY = 0xB0;
+    static const uint8_t INS_READ_RECORD = 0xB2;
+    static const uint8_t INS_SV_RELOAD = 0xB8;
+    static const uint8_t INS_SV_DEBIT = 0xBA;
+    static const uint8_t INS_WRITE_BINARY = 0xD0;
+    static const uint8_t INS_WRITE_RECORD = 0xD2;
+    static const uint8_t INS_UPDATE_BINARY = 0xD6;
+    static const uint8_t INS_UPDATE_RECORD = 0xDC;
+    static const uint8_t INS_APPEND_RECORD = 0xE2;
+
+    /**
+     *
+     */
+    static const uint16_t SW_SUCCESS = 0x9000;
+    static const uint16_t SW_INVALIDATED = 0x6283;
+    static const uint16_t SW_LIMIT_REACHED = 0x6400;
+    static const uint16_t SW_WRONG_LENGTH = 0x6700;
+    static const uint16_t SW_INCOMPATIBLE_FILE = 0x6981;
+    static const uint16_t SW_CONDITIONS_NOT_SATISFIED = 0x6985;
+    static const uint16_t SW_INCORRECT_SIGNATURE = 0x6988;
+    static const uint16_t SW_FILE_NOT_FOUND = 0x6A82;
+    static const uint16_t SW_RECORD_NOT_FOUND = 0x6A83;
+    static const uint16_t SW_INCORRECT_P1P2 = 0x6B00;
+    static const uint16_t SW_INS_NOT_SUPPORTED = 0x6D00;
+
+    /**
+     *
+     */
+    const std::vector<uint8_t> mDfName;
+    const std::vector<uint8_t> mSerialNumber;
+    const std::shared_ptr<DirectoryHeader> mDirectoryHeader;
+    const uint64_t mMasterKey;
+    std::vector<uint8_t> mStartupInfo;
+    int mSessionBufferSize;
+    int mSessionBufferUsed;
+    bool mSessionOpen;
+    bool mRatified;
+    bool mRatificationPending;
+    int mTransactionCounter;
+    std::vector<SimulatedFile> mFiles;
+    std::array<int, 32> mSfiIndex;
+    std::vector<int> mJournal;
+    int mCurrentFile;
+    bool mSvEnabled;
+    bool mSvOperationAllowed;
+    ApplicationState mState;
+    ApplicationState mStateBackup;
+    SimulatedSessionMac mMac;
+    uint64_t mRandom;
+
+    /**
+     * Converts the session modification byte into a number of bytes (the buffer size doubles
+     * every 4 indexes, index 0x0B giving 512 bytes).
+     */
+    static int computeSessionBufferSize(const uint8_t sessionModification)
+    {
+        if (sessionModification < 0x06 || sessionModification > 0x37) {
+            throw IllegalArgumentException("The session modification byte is out of range.");
+        }
+
+        return static_cast<int>(std::pow(2.0, (sessionModification + 25) / 4.0));
+    }
+
+    /**
+     *
+     */
+    static bool parse(const ByteView& apdu, Command& command)
+    {
+        if (apdu.size() < 4) {
+            return false;
+        }
+
+        command.ins = apdu[1];
+        command.p1 = apdu[2];
+        command.p2 = apdu[3];
+
+        if (apdu.size() == 5) {
+            command.le = apdu[4];
+        } else if (apdu.size() > 5) {
+            const std::size_t lc = apdu[4];
+            if (apdu.size() < 5 + lc || apdu.size() > 6 + lc) {
+                return false;
+            }
+
+            command.data = apdu.subView(5, lc);
+            if (apdu.size() == 6 + lc) {
+                command.le = apdu[5 + lc];
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     *
+     */
+    static void appendValue(std::vector<uint8_t>& out, const int value, const int length)
+    {
+        for (int i = length - 1; i >= 0; i--) {
+            out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+        }
+    }
+
+    /**
+     *
+     */
+    static int readValue(const ByteView& data, const std::size_t offset, const int length)
+    {
+        int value = 0;
+        for (int i = 0; i < length; i++) {
+            value = (value << 8) | data[offset + i];
+        }
+
+        return value;
+    }
+
+    /**
+     *
+     */
+    static uint8_t toEfTypeByte(const ElementaryFile::Type type)
+    {
+        switch (type) {
+        case ElementaryFile::Type::BINARY:
+            return 0x01;
+        case ElementaryFile::Type::LINEAR:
+            return 0x02;
+        case ElementaryFile::Type::CYCLIC:
+            return 0x04;
+        case ElementaryFile::Type::SIMULATED_COUNTERS:
+            return 0x08;
+        default:
+            return 0x09;
+        }
+    }
+
+    /**
+     *
+     */
+    void setSvBit()
+    {
+        if (mSvEnabled) {
+            mStartupInfo[2] |= 0x02;
+        }
+    }
+
+    /**
+     *
+     */
+    SimulatedFile& getFile(const uint8_t sfi)
+    {
+        if (sfi > 31 || mSfiIndex[sfi] == NO_FILE) {
+            throw IllegalArgumentException("No EF with this SFI.");
+        }
+
+        return mFiles[mSfiIndex[sfi]];
+    }
+
+    /**
+     * Resolves the target EF of a command (the current EF if sfi is 0), which becomes the
+     * current EF.
+     */
+    SimulatedFile* resolveFile(const uint8_t sfi)
+    {
+        const int index = sfi == 0 ? mCurrentFile : mSfiIndex[sfi & 0x1F];
+        if (index == NO_FILE) {
+            return nullptr;
+        }
+
+        mCurrentFile = index;
+
+        return &mFiles[index];
+    }
+
+    /**
+     *
+     */
+    uint8_t nextRandom()
+    {
+        mRandom ^= mRandom << 13;
+        mRandom ^= mRandom >> 7;
+        mRandom ^= mRandom << 17;
+
+        return static_cast<uint8_t>(mRandom >> 24);
+    }
+
+    /**
+     * Consumes the session buffer for a modifying command and saves the EF content the first
+     * time it is modified during the session.
+     */
+    uint16_t beginModification(const Command& command, SimulatedFile* file)
+    {
+        if (!mSessionOpen) {
+            return SW_SUCCESS;
+        }
+
+        const int cost = static_cast<int>(command.data.size()) + 6;
+        if (mSessionBufferUsed + cost > mSessionBufferSize) {
+            return SW_LIMIT_REACHED;
+        }
+
+        mSessionBufferUsed += cost;
+
+        if (file != nullptr && !file->journaled) {
+            file->backup = file->records;
+            file->journaled = true;
+            mJournal.push_back(static_cast<int>(file - mFiles.data()));
+        }
+
+        return SW_SUCCESS;
+    }
+
+    /**
+     *
+     */
+    void commit()
+    {
+        for (const int index : mJournal) {
+            mFiles[index].journaled = false;
+        }
+
+        mJournal.clear();
+        mSessionOpen = false;
+    }
+
+    /**
+     *
+     */
+    void rollback()
+    {
+        for (const int index : mJournal) {
+            SimulatedFile& file = mFiles[index];
+            std::swap(file.records, file.backup);
+            file.journaled = false;
+        }
+
+        mJournal.clear();
+        std::swap(mState, mStateBackup);
+        mSessionOpen = false;
+    }
+
+    /**
+     *
+     */
+    uint16_t dispatch(const Command& command, std::vector<uint8_t>& response)
+    {
+        switch (command.ins) {
+        case INS_SELECT:
+            return command.p1 == 0x04 ? selectApplication(command, response) :
+                                        selectFile(command, response);
+        case INS_GET_CHALLENGE:
+            for (int i = 0; i < 8; i++) {
+                response.push_back(nextRandom());
+            }
+            return SW_SUCCESS;
+        case INS_READ_RECORD:
+            return readRecords(command, response);
+        case INS_READ_BINARY:
+            return readBinary(command, response);
+        case INS_UPDATE_RECORD:
+        case INS_WRITE_RECORD:
+        case INS_APPEND_RECORD:
+            return modifyRecord(command);
+        case INS_UPDATE_BINARY:
+        case INS_WRITE_BINARY:
+            return modifyBinary(command);
+        case INS_INCREASE:
+        case INS_DECREASE:
+        case INS_INCREASE_MULTIPLE:
+        case INS_DECREASE_MULTIPLE:
+            return modifyCounters(command, response);
+        case INS_OPEN_SESSION:
+            return openSession(command, response);
+        case INS_CLOSE_SESSION:
+            return closeSession(command, response);
+        case INS_SV_GET:
+            return svGet(command, response);
+        case INS_SV_RELOAD:
+            return svReload(command);
+        case INS_SV_DEBIT:
+            return svDebit(command);
+        case INS_INVALIDATE:
+        case INS_REHABILITATE:
+            return changeDfStatus(command);
+        default:
+            return SW_INS_NOT_SUPPORTED;
+        }
+    }
+
+    /**
+     * The AID may be a right truncated image of the DF name.
+     */
+    uint16_t selectApplication(const Command& command, std::vector<uint8_t>& response)
+    {
+        if (command.data.size() > mDfName.size() ||
+            !std::equal(command.data.begin(), command.data.end(), mDfName.begin())) {
+            return SW_FILE_NOT_FOUND;
+        }
+
+        if (mSessionOpen) {
+            rollback();
+        }
+
+        mCurrentFile = NO_FILE;
+
+        const int dfNameLength = static_cast<int>(mDfName.size());
+        response.push_back(0x6F);
+        response.push_back(static_cast<uint8_t>(dfNameLength + 26));
+        response.push_back(0x84);
+        response.push_back(static_cast<uint8_t>(dfNameLength));
+        response.insert(response.end(), mDfName.begin(), mDfName.end());
+        response.insert(response.end(), {0xA5, 0x16, 0xBF, 0x0C, 0x13, 0xC7, 0x08});
+        response.insert(response.end(), mSerialNumber.begin(), mSerialNumber.end());
+        response.push_back(0x53);
+        response.push_back(0x07);
+        response.insert(response.end(), mStartupInfo.begin(), mStartupInfo.end());
+
+        return mState.dfInvalidated ? SW_INVALIDATED : SW_SUCCESS;
+    }
+
+    /**
+     * Returns the proprietary FCP (tag 85) of the selected EF or DF.
+     */
+    uint16_t selectFile(const Command& command, std::vector<uint8_t>& response)
+    {
+        if (command.data.size() != 2) {
+            return SW_WRONG_LENGTH;
+        }
+
+        const uint16_t lid = static_cast<uint16_t>(readValue(command.data, 0, 2));
+        int index = NO_FILE;
+        if (command.p1 == 0x09 && lid == 0) {
+            appendDfFcp(response);
+            return SW_SUCCESS;
+        } else if (command.p1 == 0x09) {
+            for (std::size_t i = 0; i < mFiles.size(); i++) {
+                if (mFiles[i].header->getLid() == lid) {
+                    index = static_cast<int>(i);
+                    break;
+                }
+            }
+        } else if (command.p1 == 0x02 && command.p2 == 0x00) {
+            index = mFiles.empty() ? NO_FILE : 0;
+        } else if (command.p1 == 0x02 && command.p2 == 0x02) {
+            const int next = mCurrentFile + 1;
+            index = next < static_cast<int>(mFiles.size()) ? next : NO_FILE;
+        } else {
+            return SW_INCORRECT_P1P2;
+        }
+
+        if (index == NO_FILE) {
+            return SW_FILE_NOT_FOUND;
+        }
+
+        mCurrentFile = index;
+        appendEfFcp(mFiles[index], response);
+
+        return SW_SUCCESS;
+    }
+
+    /**
+     *
+     */
+    void appendEfFcp(const SimulatedFile& file, std::vector<uint8_t>& response) const
+    {
+        const FileHeader& header = *file.header;
+        response.insert(response.end(), {0x85, 0x17, file.sfi, 0x04});
+        response.push_back(toEfTypeByte(header.getEfType()));
+        response.push_back(static_cast<uint8_t>(header.getRecordSize()));
+        response.push_back(static_cast<uint8_t>(header.getRecordsNumber()));
+        appendPadded(response, header.getAccessConditions(), 4);
+        appendPadded(response, header.getKeyIndexes(), 4);
+        const std::shared_ptr<uint8_t> dfStatus = header.getDfStatus();
+        response.push_back(dfStatus != nullptr ? *dfStatus : 0x00);
+        response.insert(response.end(), 5, 0x00);
+        const std::shared_ptr<uint16_t> sharedReference = header.getSharedReference();
+        appendValue(response, sharedReference != nullptr ? *sharedReference : 0, 2);
+        appendValue(response, header.getLid(), 2);
+    }
+
+    /**
+     *
+     */
+    void appendDfFcp(std::vector<uint8_t>& response) const
+    {
+        const DirectoryHeader& header = *mDirectoryHeader;
+        response.insert(response.end(), {0x85, 0x17, 0x00, 0x02, 0x00, 0x00, 0x00});
+        appendPadded(response, header.getAccessConditions(), 4);
+        appendPadded(response, header.getKeyIndexes(), 4);
+        response.push_back(header.getDfStatus());
+        for (const WriteAccessLevel level : {WriteAccessLevel::PERSONALIZATION,
+                                             WriteAccessLevel::LOAD,
+                                             WriteAccessLevel::DEBIT}) {
+            response.push_back(header.getKvc(level));
+        }
+        for (const WriteAccessLevel level : {WriteAccessLevel::PERSONALIZATION,
+                                             WriteAccessLevel::LOAD,
+                                             WriteAccessLevel::DEBIT}) {
+            response.push_back(header.getKif(level));
+        }
+        response.push_back(0x00);
+        appendValue(response, header.getLid(), 2);
+    }
+
+    /**
+     *
+     */
+    static void appendPadded(std::vector<uint8_t>& response,
+                             const std::vector<uint8_t>& data,
+                             const std::size_t length)
+    {
+        for (std::size_t i = 0; i < length; i++) {
+            response.push_back(i < data.size() ? data[i] : 0x00);
+        }
+    }
+
+    /**
+     * P2 = SFI * 8 + 4 reads one record, P2 = SFI * 8 + 5 reads the records from P1 as long as
+     * they fit in Le (each one being prefixed by its number and length).
+     */
+    uint16_t readRecords(const Command& command, std::vector<uint8_t>& response)
+    {
+        SimulatedFile* file = resolveFile(command.p2 >> 3);
+        if (file == nullptr) {
+            return SW_FILE_NOT_FOUND;
+        }
+
+        if (file->header->getEfType() == ElementaryFile::Type::BINARY) {
+            return SW_INCOMPATIBLE_FILE;
+        }
+
+        if (!file->records.hasRecord(command.p1)) {
+            return SW_RECORD_NOT_FOUND;
+        }
+
+        if ((command.p2 & 0x07) == 0x04) {
+            const ByteView record = file->records.getRecord(command.p1);
+            response.insert(response.end(), record.begin(), record.end());
+
+            return SW_SUCCESS;
+        }
+
+        if ((command.p2 & 0x07) != 0x05) {
+            return SW_INCORRECT_P1P2;
+        }
+
+        const std::size_t maxLength = command.le <= 0 ? 256 : command.le;
+        for (int r = command.p1; file->records.hasRecord(r); r++) {
+            const ByteView record = file->records.getRecord(r);
+            if (response.size() + 2 + record.size() > maxLength) {
+                break;
+            }
+
+            response.push_back(static_cast<uint8_t>(r));
+            response.push_back(static_cast<uint8_t>(record.size()));
+            response.insert(response.end(), record.begin(), record.end());
+        }
+
+        return SW_SUCCESS;
+    }
+
+    /**
+     * If the bit 8 of P1 is set, the SFI is in P1 and the offset in P2, otherwise the offset is
+     * P1-P2 and the target is the current EF.
+     */
+    SimulatedFile* resolveBinaryFile(const Command& command, int& offset)
+    {
+        if ((command.p1 & 0x80) != 0) {
+            offset = command.p2;
+
+            return resolveFile(command.p1 & 0x1F);
+        }
+
+        offset = (command.p1 << 8) | command.p2;
+
+        return resolveFile(0);
+    }
+
+    /**
+     *
+     */
+    uint16_t readBinary(const Command& command, std::vector<uint8_t>& response)
+    {
+        int offset;
+        SimulatedFile* file = resolveBinaryFile(command, offset);
+        if (file == nullptr) {
+            return SW_FILE_NOT_FOUND;
+        }
+
+        if (file->header->getEfType() != ElementaryFile::Type::BINARY) {
+            return SW_INCOMPATIBLE_FILE;
+        }
+
+        const ByteView content = file->records.getRecord(1);
+        const int length = command.le <= 0 ? 256 : command.le;
+        if (offset + length > static_cast<int>(content.size())) {
+            return SW_INCORRECT_P1P2;
+        }
+
+        response.insert(response.end(),
+                        content.begin() + offset,
+                        content.begin() + offset + length);
+
+        return SW_SUCCESS;
+    }
+
+    /**
+     *
+     */
+    uint16_t modifyRecord(const Command& command)
+    {
+        SimulatedFile* file = resolveFile(command.p2 >> 3);
+        if (file == nullptr) {
+            return SW_FILE_NOT_FOUND;
+        }
+
+        const ElementaryFile::Type type = file->header->getEfType();
+        if (type == ElementaryFile::Type::BINARY ||
+            (command.ins == INS_APPEND_RECORD && type != ElementaryFile::Type::CYCLIC)) {
+            return SW_INCOMPATIBLE_FILE;
+        }
+
+        const int numRecord = command.ins == INS_APPEND_RECORD ? 1 : command.p1;
+        if (!file->records.hasRecord(numRecord)) {
+            return SW_RECORD_NOT_FOUND;
+        }
+
+        if (static_cast<int>(command.data.size()) > file->records.getRecordSize()) {
+            return SW_WRONG_LENGTH;
+        }
+
+        const uint16_t sw = beginModification(command, file);
+        if (sw != SW_SUCCESS) {
+            return sw;
+        }
+
+        if (command.ins == INS_APPEND_RECORD) {
+            appendZeroPadded(*file, command.data);
+        } else if (command.ins == INS_UPDATE_RECORD) {
+            file->records.setRecordPart(numRecord, 0, command.data);
+        } else {
+            orRecord(*file, numRecord, 0, command.data);
+        }
+
+        return SW_SUCCESS;
+    }
+
+    /**
+     *
+     */
+    uint16_t modifyBinary(const Command& command)
+    {
+        int offset;
+        SimulatedFile* file = resolveBinaryFile(command, offset);
+        if (file == nullptr) {
+            return SW_FILE_NOT_FOUND;
+        }
+
+        if (file->header->getEfType() != ElementaryFile::Type::BINARY) {
+            return SW_INCOMPATIBLE_FILE;
+        }
+
+        if (offset + static_cast<int>(command.data.size()) > file->records.getRecordSize()) {
+            return SW_INCORRECT_P1P2;
+        }
+
+        const uint16_t sw = beginModification(command, file);
+        if (sw != SW_SUCCESS) {
+            return sw;
+        }
+
+        if (command.ins == INS_UPDATE_BINARY) {
+            file->records.setRecordPart(1, offset, command.data);
+        } else {
+            orRecord(*file, 1, offset, command.data);
+        }
+
+        return SW_SUCCESS;
+    }
+
+    /**
+     * Appends a record to a cyclic EF, completing it with zeros up to the record size.
+     */
+    static void appendZeroPadded(SimulatedFile& file, const ByteView& data)
+    {
+        file.records.appendRecord(data);
+
+        const int recordSize = file.records.getRecordSize();
+        const int length = static_cast<int>(data.size());
+        if (length < recordSize) {
+            const uint8_t zeros[MAX_RECORD_SIZE] = {0};
+            file.records.setRecordPart(
+                1, length, ByteView(zeros, static_cast<std::size_t>(recordSize - length)));
+        }
+    }
+
+    /**
+     * Logical OR of the data with the content of the record (Write commands).
+     */
+    static void orRecord(SimulatedFile& file,
+                         const int numRecord,
+                         const int offset,
+                         const ByteView& data)
+    {
+        uint8_t merged[MAX_RECORD_SIZE];
+        const ByteView current = file.records.getRecord(numRecord);
+        for (std::size_t i = 0; i < data.size(); i++) {
+            merged[i] = current[offset + i] | data[i];
+        }
+
+        file.records.setRecordPart(numRecord, offset, ByteView(merged, data.size()));
+    }
+
+    /**
+     * Single commands: P1 is the counter number and the data is the 3-byte value. Multiple
+     * commands: the data is a sequence of counter number and 3-byte value.
+     */
+    uint16_t modifyCounters(const Command& command, std::vector<uint8_t>& response)
+    {
+        SimulatedFile* file = resolveFile(command.p2 >> 3);
+        if (file == nullptr) {
+            return SW_FILE_NOT_FOUND;
+        }
+
+        const ElementaryFile::Type type = file->header->getEfType();
+        if (type != ElementaryFile::Type::COUNTERS &&
+            type != ElementaryFile::Type::SIMULATED_COUNTERS) {
+            return SW_INCOMPATIBLE_FILE;
+        }
+
+        const bool multiple =
+            command.ins == INS_INCREASE_MULTIPLE || command.ins == INS_DECREASE_MULTIPLE;
+        const bool increase = command.ins == INS_INCREASE || command.ins == INS_INCREASE_MULTIPLE;
+        const std::size_t entrySize = multiple ? 4 : 3;
+        if (command.data.empty() || command.data.size() % entrySize != 0 ||
+            (!multiple && command.data.size() != 3)) {
+            return SW_WRONG_LENGTH;
+        }
+
+        /* Check all the counters before modifying any of them */
+        const ByteView counters = file->records.getRecord(1);
+        for (std::size_t i = 0; i < command.data.size(); i += entrySize) {
+            const int counter = multiple ? command.data[i] : command.p1;
+            const std::size_t offset = (counter - 1) * 3;
+            if (counter < 1 || offset + 3 > counters.size()) {
+                return SW_RECORD_NOT_FOUND;
+            }
+
+            const int value = readValue(command.data, i + entrySize - 3, 3);
+            const int result =
+                readValue(counters, offset, 3) + (increase ? value : -value);
+            if (result < 0 || result > 0xFFFFFF) {
+                return SW_LIMIT_REACHED;
+            }
+        }
+
+        const uint16_t sw = beginModification(command, file);
+        if (sw != SW_SUCCESS) {
+            return sw;
+        }
+
+        for (std::size_t i = 0; i < command.data.size(); i += entrySize) {
+            const int counter = multiple ? command.data[i] : command.p1;
+            const std::size_t offset = (counter - 1) * 3;
+            const ByteView current = file->records.getRecord(1);
+            const int value = readValue(command.data, i + entrySize - 3, 3);
+            const int result = readValue(current, offset, 3) + (increase ? value : -value);
+            const uint8_t bytes[3] = {static_cast<uint8_t>(result >> 16),
+                                      static_cast<uint8_t>(result >> 8),
+                                      static_cast<uint8_t>(result)};
+            file->records.setRecordPart(1, static_cast<int>(offset), ByteView(bytes, 3));
+
+            if (multiple) {
+                response.push_back(static_cast<uint8_t>(counter));
+            }
+            response.insert(response.end(), bytes, bytes + 3);
+        }
+
+        return SW_SUCCESS;
+    }
+
+    /**
+     * Revision 3 format: P1 = record number * 8 + key index, P2 = SFI * 8 + 1, data = 00 followed
+     * by the 4-byte SAM challenge.
+     */
+    uint16_t openSession(const Command& command, std::vector<uint8_t>& response)
+    {
+        if (command.data.size() != 5) {
+            return SW_WRONG_LENGTH;
+        }
+
+        const int keyIndex = command.p1 & 0x07;
+        if (keyIndex < 1 || keyIndex > 3) {
+            return SW_INCORRECT_P1P2;
+        }
+
+        if (mSessionOpen || mTransactionCounter == 0) {
+            return SW_CONDITIONS_NOT_SATISFIED;
+        }
+
+        ByteView record;
+        const int numRecord = command.p1 >> 3;
+        if (numRecord != 0) {
+            SimulatedFile* file = resolveFile(command.p2 >> 3);
+            if (file == nullptr) {
+                return SW_FILE_NOT_FOUND;
+            }
+
+            record = file->records.getRecord(numRecord);
+            if (record.empty()) {
+                return SW_RECORD_NOT_FOUND;
+            }
+        }
+
+        const WriteAccessLevel level = keyIndex == 1 ? WriteAccessLevel::PERSONALIZATION :
+                                       keyIndex == 2 ? WriteAccessLevel::LOAD :
+                                                       WriteAccessLevel::DEBIT;
+        const uint8_t kif = mDirectoryHeader->getKif(level);
+        const uint8_t kvc = mDirectoryHeader->getKvc(level);
+
+        mTransactionCounter--;
+        appendValue(response, mTransactionCounter, 3);
+        response.push_back(nextRandom());
+        response.push_back(mRatified ? 0x00 : 0x01);
+        response.push_back(kif);
+        response.push_back(kvc);
+        response.push_back(static_cast<uint8_t>(record.size()));
+        response.insert(response.end(), record.begin(), record.end());
+
+        const uint64_t key = SimulatedSessionMac::diversify(mMasterKey ^ ((kif << 8) | kvc),
+                                                            mSerialNumber);
+        mMac.init(key, command.data.subView(1, 4), response);
+
+        mStateBackup = mState;
+        mSessionBufferUsed = 0;
+        mSessionOpen = true;
+        mRatified = false;
+
+        return SW_SUCCESS;
+    }
+
+    /**
+     * Without data, the session is aborted. Otherwise, the data is the terminal signature and P1 =
+     * 80h requests a ratification by the next command.
+     */
+    uint16_t closeSession(const Command& command, std::vector<uint8_t>& response)
+    {
+        if (command.data.empty()) {
+            if (mSessionOpen) {
+                rollback();
+                mRatified = true;
+            }
+
+            return SW_SUCCESS;
+        }
+
+        if (!mSessionOpen) {
+            return SW_CONDITIONS_NOT_SATISFIED;
+        }
+
+        if (command.data.size() != SimulatedSessionMac::SIGNATURE_SIZE) {
+            return SW_WRONG_LENGTH;
+        }
+
+        uint8_t expected[SimulatedSessionMac::SIGNATURE_SIZE];
+        mMac.computeTerminalSignature(expected);
+        if (!std::equal(command.data.begin(), command.data.end(), expected)) {
+            rollback();
+
+            return SW_INCORRECT_SIGNATURE;
+        }
+
+        commit();
+
+        uint8_t signature[SimulatedSessionMac::SIGNATURE_SIZE];
+        mMac.computeCardSignature(signature);
+        response.insert(response.end(), signature, signature + SimulatedSessionMac::SIGNATURE_SIZE);
+
+        if (command.p1 == 0x80) {
+            mRatificationPending = true;
+        } else {
+            mRatified = true;
+        }
+
+        return SW_SUCCESS;
+    }
+
+    /**
+     * Response: KVC (1), SV TNum (2), previous signature (3), challenge (2), balance (3) followed
+     * by the last load log (P2 = 07h) or the last debit log (P2 = 09h).
+     */
+    uint16_t svGet(const Command& command, std::vector<uint8_t>& response)
+    {
+        if (!mSvEnabled) {
+            return SW_INS_NOT_SUPPORTED;
+        }
+
+        const bool reload = command.p2 == 0x07;
+        if (!reload && command.p2 != 0x09) {
+            return SW_INCORRECT_P1P2;
+        }
+
+        response.push_back(
+            mDirectoryHeader->getKvc(reload ? WriteAccessLevel::LOAD : WriteAccessLevel::DEBIT));
+        appendValue(response, mState.tNum, 2);
+        response.insert(response.end(), 3, 0x00);
+        response.push_back(nextRandom());
+        response.push_back(nextRandom());
+        appendValue(response, mState.balance, 3);
+
+        const ByteView log = reload ? mState.loadLog.getRecord(1) : mState.debitLog.getRecord(1);
+        response.insert(response.end(), log.begin(), log.end());
+
+        mSvOperationAllowed = true;
+
+        return SW_SUCCESS;
+    }
+
+    /**
+     * Data: date (2), free1 (1), KVC (1), free2 (1), amount (3), time (2), SAM ID (4), SAM TNum
+     * (3), optionally followed by the SV signature which is ignored.
+     */
+    uint16_t svReload(const Command& command)
+    {
+        if (!mSvEnabled) {
+            return SW_INS_NOT_SUPPORTED;
+        }
+
+        if (command.data.size() < 17) {
+            return SW_WRONG_LENGTH;
+        }
+
+        if (!mSvOperationAllowed) {
+            return SW_CONDITIONS_NOT_SATISFIED;
+        }
+
+        int amount = readValue(command.data, 5, 3);
+        if ((amount & 0x800000) != 0) {
+            amount -= 0x1000000;
+        }
+
+        const int balance = mState.balance + amount;
+        if (balance < -0x800000 || balance > 0x7FFFFF) {
+            return SW_LIMIT_REACHED;
+        }
+
+        const uint16_t sw = beginModification(command, nullptr);
+        if (sw != SW_SUCCESS) {
+            return sw;
+        }
+
+        mState.balance = balance;
+        mState.tNum = (mState.tNum + 1) & 0xFFFF;
+        mSvOperationAllowed = false;
+
+        uint8_t log[SV_LOAD_LOG_SIZE];
+        std::copy(command.data.begin(), command.data.begin() + 5, log);
+        writeValue(log + 5, balance, 3);
+        std::copy(command.data.begin() + 5, command.data.begin() + 17, log + 8);
+        writeValue(log + 20, mState.tNum, 2);
+        mState.loadLog.setRecord(1, ByteView(log, SV_LOAD_LOG_SIZE));
+
+        return SW_SUCCESS;
+    }
+
+    /**
+     * Data: amount (2), date (2), time (2), KVC (1), SAM ID (4), SAM TNum (3), optionally
+     * followed by the SV signature which is ignored. A negative balance is not allowed.
+     */
+    uint16_t svDebit(const Command& command)
+    {
+        if (!mSvEnabled) {
+            return SW_INS_NOT_SUPPORTED;
+        }
+
+        if (command.data.size() < 14) {
+            return SW_WRONG_LENGTH;
+        }
+
+        if (!mSvOperationAllowed) {
+            return SW_CONDITIONS_NOT_SATISFIED;
+        }
+
+        const int balance = mState.balance - readValue(command.data, 0, 2);
+        if (balance < 0) {
+            return SW_LIMIT_REACHED;
+        }
+
+        const uint16_t sw = beginModification(command, nullptr);
+        if (sw != SW_SUCCESS) {
+            return sw;
+        }
+
+        mState.balance = balance;
+        mState.tNum = (mState.tNum + 1) & 0xFFFF;
+        mSvOperationAllowed = false;
+
+        uint8_t log[SV_DEBIT_LOG_SIZE];
+        std::copy(command.data.begin(), command.data.begin() + 14, log);
+        writeValue(log + 14, balance, 3);
+        writeValue(log + 17, mState.tNum, 2);
+        mState.debitLog.appendRecord(ByteView(log, SV_DEBIT_LOG_SIZE));
+
+        return SW_SUCCESS;
+    }
+
+    /**
+     *
+     */
+    static void writeValue(uint8_t* out, const int value, const int length)
+    {
+        for (int i = 0; i < length; i++) {
+            out[i] = static_cast<uint8_t>(value >> (8 * (length - 1 - i)));
+        }
+    }
+
+    /**
+     *
+     */
+    uint16_t changeDfStatus(const Command& command)
+    {
+        const bool invalidate = command.ins == INS_INVALIDATE;
+        if (mState.dfInvalidated == invalidate) {
+            return SW_CONDITIONS_NOT_SATISFIED;
+        }
+
+        const uint16_t sw = beginModification(command, nullptr);
+        if (sw != SW_SUCCESS) {
+            return sw;
+        }
+
+        mState.dfInvalidated = invalidate;
+
+        return SW_SUCCESS;
+    }
+};
+
+}
+}
+}
+}
@@ -0,0 +1,391 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/* Calypsonet Terminal Calypso */
+#include "ByteView.h"
+#include "CalypsoSam.h"
+#include "SimulatedSessionMac.h"
+#include "SimulatedSmartCard.h"
+
+/* Keyple Core Util */
+#include "IllegalArgumentException.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace calypso {
+namespace sim {
+
+using namespace calypsonet::terminal::calypso;
+using namespace calypsonet::terminal::calypso::sam;
+using namespace keyple::core::util::cpp::exception;
+
+/**
+ * SAM simulated in the process, computing the secure session digests of a CalypsoCardSimulator.
+ *
+ * <p>It is both the CalypsoSam to provide to CardSecuritySetting::setSamResource() and the
+ * SimulatedSmartCard to insert in the SimulatedCardReader provided with it. The simulator
+ * supports:
+ *
+ * <ul>
+ *   <li>Select Diversifier (80 14): the card serial number.
+ *   <li>Get Challenge (80 84): 4 or 8 bytes.
+ *   <li>Digest Init (80 8A): KIF, KVC and the response data of the Open Secure Session command.
+ *   <li>Digest Update (80 8C): an APDU exchanged with the card or its response.
+ *   <li>Digest Close (80 8E): returns the terminal signature.
+ *   <li>Digest Authenticate (80 82): checks the card signature.
+ * </ul>
+ *
+ * <p>The session keys are derived from the master key shared with the simulated cards, see
+ * SimulatedSessionMac.
+ *
+ * <p>This class is not thread-safe.
+ *
+ * @since 1.5.0
+ */
+class CalypsoSamSimulator final : public CalypsoSam, public SimulatedSmartCard {
+public:
+    /**
+     * Creates a SAM C1.
+     *
+     * @param serialNumber The SAM serial number (4 bytes).
+     * @param masterKey The master key from which the session keys are derived.
+     * @throw IllegalArgumentException If the serial number is not 4 bytes long.
+     * @since 1.5.0
+     */
+    CalypsoSamSimulator(const std::vector<uint8_t>& serialNumber, const uint64_t masterKey)
+    : mSerialNumber(serialNumber),
+      mMasterKey(masterKey),
+      mDigestInitialized(false),
+      mRandom(0xD1B54A32D192ED03ULL)
+    {
+        if (serialNumber.size() != 4) {
+            throw IllegalArgumentException("The serial number must be 4 bytes long.");
+        }
+
+        static const char hex[] = "0123456789ABCDEF";
+        std::ostringstream powerOnData;
+        powerOnData << "3B3F9600805A0080C12000";
+        for (const uint8_t b : serialNumber) {
+            powerOnData << hex[b >> 4] << hex[b & 0x0F];
+            mRandom = (mRandom ^ b) * 0x00000100000001B3ULL;
+        }
+        powerOnData << "829000";
+        mPowerOnData = powerOnData.str();
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    const std::string& getPowerOnData() const override
+    {
+        return mPowerOnData;
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    const std::vector<uint8_t> getSelectApplicationResponse() const override
+    {
+        return std::vector<uint8_t>();
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    ProductType getProductType() const override
+    {
+        return ProductType::SAM_C1;
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    const std::string getProductInfo() const override
+    {
+        return "Simulated SAM C1";
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    const std::vector<uint8_t>& getSerialNumber() const override
+    {
+        return mSerialNumber;
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    uint8_t getPlatform() const override
+    {
+        return 0x00;
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    uint8_t getApplicationType() const override
+    {
+        return 0x80;
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    uint8_t getApplicationSubType() const override
+    {
+        return 0xC1;
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    uint8_t getSoftwareIssuer() const override
+    {
+        return 0x20;
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    uint8_t getSoftwareVersion() const override
+    {
+        return 0x00;
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    uint8_t getSoftwareRevision() const override
+    {
+        return 0x00;
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    void processApdu(const ByteView& apdu, std::vector<uint8_t>& response) override
+    {
+        response.clear();
+
+        uint16_t sw;
+        if (apdu.size() < 5 || (apdu.size() > 5 && apdu.size() < 5u + apdu[4])) {
+            sw = SW_WRONG_LENGTH;
+        } else {
+            const ByteView data = apdu.size() > 5 ? apdu.subView(5, apdu[4]) : ByteView();
+            sw = dispatch(apdu[1], apdu[3], apdu[4], data, response);
+        }
+
+        if (sw != SW_SUCCESS) {
+            response.clear();
+        }
+
+        response.push_back(static_cast<uint8_t>(sw >> 8));
+        response.push_back(static_cast<uint8_t>(sw));
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    void reset() override
+    {
+        mDiversifier.clear();
+        mChallenge.clear();
+        mDigestInitialized = false;
+    }
+
+private:
+    /**
+     *
+     */
+    static const uint8_t INS_SELECT_DIVERSIFIER = 0x14;
+    static const uint8_t INS_DIGEST_AUTHENTICATE = 0x82;
+    static const uint8_t INS_GET_CHALLENGE = 0x84;
+    static const uint8_t INS_DIGEST_INIT = 0x8A;
+    static const uint8_t INS_DIGEST_UPDATE = 0x8C;
+    static const uint8_t INS_DIGEST_CLOSE = 0x8E;
+
+    /**
+     *
+     */
+    static const uint16_t SW_SUCCESS = 0x9000;
+    static const uint16_t SW_WRONG_LENGTH = 0x6700;
+    static const uint16_t SW_CONDITIONS_NOT_SATISFIED = 0x6985;
+    static const uint16_t SW_INCORRECT_SIGNATURE = 0x6988;
+    static const uint16_t SW_INS_NOT_SUPPORTED = 0x6D00;
+
+    /**
+     *
+     */
+    const std::vector<uint8_t> mSerialNumber;
+    const uint64_t mMasterKey;
+    std::string mPowerOnData;
+    std::vector<uint8_t> mDiversifier;
+    std::vector<uint8_t> mChallenge;
+    bool mDigestInitialized;
+    SimulatedSessionMac mMac;
+    uint64_t mRandom;
+
+    /**
+     *
+     */
+    uint8_t nextRandom()
+    {
+        mRandom ^= mRandom << 13;
+        mRandom ^= mRandom >> 7;
+        mRandom ^= mRandom << 17;
+
+        return static_cast<uint8_t>(mRandom >> 24);
+    }
+
+    /**
+     *
+     */
+    uint16_t dispatch(const uint8_t ins,
+                      const uint8_t p2,
+                      const uint8_t p3,
+                      const ByteView& data,
+                      std::vector<uint8_t>& response)
+    {
+        (void)p2;
+
+        switch (ins) {
+        case INS_SELECT_DIVERSIFIER:
+            if (data.size() != 4 && data.size() != 8) {
+                return SW_WRONG_LENGTH;
+            }
+            mDiversifier.assign(data.begin(), data.end());
+            mDigestInitialized = false;
+            return SW_SUCCESS;
+
+        case INS_GET_CHALLENGE:
+            if (p3 != 4 && p3 != 8) {
+                return SW_WRONG_LENGTH;
+            }
+            mChallenge.clear();
+            for (int i = 0; i < p3; i++) {
+                mChallenge.push_back(nextRandom());
+            }
+            response.insert(response.end(), mChallenge.begin(), mChallenge.end());
+            return SW_SUCCESS;
+
+        case INS_DIGEST_INIT:
+            return digestInit(data);
+
+        case INS_DIGEST_UPDATE:
+            if (!mDigestInitialized) {
+                return SW_CONDITIONS_NOT_SATISFIED;
+            }
+            mMac.update(data);
+            return SW_SUCCESS;
+
+        case INS_DIGEST_CLOSE:
+            if (!mDigestInitialized) {
+                return SW_CONDITIONS_NOT_SATISFIED;
+            }
+            response.resize(SimulatedSessionMac::SIGNATURE_SIZE);
+            mMac.computeTerminalSignature(response.data());
+            return SW_SUCCESS;
+
+        case INS_DIGEST_AUTHENTICATE:
+            return digestAuthenticate(data);
+
+        default:
+            return SW_INS_NOT_SUPPORTED;
+        }
+    }
+
+    /**
+     * The diversifier is the card serial number and the 4-byte challenge is the one sent in the
+     * Open Secure Session command.
+     */
+    uint16_t digestInit(const ByteView& data)
+    {
+        if (data.size() < 10) {
+            return SW_WRONG_LENGTH;
+        }
+
+        if (mDiversifier.empty() || mChallenge.size() != 4) {
+            return SW_CONDITIONS_NOT_SATISFIED;
+        }
+
+        const uint8_t kif = data[0];
+        const uint8_t kvc = data[1];
+        const uint64_t key =
+            SimulatedSessionMac::diversify(mMasterKey ^ ((kif << 8) | kvc), mDiversifier);
+        mMac.init(key, mChallenge, data.subView(2, data.size() - 2));
+        mDigestInitialized = true;
+
+        return SW_SUCCESS;
+    }
+
+    /**
+     *
+     */
+    uint16_t digestAuthenticate(const ByteView& data)
+    {
+        if (data.size() != SimulatedSessionMac::SIGNATURE_SIZE) {
+            return SW_WRONG_LENGTH;
+        }
+
+        if (!mDigestInitialized) {
+            return SW_CONDITIONS_NOT_SATISFIED;
+        }
+
+        mDigestInitialized = false;
+
+        uint8_t expected[SimulatedSessionMac::SIGNATURE_SIZE];
+        mMac.computeCardSignature(expected);
+
+        return std::equal(data.begin(), data.end(), expected) ? SW_SUCCESS :
+                                                                SW_INCORRECT_SIGNATURE;
+    }
+};
+
+}
+}
+}
+}
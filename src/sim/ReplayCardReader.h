@@ -0,0 +1,218 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+/* Calypsonet Terminal Calypso */
+#include "AbstractSimulatedCardReader.h"
+#include "ApduExchangeEvent.h"
+#include "ApduTraceReader.h"
+#include "ByteView.h"
+
+/* Keyple Core Util */
+#include "IllegalArgumentException.h"
+#include "IllegalStateException.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace calypso {
+namespace sim {
+
+using namespace calypsonet::terminal::calypso;
+using namespace calypsonet::terminal::calypso::transaction;
+using namespace keyple::core::util::cpp::exception;
+
+/**
+ * CardReader replaying the card or SAM side of an APDU trace recorded by ApduTraceRecorder.
+ *
+ * <p>It is used like a SimulatedCardReader: to re-run a recorded transaction, a reader replaying
+ * the CARD exchanges is provided to the CardTransactionManager and a reader replaying the SAM
+ * exchanges, on the same trace, to CardSecuritySetting::setSamResource(). The transaction layer
+ * exchanges with it through the ProxyReaderApi implemented by AbstractSimulatedCardReader. Each
+ * APDU received must be the next recorded APDU of the target, whose recorded response is
+ * returned. Any divergence (another APDU) is reported by an IllegalStateException, which makes
+ * the replay deterministic. Once all the exchanges of the target have been replayed, the card is
+ * no longer present.
+ *
+ * <p>By default, the responses are returned immediately. With setLatencyFactor(), the reader
+ * waits the recorded latency of each exchange multiplied by the factor, e.g. 1 to reproduce the
+ * timings of the recorded reader or 2 to simulate a reader twice slower. The recorded delays
+ * between exchanges are the time spent by the terminal itself and are never reproduced.
+ *
+ * <p>The reader does not own the trace, which must remain valid and unchanged as long as the
+ * reader is used.
+ *
+ * <p>This class is not thread-safe.
+ *
+ * @since 1.5.0
+ */
+class ReplayCardReader final : public AbstractSimulatedCardReader {
+public:
+    /**
+     * Creates a reader positioned on the first exchange of the target.
+     *
+     * @param name The name of the reader.
+     * @param contactless True if the reader must be reported as contactless.
+     * @param trace The APDU trace.
+     * @param target The target whose exchanges are replayed.
+     * @throw IllegalArgumentException If the trace header is invalid.
+     * @since 1.5.0
+     */
+    ReplayCardReader(const std::string& name,
+                     const bool contactless,
+                     const ByteView& trace,
+                     const ApduExchangeEvent::Target target)
+    : AbstractSimulatedCardReader(name, contactless),
+      mTrace(trace),
+      mTarget(target),
+      mLatencyFactor(0),
+      mApdusNumber(0) {}
+
+    /**
+     * {@inheritDoc}
+     *
+     * <p>The card is present as long as some exchanges of the target remain to be replayed.
+     *
+     * @since 1.5.0
+     */
+    bool isCardPresent() override
+    {
+        ApduTraceReader trace = mTrace;
+        ApduTraceReader::Exchange exchange;
+
+        return nextExchange(trace, exchange);
+    }
+
+    /**
+     * Sets the factor applied to the recorded latencies.
+     *
+     * @param latencyFactor 0 to replay at full speed (default), 1 to reproduce the recorded
+     *        latencies, a greater value to simulate a slower reader.
+     * @throw IllegalArgumentException If the factor is negative.
+     * @since 1.5.0
+     */
+    void setLatencyFactor(const double latencyFactor)
+    {
+        if (latencyFactor < 0) {
+            throw IllegalArgumentException("The latency factor must be positive or zero.");
+        }
+
+        mLatencyFactor = latencyFactor;
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * <p>The recorded response of the next exchange of the target is returned.
+     *
+     * @throw IllegalStateException If the APDU is not the next recorded APDU of the target or if
+     *        all the exchanges of the target have been replayed.
+     * @throw IllegalArgumentException If the trace is malformed.
+     * @since 1.5.0
+     */
+    void transmitApdu(const ByteView& apdu, std::vector<uint8_t>& response) override
+    {
+        if (!nextExchange(mTrace, mExchange)) {
+            throw IllegalStateException("End of the APDU trace reached in reader " + mName);
+        }
+
+        mApdusNumber++;
+
+        if (apdu.size() != mExchange.apdu.size() ||
+            !std::equal(apdu.begin(), apdu.end(), mExchange.apdu.begin())) {
+            throw IllegalStateException("APDU #" + std::to_string(mApdusNumber) +
+                                        " diverges from the APDU trace in reader " + mName);
+        }
+
+        if (mLatencyFactor > 0) {
+            std::this_thread::sleep_for(
+                std::chrono::duration<double, std::micro>(mExchange.latency.count() *
+                                                          mLatencyFactor));
+        }
+
+        response.assign(mExchange.response.begin(), mExchange.response.end());
+    }
+
+    /**
+     * Goes back to the first exchange of the target, to replay the trace again.
+     *
+     * @since 1.5.0
+     */
+    void rewind()
+    {
+        mTrace.rewind();
+    }
+
+    /**
+     * Gets the number of APDUs transmitted since the creation of the reader.
+     *
+     * @return A positive or zero value.
+     * @since 1.5.0
+     */
+    long getApdusNumber() const
+    {
+        return mApdusNumber;
+    }
+
+private:
+    /**
+     * Reads the next exchange of the target from the provided trace reader.
+     */
+    bool nextExchange(ApduTraceReader& trace, ApduTraceReader::Exchange& exchange) const
+    {
+        while (trace.next(exchange)) {
+            if (exchange.target == mTarget) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     *
+     */
+    ApduTraceReader mTrace;
+
+    /**
+     *
+     */
+    const ApduExchangeEvent::Target mTarget;
+
+    /**
+     *
+     */
+    double mLatencyFactor;
+
+    /**
+     *
+     */
+    ApduTraceReader::Exchange mExchange;
+
+    /**
+     *
+     */
+    long mApdusNumber;
+};
+
+}
+}
+}
+}
@@ -0,0 +1,139 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/* Calypsonet Terminal Calypso */
+#include "AbstractSimulatedCardReader.h"
+#include "ByteView.h"
+#include "SimulatedSmartCard.h"
+
+/* Keyple Core Util */
+#include "IllegalStateException.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace calypso {
+namespace sim {
+
+using namespace calypsonet::terminal::calypso;
+using namespace keyple::core::util::cpp::exception;
+
+/**
+ * CardReader in which a SimulatedSmartCard (a CalypsoCardSimulator or a CalypsoSamSimulator) is
+ * inserted.
+ *
+ * <p>It is the reader to provide to the CardTransactionManager (card reader) or to
+ * CardSecuritySetting::setSamResource() (SAM reader). The transaction layer exchanges with the
+ * simulated card through the ProxyReaderApi implemented by AbstractSimulatedCardReader, as with
+ * a local reader. The APDUs are processed synchronously by the simulated card in the calling
+ * thread.
+ *
+ * <p>This class is not thread-safe.
+ *
+ * @since 1.5.0
+ */
+class SimulatedCardReader final : public AbstractSimulatedCardReader {
+public:
+    /**
+     * Creates an empty reader.
+     *
+     * @param name The name of the reader.
+     * @param contactless True if the reader must be reported as contactless.
+     * @since 1.5.0
+     */
+    SimulatedCardReader(const std::string& name, const bool contactless)
+    : AbstractSimulatedCardReader(name, contactless), mApdusNumber(0) {}
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 1.5.0
+     */
+    bool isCardPresent() override
+    {
+        return mCard != nullptr;
+    }
+
+    /**
+     * Inserts a card in the reader, replacing the current one if any. The card is reset.
+     *
+     * @param card The card to insert.
+     * @since 1.5.0
+     */
+    void insertCard(const std::shared_ptr<SimulatedSmartCard> card)
+    {
+        mCard = card;
+
+        if (mCard != nullptr) {
+            mCard->reset();
+        }
+    }
+
+    /**
+     * Removes the current card, if any.
+     *
+     * @since 1.5.0
+     */
+    void removeCard()
+    {
+        mCard.reset();
+    }
+
+    /**
+     * {@inheritDoc}
+     *
+     * @throw IllegalStateException If no card is inserted.
+     * @since 1.5.0
+     */
+    void transmitApdu(const ByteView& apdu, std::vector<uint8_t>& response) override
+    {
+        if (mCard == nullptr) {
+            throw IllegalStateException("No card inserted in reader " + mName);
+        }
+
+        mApdusNumber++;
+        mCard->processApdu(apdu, response);
+    }
+
+    /**
+     * Gets the number of APDUs transmitted since the creation of the reader.
+     *
+     * @return A positive or zero value.
+     * @since 1.5.0
+     */
+    long getApdusNumber() const
+    {
+        return mApdusNumber;
+    }
+
+private:
+    /**
+     *
+     */
+    std::shared_ptr<SimulatedSmartCard> mCard;
+
+    /**
+     *
+     */
+    long mApdusNumber;
+};
+
+}
+}
+}
+}
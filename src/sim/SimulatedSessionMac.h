@@ -0,0 +1,167 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/* Calypsonet Terminal Calypso */
+#include "ByteView.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace calypso {
+namespace sim {
+
+using namespace calypsonet::terminal::calypso;
+
+/**
+ * Keyed digest shared by CalypsoCardSimulator and CalypsoSamSimulator to sign the secure
+ * sessions.
+ *
+ * <p>It is <b>not</b> a cryptographic algorithm: it only gives the simulated card and SAM the same
+ * behavior as real ones (a wrong or missing digest makes the session fail) at a negligible CPU
+ * cost, so that the profiling of a transaction stack is not biased by the simulation.
+ *
+ * <p>The session key is derived from a master key and from the card serial number
+ * (diversification), then mixed with the SAM and card challenges. All the APDUs exchanged during
+ * the session, and their responses, are then added to the digest.
+ *
+ * @since 1.5.0
+ */
+class SimulatedSessionMac final {
+public:
+    /**
+     * Size of the terminal and card session signatures.
+     *
+     * @since 1.5.0
+     */
+    static const int SIGNATURE_SIZE = 4;
+
+    /**
+     * Derives the key of a card from a master key and from the card serial number.
+     *
+     * @param masterKey The master key.
+     * @param serialNumber The card serial number.
+     * @return The diversified key.
+     * @since 1.5.0
+     */
+    static uint64_t diversify(const uint64_t masterKey, const ByteView& serialNumber)
+    {
+        uint64_t state = masterKey;
+        for (const uint8_t b : serialNumber) {
+            state = (state ^ b) * PRIME;
+        }
+
+        return mix(state);
+    }
+
+    /**
+     * Starts a new digest.
+     *
+     * @param key The diversified key.
+     * @param samChallenge The challenge provided by the SAM.
+     * @param cardChallenge The challenge provided by the card.
+     * @since 1.5.0
+     */
+    void init(const uint64_t key, const ByteView& samChallenge, const ByteView& cardChallenge)
+    {
+        mState = key ^ OFFSET_BASIS;
+        update(samChallenge);
+        update(cardChallenge);
+    }
+
+    /**
+     * Adds data to the digest.
+     *
+     * @param data The data.
+     * @since 1.5.0
+     */
+    void update(const ByteView& data)
+    {
+        uint64_t state = mState;
+        for (const uint8_t b : data) {
+            state = (state ^ b) * PRIME;
+        }
+
+        mState = state;
+    }
+
+    /**
+     * Computes the signature of the terminal (i.e. the one computed by the SAM and checked by the
+     * card) at the current state of the digest.
+     *
+     * @param signature The buffer receiving the SIGNATURE_SIZE bytes of the signature.
+     * @since 1.5.0
+     */
+    void computeTerminalSignature(uint8_t* signature) const
+    {
+        write(mix(mState ^ TERMINAL_DOMAIN), signature);
+    }
+
+    /**
+     * Computes the signature of the card (i.e. the one computed by the card and checked by the
+     * SAM) at the current state of the digest.
+     *
+     * @param signature The buffer receiving the SIGNATURE_SIZE bytes of the signature.
+     * @since 1.5.0
+     */
+    void computeCardSignature(uint8_t* signature) const
+    {
+        write(mix(mState ^ CARD_DOMAIN), signature);
+    }
+
+private:
+    /**
+     * FNV-1a parameters.
+     */
+    static const uint64_t OFFSET_BASIS = 0xCBF29CE484222325ULL;
+    static const uint64_t PRIME = 0x00000100000001B3ULL;
+
+    /**
+     *
+     */
+    static const uint64_t TERMINAL_DOMAIN = 0x5445524D494E414CULL;
+    static const uint64_t CARD_DOMAIN = 0x0000000043415244ULL;
+
+    /**
+     * SplitMix64 finalizer.
+     */
+    static uint64_t mix(uint64_t value)
+    {
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+
+        return value ^ (value >> 31);
+    }
+
+    /**
+     *
+     */
+    static void write(const uint64_t value, uint8_t* signature)
+    {
+        for (int i = 0; i < SIGNATURE_SIZE; i++) {
+            signature[i] = static_cast<uint8_t>(value >> (8 * (SIGNATURE_SIZE - 1 - i)));
+        }
+    }
+
+    /**
+     *
+     */
+    uint64_t mState = 0;
+};
+
+}
+}
+}
+}
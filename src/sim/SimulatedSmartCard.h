@@ -0,0 +1,64 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+/* Calypsonet Terminal Calypso */
+#include "ByteView.h"
+
+namespace calypsonet {
+namespace terminal {
+namespace calypso {
+namespace sim {
+
+using namespace calypsonet::terminal::calypso;
+
+/**
+ * Smart card simulated in the process, exchanging ISO 7816-4 APDUs through a SimulatedCardReader.
+ *
+ * @since 1.5.0
+ */
+class SimulatedSmartCard {
+public:
+    /**
+     *
+     */
+    virtual ~SimulatedSmartCard() = default;
+
+    /**
+     * Processes a command APDU.
+     *
+     * <p>The response buffer is cleared before being filled with the response data followed by
+     * the status word, so that a buffer reused from one call to another does not reallocate.
+     *
+     * @param apdu The command APDU (case 1 to 4 short APDU).
+     * @param response The buffer receiving the response APDU.
+     * @since 1.5.0
+     */
+    virtual void processApdu(const ByteView& apdu, std::vector<uint8_t>& response) = 0;
+
+    /**
+     * Simulates a power off followed by a power on of the card: the volatile state (e.g. an open
+     * secure session) is lost.
+     *
+     * @since 1.5.0
+     */
+    virtual void reset() = 0;
+};
+
+}
+}
+}
+}
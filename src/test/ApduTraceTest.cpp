@@ -0,0 +1,309 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+/* Calypsonet Terminal Calypso */
+#include "ApduTraceReader.h"
+#include "ApduTraceRecorder.h"
+#include "ReplayCardReader.h"
+
+/* Keyple Core Util */
+#include "IllegalArgumentException.h"
+#include "IllegalStateException.h"
+
+using namespace testing;
+
+using namespace calypsonet::terminal::calypso;
+using namespace calypsonet::terminal::calypso::sim;
+using namespace calypsonet::terminal::calypso::transaction;
+using namespace calypsonet::terminal::card;
+using namespace calypsonet::terminal::card::spi;
+using namespace keyple::core::util::cpp::exception;
+
+static const std::vector<uint8_t> SELECT_APPLICATION = {0x00, 0xA4, 0x04, 0x00, 0x05, 0xA0,
+                                                        0x00, 0x00, 0x04, 0x04, 0x00};
+static const std::vector<uint8_t> SELECT_DIVERSIFIER = {0x80, 0x14, 0x00, 0x00, 0x04,
+                                                        0x12, 0x34, 0x56, 0x78};
+static const std::vector<uint8_t> GET_CHALLENGE = {0x80, 0x84, 0x00, 0x00, 0x04};
+static const std::vector<uint8_t> READ_RECORD = {0x00, 0xB2, 0x01, 0x3C, 0x00};
+static const std::vector<uint8_t> SW_9000 = {0x90, 0x00};
+
+class ATT_ApduExchangeEvent final : public ApduExchangeEvent {
+public:
+    ATT_ApduExchangeEvent(const Target target,
+                          const Phase phase,
+                          const std::string& commandName,
+                          const std::vector<uint8_t>& apdu,
+                          const std::vector<uint8_t>& response,
+                          const std::chrono::steady_clock::time_point requestTime,
+                          const std::chrono::microseconds latency)
+    : mTarget(target),
+      mPhase(phase),
+      mCommandName(commandName),
+      mApdu(apdu),
+      mResponse(response),
+      mRequestTime(requestTime),
+      mResponseTime(requestTime + latency) {}
+
+    Target getTarget() const override { return mTarget; }
+    Phase getPhase() const override { return mPhase; }
+    const std::string& getCommandName() const override { return mCommandName; }
+    const std::vector<uint8_t>& getApdu() const override { return mApdu; }
+    const std::vector<uint8_t>& getResponse() const override { return mResponse; }
+    int getStatusWord() const override { return 0x9000; }
+    std::chrono::steady_clock::time_point getRequestTime() const override { return mRequestTime; }
+    std::chrono::steady_clock::time_point getResponseTime() const override { return mResponseTime; }
+
+private:
+    const Target mTarget;
+    const Phase mPhase;
+    const std::string mCommandName;
+    const std::vector<uint8_t> mApdu;
+    const std::vector<uint8_t> mResponse;
+    const std::chrono::steady_clock::time_point mRequestTime;
+    const std::chrono::steady_clock::time_point mResponseTime;
+};
+
+class ATT_ApduRequest final : public ApduRequestSpi {
+public:
+    explicit ATT_ApduRequest(const std::vector<uint8_t>& apdu) : mApdu(apdu) {}
+
+    const std::vector<uint8_t>& getApdu() const override { return mApdu; }
+    const std::vector<int>& getSuccessfulStatusWords() const override { return mStatusWords; }
+    const std::string& getInfo() const override { return mInfo; }
+
+private:
+    const std::vector<uint8_t> mApdu;
+    const std::vector<int> mStatusWords = {0x9000};
+    const std::string mInfo;
+};
+
+class ATT_CardRequest final : public CardRequestSpi {
+public:
+    explicit ATT_CardRequest(const std::vector<std::vector<uint8_t>>& apdus)
+    {
+        for (const auto& apdu : apdus) {
+            mApduRequests.push_back(std::make_shared<ATT_ApduRequest>(apdu));
+        }
+    }
+
+    const std::vector<std::shared_ptr<ApduRequestSpi>>& getApduRequests() const override
+    {
+        return mApduRequests;
+    }
+
+    bool stopOnUnsuccessfulStatusWord() const override { return true; }
+
+private:
+    std::vector<std::shared_ptr<ApduRequestSpi>> mApduRequests;
+};
+
+/* Records a selection, a SAM challenge and 2 identical reads, 10 ms apart and lasting 2 ms each */
+static std::vector<uint8_t> recordTrace()
+{
+    ApduTraceRecorder recorder;
+    auto time = std::chrono::steady_clock::time_point() + std::chrono::seconds(100);
+    const std::chrono::microseconds latency(2000);
+
+    const auto record = [&](const ApduExchangeEvent::Target target,
+                            const ApduExchangeEvent::Phase phase,
+                            const std::string& commandName,
+                            const std::vector<uint8_t>& apdu,
+                            const std::vector<uint8_t>& response) {
+        recorder.onApduExchanged(
+            ATT_ApduExchangeEvent(target, phase, commandName, apdu, response, time, latency));
+        time += std::chrono::milliseconds(10);
+    };
+
+    record(ApduExchangeEvent::Target::CARD,
+           ApduExchangeEvent::Phase::COMMANDS,
+           "SELECT_APPLICATION",
+           SELECT_APPLICATION,
+           std::vector<uint8_t>({0x6F, 0x00, 0x90, 0x00}));
+    record(ApduExchangeEvent::Target::SAM,
+           ApduExchangeEvent::Phase::OPENING,
+           "SELECT_DIVERSIFIER",
+           SELECT_DIVERSIFIER,
+           SW_9000);
+    record(ApduExchangeEvent::Target::SAM,
+           ApduExchangeEvent::Phase::OPENING,
+           "GET_CHALLENGE",
+           GET_CHALLENGE,
+           std::vector<uint8_t>({0x01, 0x02, 0x03, 0x04, 0x90, 0x00}));
+    record(ApduExchangeEvent::Target::CARD,
+           ApduExchangeEvent::Phase::COMMANDS,
+           "READ_RECORDS",
+           READ_RECORD,
+           std::vector<uint8_t>({0x11, 0x90, 0x00}));
+    record(ApduExchangeEvent::Target::CARD,
+           ApduExchangeEvent::Phase::COMMANDS,
+           "READ_RECORDS",
+           READ_RECORD,
+           std::vector<uint8_t>({0x22, 0x90, 0x00}));
+
+    std::vector<uint8_t> trace;
+    recorder.takeTrace(trace);
+
+    return trace;
+}
+
+TEST(ApduTraceTest, next_shouldReturnTheRecordedExchangesInOrder)
+{
+    const std::vector<uint8_t> trace = recordTrace();
+    ApduTraceReader reader(trace);
+    ApduTraceReader::Exchange exchange;
+
+    ASSERT_TRUE(reader.next(exchange));
+    ASSERT_EQ(exchange.target, ApduExchangeEvent::Target::CARD);
+    ASSERT_EQ(exchange.phase, ApduExchangeEvent::Phase::COMMANDS);
+    ASSERT_EQ(std::string(exchange.commandName.begin(), exchange.commandName.end()),
+              "SELECT_APPLICATION");
+    ASSERT_EQ(exchange.apdu.toVector(), SELECT_APPLICATION);
+    ASSERT_EQ(exchange.delay.count(), 0);
+    ASSERT_EQ(exchange.latency.count(), 2000);
+
+    ASSERT_TRUE(reader.next(exchange));
+    ASSERT_EQ(exchange.target, ApduExchangeEvent::Target::SAM);
+    ASSERT_EQ(exchange.phase, ApduExchangeEvent::Phase::OPENING);
+    ASSERT_EQ(exchange.response.toVector(), SW_9000);
+    ASSERT_EQ(exchange.delay.count(), 8000);
+
+    ASSERT_TRUE(reader.next(exchange));
+    ASSERT_TRUE(reader.next(exchange));
+    ASSERT_TRUE(reader.next(exchange));
+    ASSERT_EQ(std::string(exchange.commandName.begin(), exchange.commandName.end()),
+              "READ_RECORDS");
+    ASSERT_EQ(exchange.response.toVector(), std::vector<uint8_t>({0x22, 0x90, 0x00}));
+    ASSERT_FALSE(reader.next(exchange));
+    ASSERT_EQ(reader.getExchangesNumber(), 5);
+
+    reader.rewind();
+    ASSERT_TRUE(reader.next(exchange));
+    ASSERT_EQ(exchange.apdu.toVector(), SELECT_APPLICATION);
+}
+
+TEST(ApduTraceTest, apduTraceReader_whenTraceIsInvalid_shouldThrowIAE)
+{
+    const std::vector<uint8_t> trace = recordTrace();
+    ApduTraceReader::Exchange exchange;
+
+    std::vector<uint8_t> badMagic = trace;
+    badMagic[0] ^= 0xFF;
+    EXPECT_THROW(ApduTraceReader(ByteView(badMagic)), IllegalArgumentException);
+    EXPECT_THROW(ApduTraceReader(ByteView(trace.data(), 4)), IllegalArgumentException);
+
+    const std::vector<uint8_t> truncated(trace.begin(), trace.end() - 1);
+    ApduTraceReader reader(truncated);
+    for (int i = 0; i < 4; i++) {
+        ASSERT_TRUE(reader.next(exchange));
+    }
+    EXPECT_THROW(reader.next(exchange), IllegalArgumentException);
+}
+
+TEST(ApduTraceTest, takeTrace_shouldStartANewTrace)
+{
+    ApduTraceRecorder recorder;
+    recorder.onApduExchanged(ATT_ApduExchangeEvent(ApduExchangeEvent::Target::CARD,
+                                                   ApduExchangeEvent::Phase::COMMANDS,
+                                                   "READ_RECORDS",
+                                                   READ_RECORD,
+                                                   SW_9000,
+                                                   std::chrono::steady_clock::now(),
+                                                   std::chrono::microseconds(0)));
+    std::vector<uint8_t> trace;
+
+    recorder.takeTrace(trace);
+
+    const std::size_t headerSize = ApduTraceReader::HEADER_SIZE;
+    ASSERT_GT(trace.size(), headerSize);
+    ASSERT_EQ(recorder.getTrace().size(), headerSize);
+}
+
+TEST(ApduTraceTest, transmitApdu_shouldReplayTheExchangesOfTheTarget)
+{
+    const std::vector<uint8_t> trace = recordTrace();
+    ReplayCardReader cardReader("card", true, trace, ApduExchangeEvent::Target::CARD);
+    ReplayCardReader samReader("sam", false, trace, ApduExchangeEvent::Target::SAM);
+    std::vector<uint8_t> response;
+
+    cardReader.transmitApdu(SELECT_APPLICATION, response);
+    ASSERT_EQ(response, std::vector<uint8_t>({0x6F, 0x00, 0x90, 0x00}));
+    samReader.transmitApdu(SELECT_DIVERSIFIER, response);
+    ASSERT_EQ(response, SW_9000);
+    samReader.transmitApdu(GET_CHALLENGE, response);
+    ASSERT_EQ(response, std::vector<uint8_t>({0x01, 0x02, 0x03, 0x04, 0x90, 0x00}));
+    ASSERT_FALSE(samReader.isCardPresent());
+    cardReader.transmitApdu(READ_RECORD, response);
+    ASSERT_EQ(response, std::vector<uint8_t>({0x11, 0x90, 0x00}));
+    ASSERT_TRUE(cardReader.isCardPresent());
+    cardReader.transmitApdu(READ_RECORD, response);
+    ASSERT_EQ(response, std::vector<uint8_t>({0x22, 0x90, 0x00}));
+    ASSERT_FALSE(cardReader.isCardPresent());
+    ASSERT_EQ(cardReader.getApdusNumber(), 3);
+
+    EXPECT_THROW(cardReader.transmitApdu(READ_RECORD, response), IllegalStateException);
+
+    cardReader.rewind();
+    cardReader.transmitApdu(SELECT_APPLICATION, response);
+    ASSERT_EQ(response, std::vector<uint8_t>({0x6F, 0x00, 0x90, 0x00}));
+}
+
+TEST(ApduTraceTest, transmitCardRequest_shouldReplayTheExchangesOfTheTarget)
+{
+    const std::vector<uint8_t> trace = recordTrace();
+    const std::shared_ptr<CardReader> cardReader =
+        std::make_shared<ReplayCardReader>("card", true, trace, ApduExchangeEvent::Target::CARD);
+    const auto proxyReader = std::dynamic_pointer_cast<ProxyReaderApi>(cardReader);
+    ASSERT_NE(proxyReader, nullptr);
+
+    const std::shared_ptr<CardResponseApi> cardResponse = proxyReader->transmitCardRequest(
+        std::make_shared<ATT_CardRequest>(
+            std::vector<std::vector<uint8_t>>({SELECT_APPLICATION, READ_RECORD, READ_RECORD})),
+        ChannelControl::CLOSE_AFTER);
+
+    ASSERT_EQ(cardResponse->getApduResponses().size(), 3u);
+    ASSERT_EQ(cardResponse->getApduResponses()[2]->getDataOut(), std::vector<uint8_t>({0x22}));
+    ASSERT_EQ(cardResponse->getApduResponses()[2]->getStatusWord(), 0x9000);
+    ASSERT_FALSE(cardResponse->isLogicalChannelOpen());
+    ASSERT_FALSE(cardReader->isCardPresent());
+    EXPECT_THROW(proxyReader->transmitCardRequest(
+                     std::make_shared<ATT_CardRequest>(
+                         std::vector<std::vector<uint8_t>>({READ_RECORD})),
+                     ChannelControl::KEEP_OPEN),
+                 CardBrokenCommunicationException);
+}
+
+TEST(ApduTraceTest, transmitApdu_whenApduDiverges_shouldThrowISE)
+{
+    const std::vector<uint8_t> trace = recordTrace();
+    ReplayCardReader cardReader("card", true, trace, ApduExchangeEvent::Target::CARD);
+    std::vector<uint8_t> response;
+
+    EXPECT_THROW(cardReader.transmitApdu(READ_RECORD, response), IllegalStateException);
+}
+
+TEST(ApduTraceTest, transmitApdu_withLatencyFactor_shouldWaitTheRecordedLatency)
+{
+    const std::vector<uint8_t> trace = recordTrace();
+    ReplayCardReader cardReader("card", true, trace, ApduExchangeEvent::Target::CARD);
+    std::vector<uint8_t> response;
+    cardReader.setLatencyFactor(1);
+
+    const auto start = std::chrono::steady_clock::now();
+    cardReader.transmitApdu(SELECT_APPLICATION, response);
+
+    ASSERT_GE(std::chrono::steady_clock::now() - start, std::chrono::microseconds(2000));
+    EXPECT_THROW(cardReader.setLatencyFactor(-1), IllegalArgumentException);
+}
@@ -0,0 +1,68 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include <sstream>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+/* Calypsonet Terminal Calypso */
+#include "ByteView.h"
+
+using namespace testing;
+
+using namespace calypsonet::terminal::calypso;
+
+TEST(ByteViewTest, defaultConstructor_shouldBeEmpty)
+{
+    const ByteView view;
+
+    ASSERT_TRUE(view.empty());
+    ASSERT_EQ(view.size(), 0);
+    ASSERT_EQ(view.data(), nullptr);
+}
+
+TEST(ByteViewTest, vectorConstructor_shouldReferenceVectorWithoutCopy)
+{
+    const std::vector<uint8_t> data = {0x11, 0x22, 0x33};
+    const ByteView view(data);
+
+    ASSERT_EQ(view.data(), data.data());
+    ASSERT_EQ(view.size(), 3);
+    ASSERT_EQ(view[1], 0x22);
+    ASSERT_EQ(view.toVector(), data);
+}
+
+TEST(ByteViewTest, subView_whenInBounds_shouldReturnSubset)
+{
+    const std::vector<uint8_t> data = {0x11, 0x22, 0x33, 0x44};
+    const ByteView view = ByteView(data).subView(1, 2);
+
+    ASSERT_EQ(view.toVector(), std::vector<uint8_t>({0x22, 0x33}));
+}
+
+TEST(ByteViewTest, subView_whenOutOfBounds_shouldThrowIOOBE)
+{
+    const std::vector<uint8_t> data = {0x11, 0x22, 0x33, 0x44};
+
+    EXPECT_THROW(ByteView(data).subView(3, 2), IndexOutOfBoundsException);
+}
+
+TEST(ByteViewTest, operatorOutput_shouldPrintHex)
+{
+    const std::vector<uint8_t> data = {0x0A, 0xBC};
+    std::stringstream ss;
+
+    ss << ByteView(data);
+
+    ASSERT_EQ(ss.str(), "0ABC");
+}
@@ -0,0 +1,241 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+
+#include <atomic>
+#include <thread>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+/* Calypsonet Terminal Calypso */
+#include "CachingSamRevocationService.h"
+
+using namespace testing;
+
+using namespace calypsonet::terminal::calypso::transaction;
+
+static const std::vector<uint8_t> SAM_REVOKED = {0x11, 0x22, 0x33, 0x44};
+static const std::vector<uint8_t> SAM_NOT_REVOKED = {0x11, 0x22, 0x33, 0x45};
+
+/* The SAMs whose serial number ends with 0x44 are revoked from counter 10 */
+class CountingSamRevocationService final : public SamRevocationServiceSpi {
+public:
+    CountingSamRevocationService() : mChecksNumber(0), mBatchesNumber(0) {}
+
+    bool isSamRevoked(const std::vector<uint8_t>& serialNumber) const override
+    {
+        mChecksNumber++;
+
+        return serialNumber.back() == 0x44;
+    }
+
+    bool isSamRevoked(const std::vector<uint8_t>& serialNumber, const int counterValue)
+        const override
+    {
+        mChecksNumber++;
+
+        return serialNumber.back() == 0x44 && counterValue >= 10;
+    }
+
+    void areSamsRevoked(const std::vector<RevocationQuery>& queries,
+                        std::vector<bool>& revoked) const override
+    {
+        mBatchesNumber++;
+        SamRevocationServiceSpi::areSamsRevoked(queries, revoked);
+    }
+
+    int getChecksNumber() const
+    {
+        return mChecksNumber;
+    }
+
+    int getBatchesNumber() const
+    {
+        return mBatchesNumber;
+    }
+
+private:
+    mutable std::atomic<int> mChecksNumber;
+    mutable std::atomic<int> mBatchesNumber;
+};
+
+TEST(CachingSamRevocationServiceTest, constructor_whenServiceIsNull_shouldThrowIAE)
+{
+    EXPECT_THROW(CachingSamRevocationService(nullptr, 16, std::chrono::milliseconds(1000)),
+                 IllegalArgumentException);
+}
+
+TEST(CachingSamRevocationServiceTest, isSamRevoked_whenCheckedTwice_shouldForwardOnce)
+{
+    const auto service = std::make_shared<CountingSamRevocationService>();
+    CachingSamRevocationService cache(service, 16, std::chrono::milliseconds(60000));
+
+    ASSERT_TRUE(cache.isSamRevoked(SAM_REVOKED, 10));
+    ASSERT_TRUE(cache.isSamRevoked(SAM_REVOKED, 10));
+    ASSERT_FALSE(cache.isSamRevoked(SAM_NOT_REVOKED));
+    ASSERT_FALSE(cache.isSamRevoked(SAM_NOT_REVOKED));
+
+    ASSERT_EQ(service->getChecksNumber(), 2);
+    ASSERT_EQ(cache.getHitsNumber(), 2);
+    ASSERT_EQ(cache.getMissesNumber(), 2);
+}
+
+TEST(CachingSamRevocationServiceTest, isSamRevoked_shouldDistinguishCounterAndPartialChecks)
+{
+    const auto service = std::make_shared<CountingSamRevocationService>();
+    CachingSamRevocationService cache(service, 1024, std::chrono::milliseconds(60000));
+
+    ASSERT_FALSE(cache.isSamRevoked(SAM_REVOKED, 9));
+    ASSERT_TRUE(cache.isSamRevoked(SAM_REVOKED, 10));
+    ASSERT_TRUE(cache.isSamRevoked(SAM_REVOKED));
+    ASSERT_TRUE(cache.isSamRevokedBySerial3(
+        {{0x22, 0x33, 0x44}}, SamRevocationServiceSpi::RevocationQuery::NO_COUNTER));
+    ASSERT_FALSE(cache.isSamRevokedBySerial4({{0x11, 0x22, 0x33, 0x44}}, 9));
+
+    ASSERT_EQ(service->getChecksNumber(), 4);
+}
+
+TEST(CachingSamRevocationServiceTest, invalidate_shouldForgetAnswers)
+{
+    const auto service = std::make_shared<CountingSamRevocationService>();
+    CachingSamRevocationService cache(service, 16, std::chrono::milliseconds(60000));
+
+    cache.isSamRevoked(SAM_REVOKED);
+    cache.invalidate();
+    cache.isSamRevoked(SAM_REVOKED);
+
+    ASSERT_EQ(service->getChecksNumber(), 2);
+}
+
+/* Invalidates the cache while the first check is in progress */
+class InvalidatingSamRevocationService final : public SamRevocationServiceSpi {
+public:
+    InvalidatingSamRevocationService() : cache(nullptr), checksNumber(0) {}
+
+    bool isSamRevoked(const std::vector<uint8_t>& serialNumber) const override
+    {
+        return isSamRevoked(serialNumber, 0);
+    }
+
+    bool isSamRevoked(const std::vector<uint8_t>& serialNumber, const int counterValue)
+        const override
+    {
+        (void)serialNumber;
+        (void)counterValue;
+
+        if (checksNumber++ == 0) {
+            cache->invalidate();
+        }
+
+        return false;
+    }
+
+    CachingSamRevocationService* cache;
+    mutable int checksNumber;
+};
+
+TEST(CachingSamRevocationServiceTest, invalidate_duringCheck_shouldNotReuseAnswer)
+{
+    const auto service = std::make_shared<InvalidatingSamRevocationService>();
+    CachingSamRevocationService cache(service, 16, std::chrono::milliseconds(60000));
+    service->cache = &cache;
+
+    cache.isSamRevoked(SAM_REVOKED);
+    cache.isSamRevoked(SAM_REVOKED);
+    cache.isSamRevoked(SAM_REVOKED);
+
+    ASSERT_EQ(service->checksNumber, 2);
+}
+
+TEST(CachingSamRevocationServiceTest, isSamRevoked_whenTimeToLiveIsHuge_shouldReuseAnswer)
+{
+    const auto service = std::make_shared<CountingSamRevocationService>();
+    CachingSamRevocationService cache(service, 16, std::chrono::milliseconds::max());
+
+    cache.isSamRevoked(SAM_REVOKED);
+    cache.isSamRevoked(SAM_REVOKED);
+
+    ASSERT_EQ(service->getChecksNumber(), 1);
+}
+
+TEST(CachingSamRevocationServiceTest, isSamRevoked_whenTimeToLiveIsNull_shouldAlwaysForward)
+{
+    const auto service = std::make_shared<CountingSamRevocationService>();
+    CachingSamRevocationService cache(service, 16, std::chrono::milliseconds(0));
+
+    cache.isSamRevoked(SAM_REVOKED);
+    cache.isSamRevoked(SAM_REVOKED);
+
+    ASSERT_EQ(service->getChecksNumber(), 2);
+}
+
+TEST(CachingSamRevocationServiceTest, isSamRevoked_whenNotCacheable_shouldForward)
+{
+    const auto service = std::make_shared<CountingSamRevocationService>();
+    CachingSamRevocationService cache(service, 16, std::chrono::milliseconds(60000));
+    const std::vector<uint8_t> invalid = {0x33, 0x44};
+
+    ASSERT_TRUE(cache.isSamRevoked(invalid));
+    ASSERT_TRUE(cache.isSamRevoked(invalid));
+
+    ASSERT_EQ(service->getChecksNumber(), 2);
+}
+
+TEST(CachingSamRevocationServiceTest, areSamsRevoked_shouldForwardOnlyMissesInOneBatch)
+{
+    const auto service = std::make_shared<CountingSamRevocationService>();
+    CachingSamRevocationService cache(service, 1024, std::chrono::milliseconds(60000));
+    const std::vector<SamRevocationServiceSpi::RevocationQuery> queries = {
+        {std::array<uint8_t, 4>({{0x11, 0x22, 0x33, 0x44}}), 10},
+        {std::array<uint8_t, 4>({{0x11, 0x22, 0x33, 0x45}}), 10},
+        {std::array<uint8_t, 3>({{0x22, 0x33, 0x44}}), 9}};
+    std::vector<bool> revoked;
+
+    cache.isSamRevoked(SAM_REVOKED, 10);
+    cache.areSamsRevoked(queries, revoked);
+
+    ASSERT_EQ(revoked, std::vector<bool>({true, false, false}));
+    ASSERT_EQ(service->getBatchesNumber(), 1);
+    ASSERT_EQ(service->getChecksNumber(), 3);
+
+    cache.areSamsRevoked(queries, revoked);
+
+    ASSERT_EQ(revoked, std::vector<bool>({true, false, false}));
+    ASSERT_EQ(service->getBatchesNumber(), 1);
+}
+
+TEST(CachingSamRevocationServiceTest, isSamRevoked_fromSeveralThreads_shouldBeConsistent)
+{
+    const auto service = std::make_shared<CountingSamRevocationService>();
+    CachingSamRevocationService cache(service, 64, std::chrono::milliseconds(60000));
+    std::atomic<int> errorsNumber(0);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&cache, &errorsNumber, t] {
+            for (int i = 0; i < 10000; i++) {
+                const uint8_t last = static_cast<uint8_t>(0x40 + (i + t) % 8);
+                if (cache.isSamRevoked(std::vector<uint8_t>({0x11, 0x22, 0x33, last}), i % 20) !=
+                    (last == 0x44 && i % 20 >= 10)) {
+                    errorsNumber++;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(errorsNumber, 0);
+    ASSERT_GT(cache.getHitsNumber(), 0);
+}
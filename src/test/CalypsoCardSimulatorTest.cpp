@@ -0,0 +1,361 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+/* Calypsonet Terminal Calypso */
+#include "CalypsoCardSimulator.h"
+#include "CalypsoSamSimulator.h"
+
+using namespace testing;
+
+using namespace calypsonet::terminal::calypso;
+using namespace calypsonet::terminal::calypso::card;
+using namespace calypsonet::terminal::calypso::sim;
+
+static const uint64_t MASTER_KEY = 0x0123456789ABCDEFULL;
+static const std::vector<uint8_t> DF_NAME = {0xA0, 0x00, 0x00, 0x04, 0x04, 0x01, 0x25, 0x09, 0x01};
+static const std::vector<uint8_t> SERIAL_NUMBER = {0, 0, 0, 0, 0x12, 0x34, 0x56, 0x78};
+static const std::vector<uint8_t> SW_9000 = {0x90, 0x00};
+
+class CCST_DirectoryHeader final : public DirectoryHeader {
+public:
+    uint16_t getLid() const override { return 0x3F00; }
+    uint8_t getDfStatus() const override { return 0x00; }
+    const std::vector<uint8_t>& getAccessConditions() const override { return mBytes; }
+    const std::vector<uint8_t>& getKeyIndexes() const override { return mBytes; }
+    uint8_t getKif(const WriteAccessLevel level) const override
+    {
+        return level == WriteAccessLevel::DEBIT ? 0x30 : 0x27;
+    }
+    uint8_t getKvc(const WriteAccessLevel level) const override
+    {
+        return level == WriteAccessLevel::DEBIT ? 0x79 : 0x78;
+    }
+
+private:
+    const std::vector<uint8_t> mBytes = {0x10, 0x10, 0x10, 0x10};
+};
+
+class CCST_FileHeader final : public FileHeader {
+public:
+    CCST_FileHeader(const uint16_t lid,
+                    const ElementaryFile::Type type,
+                    const int recordsNumber,
+                    const int recordSize)
+    : mLid(lid), mType(type), mRecordsNumber(recordsNumber), mRecordSize(recordSize) {}
+
+    uint16_t getLid() const override { return mLid; }
+    const std::shared_ptr<uint8_t> getDfStatus() const override { return nullptr; }
+    ElementaryFile::Type getEfType() const override { return mType; }
+    int getRecordsNumber() const override { return mRecordsNumber; }
+    int getRecordSize() const override { return mRecordSize; }
+    const std::vector<uint8_t>& getAccessConditions() const override { return mBytes; }
+    const std::vector<uint8_t>& getKeyIndexes() const override { return mBytes; }
+    const std::shared_ptr<uint16_t> getSharedReference() const override { return nullptr; }
+
+private:
+    const uint16_t mLid;
+    const ElementaryFile::Type mType;
+    const int mRecordsNumber;
+    const int mRecordSize;
+    const std::vector<uint8_t> mBytes = {0x1F, 0x1F, 0x1F, 0x1F};
+};
+
+/* Plays the role of a transaction manager: forwards the session APDUs to the SAM */
+class CCST_Terminal {
+public:
+    CCST_Terminal()
+    : card(DF_NAME, SERIAL_NUMBER, std::make_shared<CCST_DirectoryHeader>(), MASTER_KEY),
+      sam({0xAA, 0xBB, 0xCC, 0xDD}, MASTER_KEY)
+    {
+        card.addFile(0x07,
+                     std::make_shared<CCST_FileHeader>(
+                         0x2001, ElementaryFile::Type::LINEAR, 4, 29))
+            .addFile(0x08,
+                     std::make_shared<CCST_FileHeader>(
+                         0x2010, ElementaryFile::Type::CYCLIC, 3, 29))
+            .addFile(0x19,
+                     std::make_shared<CCST_FileHeader>(
+                         0x2069, ElementaryFile::Type::COUNTERS, 1, 9))
+            .enableSv(100);
+    }
+
+    std::vector<uint8_t> toCard(const std::vector<uint8_t>& apdu)
+    {
+        std::vector<uint8_t> response;
+        card.processApdu(apdu, response);
+
+        if (mSessionOpen) {
+            digestUpdate(apdu);
+            digestUpdate(response);
+        }
+
+        return response;
+    }
+
+    std::vector<uint8_t> toSam(const std::vector<uint8_t>& apdu)
+    {
+        std::vector<uint8_t> response;
+        sam.processApdu(apdu, response);
+
+        return response;
+    }
+
+    std::vector<uint8_t> openSession()
+    {
+        std::vector<uint8_t> selectDiversifier = {0x80, 0x14, 0x00, 0x00, 0x08};
+        selectDiversifier.insert(selectDiversifier.end(),
+                                 SERIAL_NUMBER.begin(),
+                                 SERIAL_NUMBER.end());
+        EXPECT_EQ(toSam(selectDiversifier), SW_9000);
+
+        const std::vector<uint8_t> challenge = toSam({0x80, 0x84, 0x00, 0x00, 0x04});
+        std::vector<uint8_t> open = {0x00, 0x8A, 0x0B, 0x39, 0x05, 0x00};
+        open.insert(open.end(), challenge.begin(), challenge.begin() + 4);
+        open.push_back(0x00);
+        const std::vector<uint8_t> response = toCard(open);
+
+        std::vector<uint8_t> digestInit = {0x80, 0x8A, 0x00, 0xFF,
+                                           static_cast<uint8_t>(response.size()), 0x30, 0x79};
+        digestInit.insert(digestInit.end(), response.begin(), response.end() - 2);
+        EXPECT_EQ(toSam(digestInit), SW_9000);
+        mSessionOpen = true;
+
+        return response;
+    }
+
+    std::vector<uint8_t> closeSession(const bool corruptSignature)
+    {
+        mSessionOpen = false;
+        std::vector<uint8_t> signature = toSam({0x80, 0x8E, 0x00, 0x00, 0x04});
+        if (corruptSignature) {
+            signature[0] ^= 0xFF;
+        }
+
+        std::vector<uint8_t> close = {0x00, 0x8E, 0x00, 0x00, 0x04};
+        close.insert(close.end(), signature.begin(), signature.begin() + 4);
+        close.push_back(0x04);
+
+        return toCard(close);
+    }
+
+    CalypsoCardSimulator card;
+    CalypsoSamSimulator sam;
+
+private:
+    void digestUpdate(const std::vector<uint8_t>& data)
+    {
+        std::vector<uint8_t> apdu = {0x80, 0x8C, 0x00, 0x00, static_cast<uint8_t>(data.size())};
+        apdu.insert(apdu.end(), data.begin(), data.end());
+        EXPECT_EQ(toSam(apdu), SW_9000);
+    }
+
+    bool mSessionOpen = false;
+};
+
+static std::vector<uint8_t> updateRecord(const uint8_t sfi,
+                                         const uint8_t numRecord,
+                                         const std::vector<uint8_t>& data)
+{
+    std::vector<uint8_t> apdu = {0x00,
+                                 0xDC,
+                                 numRecord,
+                                 static_cast<uint8_t>((sfi << 3) | 4),
+                                 static_cast<uint8_t>(data.size())};
+    apdu.insert(apdu.end(), data.begin(), data.end());
+
+    return apdu;
+}
+
+TEST(CalypsoCardSimulatorTest, constructor_whenSerialNumberIsInvalid_shouldThrowIAE)
+{
+    EXPECT_THROW(CalypsoCardSimulator(DF_NAME, {0x01}, std::make_shared<CCST_DirectoryHeader>(), 0),
+                 IllegalArgumentException);
+}
+
+TEST(CalypsoCardSimulatorTest, addFile_whenRecordSizeExceedsMaximum_shouldThrowIAE)
+{
+    CalypsoCardSimulator card(DF_NAME, SERIAL_NUMBER, std::make_shared<CCST_DirectoryHeader>(), 0);
+
+    EXPECT_THROW(card.addFile(0x07,
+                              std::make_shared<CCST_FileHeader>(
+                                  0x2001, ElementaryFile::Type::BINARY, 1, 255)),
+                 IllegalArgumentException);
+}
+
+TEST(CalypsoCardSimulatorTest, selectApplication_whenAidIsTruncatedDfName_shouldReturnFci)
+{
+    CCST_Terminal terminal;
+
+    const std::vector<uint8_t> fci = terminal.toCard({0x00, 0xA4, 0x04, 0x00, 0x05, 0xA0, 0x00,
+                                                      0x00, 0x04, 0x04, 0x00});
+
+    ASSERT_EQ(fci[0], 0x6F);
+    ASSERT_EQ(fci.size(), fci[1] + 4u);
+    ASSERT_TRUE(std::search(fci.begin(), fci.end(), SERIAL_NUMBER.begin(), SERIAL_NUMBER.end()) !=
+                fci.end());
+    ASSERT_EQ(std::vector<uint8_t>(fci.end() - 2, fci.end()), SW_9000);
+}
+
+TEST(CalypsoCardSimulatorTest, selectApplication_whenAidDoesNotMatch_shouldReturn6A82)
+{
+    CCST_Terminal terminal;
+
+    ASSERT_EQ(terminal.toCard({0x00, 0xA4, 0x04, 0x00, 0x05, 0xA0, 0x00, 0x00, 0x04, 0x05, 0x00}),
+              std::vector<uint8_t>({0x6A, 0x82}));
+}
+
+TEST(CalypsoCardSimulatorTest, selectFile_byLid_shouldReturnFcp)
+{
+    CCST_Terminal terminal;
+
+    const std::vector<uint8_t> fcp =
+        terminal.toCard({0x00, 0xA4, 0x09, 0x00, 0x02, 0x20, 0x10, 0x00});
+
+    ASSERT_EQ(fcp.size(), 27u);
+    ASSERT_EQ(fcp[0], 0x85);
+    ASSERT_EQ(fcp[2], 0x08);
+    ASSERT_EQ(fcp[4], 0x04);
+    ASSERT_EQ(fcp[23], 0x20);
+    ASSERT_EQ(fcp[24], 0x10);
+}
+
+TEST(CalypsoCardSimulatorTest, updateRecord_outsideSession_shouldModifyRecord)
+{
+    CCST_Terminal terminal;
+
+    ASSERT_EQ(terminal.toCard(updateRecord(0x07, 2, {0x11, 0x22})), SW_9000);
+    ASSERT_EQ(terminal.toCard({0x00, 0xB2, 0x02, 0x3C, 0x00})[1], 0x22);
+    ASSERT_EQ(terminal.card.getRecord(0x07, 2).size(), 29u);
+}
+
+TEST(CalypsoCardSimulatorTest, readRecords_whenMultiple_shouldReturnNumberedRecords)
+{
+    CCST_Terminal terminal;
+
+    const std::vector<uint8_t> response = terminal.toCard({0x00, 0xB2, 0x01, 0x3D, 0x3E});
+
+    ASSERT_EQ(response.size(), 2u * (2 + 29) + 2);
+    ASSERT_EQ(response[0], 1);
+    ASSERT_EQ(response[1], 29);
+    ASSERT_EQ(response[31], 2);
+}
+
+TEST(CalypsoCardSimulatorTest, readRecord_whenRecordDoesNotExist_shouldReturn6A83)
+{
+    CCST_Terminal terminal;
+
+    ASSERT_EQ(terminal.toCard({0x00, 0xB2, 0x05, 0x3C, 0x00}), std::vector<uint8_t>({0x6A, 0x83}));
+}
+
+TEST(CalypsoCardSimulatorTest, session_whenSignaturesAreValid_shouldCommitModifications)
+{
+    CCST_Terminal terminal;
+    const int transactionCounter = terminal.card.getTransactionCounter();
+
+    terminal.openSession();
+    ASSERT_EQ(terminal.toCard(updateRecord(0x07, 1, {0x55})), SW_9000);
+    const std::vector<uint8_t> response = terminal.closeSession(false);
+
+    ASSERT_EQ(response.size(), 6u);
+    ASSERT_EQ(std::vector<uint8_t>(response.end() - 2, response.end()), SW_9000);
+    ASSERT_EQ(terminal.card.getRecord(0x07, 1)[0], 0x55);
+    ASSERT_EQ(terminal.card.getTransactionCounter(), transactionCounter - 1);
+
+    std::vector<uint8_t> authenticate = {0x80, 0x82, 0x00, 0x00, 0x04};
+    authenticate.insert(authenticate.end(), response.begin(), response.begin() + 4);
+    ASSERT_EQ(terminal.toSam(authenticate), SW_9000);
+}
+
+TEST(CalypsoCardSimulatorTest, session_whenTerminalSignatureIsWrong_shouldRollback)
+{
+    CCST_Terminal terminal;
+
+    terminal.openSession();
+    ASSERT_EQ(terminal.toCard(updateRecord(0x07, 1, {0x55})), SW_9000);
+    ASSERT_EQ(terminal.toCard({0x00, 0x32, 0x01, 0xC8, 0x03, 0x00, 0x00, 0x01}),
+              std::vector<uint8_t>({0x00, 0x00, 0x01, 0x90, 0x00}));
+
+    ASSERT_EQ(terminal.closeSession(true), std::vector<uint8_t>({0x69, 0x88}));
+    ASSERT_FALSE(terminal.card.isSessionOpen());
+    ASSERT_EQ(terminal.card.getRecord(0x07, 1)[0], 0x00);
+    ASSERT_EQ(terminal.card.getRecord(0x19, 1)[2], 0x00);
+}
+
+TEST(CalypsoCardSimulatorTest, session_whenAborted_shouldRollback)
+{
+    CCST_Terminal terminal;
+    terminal.card.setRecord(0x19, 1, std::vector<uint8_t>({0x00, 0x00, 0x0A}));
+
+    terminal.openSession();
+    ASSERT_EQ(terminal.toCard({0x00, 0x30, 0x01, 0xC8, 0x03, 0x00, 0x00, 0x04}),
+              std::vector<uint8_t>({0x00, 0x00, 0x06, 0x90, 0x00}));
+    ASSERT_EQ(terminal.toCard({0x00, 0x8E, 0x00, 0x00, 0x00}), SW_9000);
+
+    ASSERT_EQ(terminal.card.getRecord(0x19, 1)[2], 0x0A);
+}
+
+TEST(CalypsoCardSimulatorTest, session_whenSessionBufferIsExceeded_shouldReturn6400)
+{
+    CCST_Terminal terminal;
+    const std::vector<uint8_t> record(29, 0x01);
+
+    terminal.openSession();
+    int used = 0;
+    std::vector<uint8_t> response;
+    do {
+        response = terminal.toCard(updateRecord(0x07, 1, record));
+        used += 29 + 6;
+    } while (response == SW_9000);
+
+    ASSERT_EQ(response, std::vector<uint8_t>({0x64, 0x00}));
+    ASSERT_GT(used, terminal.card.getSessionBufferSize());
+    ASSERT_LE(used - 35, terminal.card.getSessionBufferSize());
+}
+
+TEST(CalypsoCardSimulatorTest, decrease_whenCounterUnderflows_shouldReturn6400)
+{
+    CCST_Terminal terminal;
+
+    ASSERT_EQ(terminal.toCard({0x00, 0x30, 0x01, 0xC8, 0x03, 0x00, 0x00, 0x01}),
+              std::vector<uint8_t>({0x64, 0x00}));
+}
+
+TEST(CalypsoCardSimulatorTest, svDebit_afterSvGet_shouldUpdateBalanceAndLog)
+{
+    CCST_Terminal terminal;
+
+    const std::vector<uint8_t> svGet = terminal.toCard({0x00, 0x7C, 0x00, 0x09, 0x00});
+    ASSERT_EQ(svGet.size(), 11u + 19 + 2);
+    ASSERT_EQ(svGet[10], 100);
+
+    ASSERT_EQ(terminal.toCard({0x00, 0xBA, 0x00, 0x00, 0x0E, 0x00, 0x0A, 0x12, 0x34, 0x56, 0x78,
+                               0x79, 0xAA, 0xBB, 0xCC, 0xDD, 0x00, 0x00, 0x01}),
+              SW_9000);
+    ASSERT_EQ(terminal.card.getSvBalance(), 90);
+    ASSERT_EQ(terminal.card.getSvTNum(), 1);
+
+    const std::vector<uint8_t> log = terminal.toCard({0x00, 0x7C, 0x00, 0x09, 0x00});
+    ASSERT_EQ(log[11 + 1], 0x0A);
+    ASSERT_EQ(log[11 + 16], 90);
+}
+
+TEST(CalypsoCardSimulatorTest, svDebit_withoutSvGet_shouldReturn6985)
+{
+    CCST_Terminal terminal;
+
+    ASSERT_EQ(terminal.toCard({0x00, 0xBA, 0x00, 0x00, 0x0E, 0x00, 0x0A, 0x12, 0x34, 0x56, 0x78,
+                               0x79, 0xAA, 0xBB, 0xCC, 0xDD, 0x00, 0x00, 0x01}),
+              std::vector<uint8_t>({0x69, 0x85}));
+}
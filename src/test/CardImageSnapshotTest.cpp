@@ -0,0 +1,441 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+/* Calypsonet Terminal Calypso */
+#include "CardImageSnapshot.h"
+#include "CardImageSnapshotWriter.h"
+#include "SnapshotCalypsoCard.h"
+
+/* Keyple Core Util */
+#include "IllegalArgumentException.h"
+#include "IllegalStateException.h"
+#include "IndexOutOfBoundsException.h"
+
+using namespace testing;
+
+using namespace calypsonet::terminal::calypso;
+using namespace calypsonet::terminal::calypso::card;
+using namespace keyple::core::util::cpp::exception;
+
+class CIST_CalypsoCardMock : public CalypsoCard {
+public:
+    MOCK_METHOD(const std::string&, getPowerOnData, (), (const, override));
+    MOCK_METHOD(const std::vector<uint8_t>, getSelectApplicationResponse, (), (const, override));
+    MOCK_METHOD(const ProductType&, getProductType, (), (const, override));
+    MOCK_METHOD(bool, isHce, (), (const, override));
+    MOCK_METHOD(bool, isDfInvalidated, (), (const, override));
+    MOCK_METHOD(const std::vector<uint8_t>&, getDfName, (), (const, override));
+    MOCK_METHOD(const std::vector<uint8_t>, getApplicationSerialNumber, (), (const, override));
+    MOCK_METHOD(const ByteView, getDfNameView, (), (const, override));
+    MOCK_METHOD(const ByteView, getApplicationSerialNumberView, (), (const, override));
+    MOCK_METHOD(const std::vector<uint8_t>&, getStartupInfoRawData, (), (const, override));
+    MOCK_METHOD(uint8_t, getPlatform, (), (const, override));
+    MOCK_METHOD(uint8_t, getApplicationType, (), (const, override));
+    MOCK_METHOD(uint8_t, getApplicationSubtype, (), (const, override));
+    MOCK_METHOD(uint8_t, getSoftwareIssuer, (), (const, override));
+    MOCK_METHOD(uint8_t, getSoftwareVersion, (), (const, override));
+    MOCK_METHOD(uint8_t, getSoftwareRevision, (), (const, override));
+    MOCK_METHOD(uint8_t, getSessionModification, (), (const, override));
+    MOCK_METHOD(const std::vector<uint8_t>, getTraceabilityInformation, (), (const, override));
+    MOCK_METHOD(const std::shared_ptr<DirectoryHeader>, getDirectoryHeader, (), (const, override));
+    MOCK_METHOD(const std::shared_ptr<ElementaryFile>,
+                getFileBySfi,
+                (const uint8_t),
+                (const, override));
+    MOCK_METHOD(const std::shared_ptr<ElementaryFile>,
+                getFileByLid,
+                (const uint16_t),
+                (const, override));
+    using FileMap = std::map<const uint8_t, const std::shared_ptr<ElementaryFile>>;
+    MOCK_METHOD(const FileMap, getAllFiles, (), (const, override));
+    MOCK_METHOD(const std::vector<std::shared_ptr<ElementaryFile>>&,
+                getFiles,
+                (),
+                (const, override));
+    MOCK_METHOD(bool, isDfRatified, (), (const, override));
+    MOCK_METHOD(int, getTransactionCounter, (), (const, override));
+    MOCK_METHOD(bool, isPkiModeSupported, (), (const, override));
+    MOCK_METHOD(bool, isExtendedModeSupported, (), (const, override));
+    MOCK_METHOD(bool, isRatificationOnDeselectSupported, (), (const, override));
+    MOCK_METHOD(bool, isPinFeatureAvailable, (), (const, override));
+    MOCK_METHOD(bool, isPinBlocked, (), (const, override));
+    MOCK_METHOD(int, getPinAttemptRemaining, (), (const, override));
+    MOCK_METHOD(bool, isSvFeatureAvailable, (), (const, override));
+    MOCK_METHOD(int, getSvBalance, (), (const, override));
+    MOCK_METHOD(int, getSvLastTNum, (), (const, override));
+    MOCK_METHOD(const std::shared_ptr<SvLoadLogRecord>, getSvLoadLogRecord, (), (override));
+    MOCK_METHOD(const std::shared_ptr<SvDebitLogRecord>, getSvDebitLogLastRecord, (), (override));
+    MOCK_METHOD(const std::vector<std::shared_ptr<SvDebitLogRecord>>,
+                getSvDebitLogAllRecords,
+                (),
+                (const, override));
+};
+
+class CIST_ElementaryFileMock : public ElementaryFile {
+public:
+    MOCK_METHOD(uint8_t, getSfi, (), (const, override));
+    MOCK_METHOD(const std::shared_ptr<FileHeader>, getHeader, (), (const, override));
+    MOCK_METHOD(const std::shared_ptr<FileData>, getData, (), (const, override));
+};
+
+class CIST_FileHeaderMock : public FileHeader {
+public:
+    MOCK_METHOD(uint16_t, getLid, (), (const, override));
+    MOCK_METHOD(const std::shared_ptr<uint8_t>, getDfStatus, (), (const, override));
+    MOCK_METHOD(ElementaryFile::Type, getEfType, (), (const, override));
+    MOCK_METHOD(int, getRecordsNumber, (), (const, override));
+    MOCK_METHOD(int, getRecordSize, (), (const, override));
+    MOCK_METHOD(const std::vector<uint8_t>&, getAccessConditions, (), (const, override));
+    MOCK_METHOD(const std::vector<uint8_t>&, getKeyIndexes, (), (const, override));
+    MOCK_METHOD(const std::shared_ptr<uint16_t>, getSharedReference, (), (const, override));
+};
+
+class CIST_FileDataMock : public FileData {
+public:
+    MOCK_METHOD(const std::vector<uint8_t>, getContent, (), (const, override));
+    MOCK_METHOD(const std::vector<uint8_t>, getContent, (const uint8_t), (const, override));
+    MOCK_METHOD(const std::vector<uint8_t>,
+                getContent,
+                (const uint8_t, const uint8_t, const uint8_t),
+                (const, override));
+    MOCK_METHOD(const ByteView, getContentView, (), (const, override));
+    MOCK_METHOD(const ByteView, getContentView, (const uint8_t), (const, override));
+    using RecordMap = std::map<const uint8_t, std::vector<uint8_t>>;
+    MOCK_METHOD(const RecordMap&, getAllRecordsContent, (), (const, override));
+    MOCK_METHOD(const RecordStore&, getRecordStore, (), (const, override));
+    MOCK_METHOD(const std::shared_ptr<int>,
+                getContentAsCounterValue,
+                (const int),
+                (const, override));
+    using CounterMap = std::map<const int, const int>;
+    MOCK_METHOD(const CounterMap, getAllCountersValue, (), (const, override));
+    MOCK_METHOD(const CounterView, getCountersView, (), (const, override));
+};
+
+class CIST_DirectoryHeaderMock : public DirectoryHeader {
+public:
+    MOCK_METHOD(uint16_t, getLid, (), (const, override));
+    MOCK_METHOD(uint8_t, getDfStatus, (), (const, override));
+    MOCK_METHOD(const std::vector<uint8_t>&, getAccessConditions, (), (const, override));
+    MOCK_METHOD(const std::vector<uint8_t>&, getKeyIndexes, (), (const, override));
+    MOCK_METHOD(uint8_t, getKif, (const WriteAccessLevel), (const, override));
+    MOCK_METHOD(uint8_t, getKvc, (const WriteAccessLevel), (const, override));
+};
+
+class CIST_SvDebitLogRecordMock : public SvDebitLogRecord {
+public:
+    MOCK_METHOD(const std::vector<uint8_t>&, getRawData, (), (const, override));
+    MOCK_METHOD(const ByteView, getRawDataView, (), (const, override));
+    MOCK_METHOD(const std::vector<uint8_t>, getDebitDate, (), (const, override));
+    MOCK_METHOD(const std::vector<uint8_t>, getDebitTime, (), (const, override));
+    MOCK_METHOD(int, getAmount, (), (const, override));
+    MOCK_METHOD(int, getBalance, (), (const, override));
+    MOCK_METHOD(uint8_t, getKvc, (), (const, override));
+    MOCK_METHOD(const std::vector<uint8_t>, getSamId, (), (const, override));
+    MOCK_METHOD(int, getSamTNum, (), (const, override));
+    MOCK_METHOD(int, getSvTNum, (), (const, override));
+};
+
+/**
+ * Card image of a Calypso Prime Revision 3 card with a directory header, 3 files (one without
+ * header and a partially read one) and 2 SV debit logs, the PIN status being unknown.
+ */
+class CardImageSnapshotTest : public Test {
+protected:
+    void SetUp() override
+    {
+        mCard = std::make_shared<NiceMock<CIST_CalypsoCardMock>>();
+
+        ON_CALL(*mCard, getPowerOnData()).WillByDefault(ReturnRef(mPowerOnData));
+        ON_CALL(*mCard, getSelectApplicationResponse()).WillByDefault(Return(mFci));
+        ON_CALL(*mCard, getProductType()).WillByDefault(ReturnRef(mProductType));
+        ON_CALL(*mCard, isDfRatified()).WillByDefault(Return(true));
+        ON_CALL(*mCard, isExtendedModeSupported()).WillByDefault(Return(true));
+        ON_CALL(*mCard, isSvFeatureAvailable()).WillByDefault(Return(true));
+        ON_CALL(*mCard, getDfNameView()).WillByDefault(Return(ByteView(mDfName)));
+        ON_CALL(*mCard, getApplicationSerialNumberView())
+            .WillByDefault(Return(ByteView(mSerialNumber)));
+        ON_CALL(*mCard, getStartupInfoRawData()).WillByDefault(ReturnRef(mStartupInfo));
+        ON_CALL(*mCard, getPlatform()).WillByDefault(Return(0x2F));
+        ON_CALL(*mCard, getSessionModification()).WillByDefault(Return(0x0A));
+        ON_CALL(*mCard, getTransactionCounter()).WillByDefault(Return(0x001234));
+        ON_CALL(*mCard, isPinBlocked())
+            .WillByDefault(Throw(IllegalStateException("PIN status not available.")));
+        ON_CALL(*mCard, getSvBalance()).WillByDefault(Return(-150));
+        ON_CALL(*mCard, getSvLastTNum()).WillByDefault(Return(0x0102));
+        ON_CALL(*mCard, getFiles()).WillByDefault(ReturnRef(mFiles));
+
+        auto directoryHeader = std::make_shared<NiceMock<CIST_DirectoryHeaderMock>>();
+        ON_CALL(*directoryHeader, getLid()).WillByDefault(Return(0x2000));
+        ON_CALL(*directoryHeader, getDfStatus()).WillByDefault(Return(0x01));
+        ON_CALL(*directoryHeader, getAccessConditions())
+            .WillByDefault(ReturnRef(mAccessConditions));
+        ON_CALL(*directoryHeader, getKeyIndexes()).WillByDefault(ReturnRef(mKeyIndexes));
+        ON_CALL(*directoryHeader, getKif(WriteAccessLevel::LOAD)).WillByDefault(Return(0x27));
+        ON_CALL(*directoryHeader, getKvc(WriteAccessLevel::DEBIT)).WillByDefault(Return(0x79));
+        ON_CALL(*mCard, getDirectoryHeader()).WillByDefault(Return(directoryHeader));
+
+        for (int i = 0; i < 2; i++) {
+            mDebitLogs[i].assign(19, 0);
+            mDebitLogs[i][1] = static_cast<uint8_t>(10 + i);
+            mDebitLogs[i][14] = 0xFF;
+            mDebitLogs[i][15] = 0xFF;
+            mDebitLogs[i][16] = static_cast<uint8_t>(0x6A - 10 * i);
+            mDebitLogs[i][18] = static_cast<uint8_t>(i + 1);
+            auto log = std::make_shared<NiceMock<CIST_SvDebitLogRecordMock>>();
+            ON_CALL(*log, getRawDataView()).WillByDefault(Return(ByteView(mDebitLogs[i])));
+            mSvDebitLogs.push_back(log);
+        }
+        ON_CALL(*mCard, getSvDebitLogAllRecords()).WillByDefault(Return(mSvDebitLogs));
+
+        mStores[0].setRecord(1, std::vector<uint8_t>({0x11, 0x22, 0x33}));
+        mStores[0].setRecord(3, std::vector<uint8_t>(29, 0x44));
+        addFile(0x07, 0x2010, ElementaryFile::Type::LINEAR, 4, 29, mStores[0]);
+
+        mStores[1].setRecord(1, std::vector<uint8_t>({0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x12}));
+        addFile(0x19, 0x2069, ElementaryFile::Type::COUNTERS, 1, 9, mStores[1]);
+
+        mStores[2].setRecord(2, std::vector<uint8_t>({0xAA, 0xBB}));
+        mStores[2].setRecordPart(3, 4, std::vector<uint8_t>({0xCC, 0xDD}));
+        addFile(0x1A, 0, ElementaryFile::Type::LINEAR, 0, 0, mStores[2]);
+    }
+
+    void addFile(const uint8_t sfi,
+                 const uint16_t lid,
+                 const ElementaryFile::Type efType,
+                 const int recordsNumber,
+                 const int recordSize,
+                 const RecordStore& store)
+    {
+        auto ef = std::make_shared<NiceMock<CIST_ElementaryFileMock>>();
+        auto data = std::make_shared<NiceMock<CIST_FileDataMock>>();
+
+        ON_CALL(*ef, getSfi()).WillByDefault(Return(sfi));
+        ON_CALL(*ef, getData()).WillByDefault(Return(data));
+        ON_CALL(*data, getRecordStore()).WillByDefault(ReturnRef(store));
+
+        if (lid != 0) {
+            auto header = std::make_shared<NiceMock<CIST_FileHeaderMock>>();
+            ON_CALL(*header, getLid()).WillByDefault(Return(lid));
+            ON_CALL(*header, getEfType()).WillByDefault(Return(efType));
+            ON_CALL(*header, getRecordsNumber()).WillByDefault(Return(recordsNumber));
+            ON_CALL(*header, getRecordSize()).WillByDefault(Return(recordSize));
+            ON_CALL(*header, getAccessConditions()).WillByDefault(ReturnRef(mAccessConditions));
+            ON_CALL(*header, getKeyIndexes()).WillByDefault(ReturnRef(mKeyIndexes));
+            ON_CALL(*header, getSharedReference())
+                .WillByDefault(Return(std::make_shared<uint16_t>(0x3F07)));
+            ON_CALL(*ef, getHeader()).WillByDefault(Return(header));
+        }
+
+        mFiles.push_back(ef);
+    }
+
+    std::shared_ptr<NiceMock<CIST_CalypsoCardMock>> mCard;
+    const std::string mPowerOnData = "3B8F8001805A0A0103200311123456788290009A";
+    const std::vector<uint8_t> mFci = {0x6F, 0x00, 0x90, 0x00};
+    const CalypsoCard::ProductType mProductType = CalypsoCard::ProductType::PRIME_REVISION_3;
+    const std::vector<uint8_t> mDfName = {0xA0, 0x00, 0x00, 0x04, 0x04, 0x01, 0x25, 0x09, 0x01};
+    const std::vector<uint8_t> mSerialNumber = {0x00, 0x00, 0x00, 0x00, 0x12, 0x34, 0x56, 0x78};
+    const std::vector<uint8_t> mStartupInfo = {0x0A, 0x3C, 0x2F, 0x05, 0x14, 0x10, 0x01};
+    const std::vector<uint8_t> mAccessConditions = {0x10, 0x10, 0x10, 0x10};
+    const std::vector<uint8_t> mKeyIndexes = {0x01, 0x01, 0x01, 0x01};
+    std::vector<uint8_t> mDebitLogs[2];
+    std::vector<std::shared_ptr<SvDebitLogRecord>> mSvDebitLogs;
+    RecordStore mStores[3];
+    std::vector<std::shared_ptr<ElementaryFile>> mFiles;
+};
+
+TEST_F(CardImageSnapshotTest, write_whenCardIsNull_shouldThrowIAE)
+{
+    std::vector<uint8_t> image;
+
+    EXPECT_THROW(CardImageSnapshotWriter::write(nullptr, image), IllegalArgumentException);
+}
+
+TEST_F(CardImageSnapshotTest, snapshotCalypsoCard_shouldRestoreTheSelectionData)
+{
+    std::vector<uint8_t> image;
+    CardImageSnapshotWriter::write(mCard, image);
+
+    const SnapshotCalypsoCard card(ByteView(image.data(), image.size()));
+
+    ASSERT_EQ(card.getPowerOnData(), mPowerOnData);
+    ASSERT_EQ(card.getSelectApplicationResponse(), mFci);
+    ASSERT_EQ(card.getProductType(), CalypsoCard::ProductType::PRIME_REVISION_3);
+    ASSERT_EQ(card.getDfName(), mDfName);
+    ASSERT_EQ(card.getApplicationSerialNumber(), mSerialNumber);
+    ASSERT_EQ(card.getStartupInfoRawData(), mStartupInfo);
+    ASSERT_EQ(card.getPlatform(), 0x2F);
+    ASSERT_EQ(card.getSessionModification(), 0x0A);
+    ASSERT_EQ(card.getTransactionCounter(), 0x001234);
+    ASSERT_FALSE(card.isHce());
+    ASSERT_TRUE(card.isDfRatified());
+    ASSERT_TRUE(card.isExtendedModeSupported());
+    ASSERT_FALSE(card.isPkiModeSupported());
+    ASSERT_TRUE(card.getTraceabilityInformation().empty());
+}
+
+TEST_F(CardImageSnapshotTest, snapshotCalypsoCard_shouldViewTheSnapshotWithoutCopy)
+{
+    std::vector<uint8_t> image;
+    CardImageSnapshotWriter::write(mCard, image);
+
+    const SnapshotCalypsoCard card(ByteView(image.data(), image.size()));
+    const ByteView dfName = card.getDfNameView();
+    const ByteView record = card.getFileBySfi(0x07)->getData()->getContentView(3);
+
+    ASSERT_GE(dfName.data(), image.data());
+    ASSERT_LE(dfName.end(), image.data() + image.size());
+    ASSERT_GE(record.data(), image.data());
+    ASSERT_LE(record.end(), image.data() + image.size());
+}
+
+TEST_F(CardImageSnapshotTest, snapshotCalypsoCard_shouldRestoreTheFiles)
+{
+    std::vector<uint8_t> image;
+    CardImageSnapshotWriter::write(mCard, image);
+
+    const SnapshotCalypsoCard card(std::move(image));
+
+    ASSERT_EQ(card.getFiles().size(), 3);
+
+    const auto ef = card.getFileByLid(0x2010);
+    ASSERT_NE(ef, nullptr);
+    ASSERT_EQ(card.getFileBySfi(0x07), ef);
+    ASSERT_EQ(ef->getHeader()->getEfType(), ElementaryFile::Type::LINEAR);
+    ASSERT_EQ(ef->getHeader()->getRecordsNumber(), 4);
+    ASSERT_EQ(ef->getHeader()->getRecordSize(), 29);
+    ASSERT_EQ(ef->getHeader()->getAccessConditions(), mAccessConditions);
+    ASSERT_EQ(ef->getHeader()->getKeyIndexes(), mKeyIndexes);
+    ASSERT_EQ(ef->getHeader()->getDfStatus(), nullptr);
+    ASSERT_EQ(*ef->getHeader()->getSharedReference(), 0x3F07);
+    ASSERT_EQ(ef->getData()->getContent(), std::vector<uint8_t>({0x11, 0x22, 0x33}));
+    ASSERT_TRUE(ef->getData()->getContent(2).empty());
+    ASSERT_EQ(ef->getData()->getContent(3), std::vector<uint8_t>(29, 0x44));
+    ASSERT_EQ(ef->getData()->getContent(1, 1, 2), std::vector<uint8_t>({0x22, 0x33}));
+    ASSERT_EQ(ef->getData()->getAllRecordsContent().size(), 2);
+    ASSERT_EQ(ef->getData()->getRecordStore().getRecordsNumber(), 3);
+    ASSERT_EQ(ef->getData()->getRecordStore().getRecord(3).toVector(),
+              std::vector<uint8_t>(29, 0x44));
+
+    const auto counters = card.getFileBySfi(0x19);
+    ASSERT_EQ(counters->getData()->getCountersView().getValue(2), 0x000100);
+    ASSERT_EQ(*counters->getData()->getContentAsCounterValue(1), 0x000005);
+    ASSERT_EQ(counters->getData()->getAllCountersValue().size(), 2);
+    ASSERT_THROW(counters->getData()->getContentAsCounterValue(3), IndexOutOfBoundsException);
+
+    const auto noHeader = card.getFileBySfi(0x1A);
+    ASSERT_EQ(noHeader->getHeader(), nullptr);
+    ASSERT_EQ(noHeader->getData()->getContent(2), std::vector<uint8_t>({0xAA, 0xBB}));
+}
+
+TEST_F(CardImageSnapshotTest, snapshotCalypsoCard_shouldRestoreTheKnownOffsets)
+{
+    std::vector<uint8_t> image;
+    CardImageSnapshotWriter::write(mCard, image);
+
+    const SnapshotCalypsoCard card(std::move(image));
+
+    const RecordStore& store = card.getFileBySfi(0x1A)->getData()->getRecordStore();
+    ASSERT_EQ(store.getKnownOffset(2), 0);
+    ASSERT_EQ(store.getKnownOffset(3), 4);
+    ASSERT_EQ(store.getRecord(3).toVector(),
+              std::vector<uint8_t>({0x00, 0x00, 0x00, 0x00, 0xCC, 0xDD}));
+}
+
+TEST_F(CardImageSnapshotTest, snapshotCalypsoCard_shouldRestoreTheDirectoryHeader)
+{
+    std::vector<uint8_t> image;
+    CardImageSnapshotWriter::write(mCard, image);
+
+    const SnapshotCalypsoCard card(std::move(image));
+    const auto directoryHeader = card.getDirectoryHeader();
+
+    ASSERT_NE(directoryHeader, nullptr);
+    ASSERT_EQ(directoryHeader->getLid(), 0x2000);
+    ASSERT_EQ(directoryHeader->getDfStatus(), 0x01);
+    ASSERT_EQ(directoryHeader->getAccessConditions(), mAccessConditions);
+    ASSERT_EQ(directoryHeader->getKeyIndexes(), mKeyIndexes);
+    ASSERT_EQ(directoryHeader->getKif(WriteAccessLevel::LOAD), 0x27);
+    ASSERT_EQ(directoryHeader->getKif(WriteAccessLevel::DEBIT), 0x00);
+    ASSERT_EQ(directoryHeader->getKvc(WriteAccessLevel::DEBIT), 0x79);
+}
+
+TEST_F(CardImageSnapshotTest, snapshotCalypsoCard_shouldRestoreTheSvAndPinStatus)
+{
+    std::vector<uint8_t> image;
+    CardImageSnapshotWriter::write(mCard, image);
+
+    SnapshotCalypsoCard card(std::move(image));
+
+    ASSERT_EQ(card.getSvBalance(), -150);
+    ASSERT_EQ(card.getSvLastTNum(), 0x0102);
+    ASSERT_EQ(card.getSvLoadLogRecord(), nullptr);
+    ASSERT_EQ(card.getSvDebitLogAllRecords().size(), 2);
+    ASSERT_EQ(card.getSvDebitLogLastRecord()->getRawData(), mDebitLogs[1]);
+    ASSERT_EQ(card.getSvDebitLogLastRecord()->getAmount(), 11);
+    ASSERT_EQ(card.getSvDebitLogLastRecord()->getBalance(), -160);
+    ASSERT_EQ(card.getSvDebitLogLastRecord()->getSvTNum(), 2);
+    ASSERT_THROW(card.isPinBlocked(), IllegalStateException);
+    ASSERT_THROW(card.getPinAttemptRemaining(), IllegalStateException);
+}
+
+TEST_F(CardImageSnapshotTest, write_whenNoSessionHasBeenOpened_shouldNotKeepTheCounter)
+{
+    ON_CALL(*mCard, getTransactionCounter())
+        .WillByDefault(Throw(IllegalStateException("No session has been opened.")));
+    std::vector<uint8_t> image;
+    CardImageSnapshotWriter::write(mCard, image);
+
+    SnapshotCalypsoCard card(std::move(image));
+
+    ASSERT_THROW(card.getTransactionCounter(), IllegalStateException);
+    ASSERT_EQ(card.getSvBalance(), -150);
+}
+
+TEST_F(CardImageSnapshotTest, write_shouldReuseTheOutputBuffer)
+{
+    std::vector<uint8_t> first;
+    std::vector<uint8_t> image;
+    CardImageSnapshotWriter::write(mCard, first);
+    CardImageSnapshotWriter::write(mCard, image);
+    const uint8_t* const data = image.data();
+
+    CardImageSnapshotWriter::write(mCard, image);
+
+    ASSERT_EQ(image.data(), data);
+    ASSERT_EQ(image, first);
+}
+
+TEST_F(CardImageSnapshotTest, cardImageSnapshot_whenImageIsInvalid_shouldThrowIAE)
+{
+    std::vector<uint8_t> image;
+    CardImageSnapshotWriter::write(mCard, image);
+
+    std::vector<uint8_t> truncated(image.begin(), image.end() - 1);
+    EXPECT_THROW(CardImageSnapshot(ByteView(truncated)), IllegalArgumentException);
+
+    std::vector<uint8_t> badMagic = image;
+    badMagic[0] ^= 0xFF;
+    EXPECT_THROW(CardImageSnapshot(ByteView(badMagic)), IllegalArgumentException);
+
+    std::vector<uint8_t> badSlice = image;
+    badSlice[CardImageSnapshot::HEADER_SIZE + 3] = 0xFF;
+    EXPECT_THROW(CardImageSnapshot(ByteView(badSlice)), IllegalArgumentException);
+
+    ASSERT_FALSE(CardImageSnapshot().isValid());
+    ASSERT_TRUE(CardImageSnapshot(ByteView(image)).isValid());
+}
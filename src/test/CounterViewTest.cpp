@@ -0,0 +1,63 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+/* Calypsonet Terminal Calypso */
+#include "CounterView.h"
+
+using namespace testing;
+
+using namespace calypsonet::terminal::calypso::card;
+
+static const std::vector<uint8_t> RECORD = {0x00, 0x00, 0x01, 0x12, 0x34, 0x56, 0xFF, 0xFF};
+
+TEST(CounterViewTest, getCountersNumber_shouldIgnoreTruncatedCounter)
+{
+    const CounterView counters((ByteView(RECORD)));
+
+    ASSERT_EQ(counters.getCountersNumber(), 2);
+    ASSERT_TRUE(counters.hasCounter(2));
+    ASSERT_FALSE(counters.hasCounter(3));
+}
+
+TEST(CounterViewTest, getValue_shouldDecodeThreeBytesBigEndian)
+{
+    const CounterView counters((ByteView(RECORD)));
+
+    ASSERT_EQ(counters.getValue(1), 1);
+    ASSERT_EQ(counters.getValue(2), 0x123456);
+}
+
+TEST(CounterViewTest, getValue_whenCounterIsNotKnown_shouldThrowIOOBE)
+{
+    const CounterView counters((ByteView(RECORD)));
+
+    EXPECT_THROW(counters.getValue(3), IndexOutOfBoundsException);
+}
+
+TEST(CounterViewTest, getValue_whenNumCounterIsZero_shouldThrowIAE)
+{
+    const CounterView counters((ByteView(RECORD)));
+
+    EXPECT_THROW(counters.getValue(0), IllegalArgumentException);
+}
+
+TEST(CounterViewTest, getValueWithOutput_whenCounterIsNotKnown_shouldReturnFalse)
+{
+    const CounterView counters;
+    int value = 7;
+
+    ASSERT_FALSE(counters.getValue(1, value));
+    ASSERT_EQ(value, 7);
+}
@@ -0,0 +1,106 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+/* Calypsonet Terminal Calypso */
+#include "ElementaryFileIndex.h"
+
+using namespace testing;
+
+using namespace calypsonet::terminal::calypso::card;
+
+class EFIT_ElementaryFileMock : public ElementaryFile {
+public:
+    MOCK_METHOD(uint8_t, getSfi, (), (const, override));
+    MOCK_METHOD(const std::shared_ptr<FileHeader>, getHeader, (), (const, override));
+    MOCK_METHOD(const std::shared_ptr<FileData>, getData, (), (const, override));
+};
+
+class EFIT_FileHeaderMock : public FileHeader {
+public:
+    MOCK_METHOD(uint16_t, getLid, (), (const, override));
+    MOCK_METHOD(const std::shared_ptr<uint8_t>, getDfStatus, (), (const, override));
+    MOCK_METHOD(ElementaryFile::Type, getEfType, (), (const, override));
+    MOCK_METHOD(int, getRecordsNumber, (), (const, override));
+    MOCK_METHOD(int, getRecordSize, (), (const, override));
+    MOCK_METHOD(const std::vector<uint8_t>&, getAccessConditions, (), (const, override));
+    MOCK_METHOD(const std::vector<uint8_t>&, getKeyIndexes, (), (const, override));
+    MOCK_METHOD(const std::shared_ptr<uint16_t>, getSharedReference, (), (const, override));
+};
+
+static std::shared_ptr<ElementaryFile> createFile(const uint8_t sfi, const uint16_t lid)
+{
+    auto ef = std::make_shared<NiceMock<EFIT_ElementaryFileMock>>();
+    auto header = std::make_shared<NiceMock<EFIT_FileHeaderMock>>();
+
+    ON_CALL(*header, getLid()).WillByDefault(Return(lid));
+    ON_CALL(*ef, getSfi()).WillByDefault(Return(sfi));
+    ON_CALL(*ef, getHeader()).WillByDefault(Return(header));
+
+    return ef;
+}
+
+TEST(ElementaryFileIndexTest, getBySfi_whenFileIsIndexed_shouldReturnIt)
+{
+    ElementaryFileIndex index;
+    const auto ef = createFile(0x07, 0x2010);
+
+    index.put(ef);
+
+    ASSERT_EQ(index.getBySfi(0x07), ef);
+    ASSERT_EQ(index.getBySfi(0x08), nullptr);
+    ASSERT_EQ(index.getBySfi(0), nullptr);
+    ASSERT_EQ(index.getBySfi(0xFF), nullptr);
+}
+
+TEST(ElementaryFileIndexTest, getByLid_whenManyFilesAreIndexed_shouldReturnEachOfThem)
+{
+    ElementaryFileIndex index;
+    std::vector<std::shared_ptr<ElementaryFile>> files;
+
+    for (int i = 0; i < 100; i++) {
+        files.push_back(createFile(0, static_cast<uint16_t>(0x2000 + i * 0x20)));
+        index.put(files.back());
+    }
+
+    for (int i = 0; i < 100; i++) {
+        ASSERT_EQ(index.getByLid(static_cast<uint16_t>(0x2000 + i * 0x20)), files[i]);
+    }
+
+    ASSERT_EQ(index.getByLid(0x1234), nullptr);
+    ASSERT_EQ(index.getFiles(), files);
+}
+
+TEST(ElementaryFileIndexTest, put_whenFileIsAlreadyIndexed_shouldNotDuplicateIt)
+{
+    ElementaryFileIndex index;
+    const auto ef = createFile(0x07, 0x2010);
+
+    index.put(ef);
+    index.put(ef);
+
+    ASSERT_EQ(index.getFiles().size(), 1);
+}
+
+TEST(ElementaryFileIndexTest, clear_shouldRemoveAllFiles)
+{
+    ElementaryFileIndex index;
+    index.put(createFile(0x07, 0x2010));
+
+    index.clear();
+
+    ASSERT_EQ(index.getBySfi(0x07), nullptr);
+    ASSERT_EQ(index.getByLid(0x2010), nullptr);
+    ASSERT_TRUE(index.getFiles().empty());
+}
@@ -0,0 +1,134 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+/* Calypsonet Terminal Calypso */
+#include "CalypsoSamSimulator.h"
+#include "LoadBalancedSamResourcePool.h"
+#include "SimulatedCardReader.h"
+
+using namespace testing;
+
+using namespace calypsonet::terminal::calypso::sim;
+using namespace calypsonet::terminal::calypso::transaction;
+
+static std::shared_ptr<LoadBalancedSamResourcePool> createPool(const int samsNumber,
+                                                               const int quarantineMs)
+{
+    auto pool = std::make_shared<LoadBalancedSamResourcePool>(
+                    std::chrono::milliseconds(quarantineMs));
+
+    for (int i = 0; i < samsNumber; i++) {
+        pool->addSamResource(
+            std::make_shared<SimulatedCardReader>("sam" + std::to_string(i), false),
+            std::make_shared<CalypsoSamSimulator>(
+                std::vector<uint8_t>({0x00, 0x00, 0x00, static_cast<uint8_t>(i)}), 0));
+    }
+
+    return pool;
+}
+
+TEST(LoadBalancedSamResourcePoolTest, addSamResource_whenReaderIsNull_shouldThrowIAE)
+{
+    LoadBalancedSamResourcePool pool(std::chrono::milliseconds(0));
+
+    EXPECT_THROW(pool.addSamResource(
+                     nullptr,
+                     std::make_shared<CalypsoSamSimulator>(std::vector<uint8_t>(4), 0)),
+                 IllegalArgumentException);
+}
+
+TEST(LoadBalancedSamResourcePoolTest, allocateSamResource_whenEmpty_shouldReturnNull)
+{
+    ASSERT_EQ(createPool(0, 0)->allocateSamResource(), nullptr);
+}
+
+TEST(LoadBalancedSamResourcePoolTest, allocateSamResource_shouldHandOutEachSamOnce)
+{
+    auto pool = createPool(3, 0);
+
+    const auto sam1 = pool->allocateSamResource();
+    const auto sam2 = pool->allocateSamResource();
+    const auto sam3 = pool->allocateSamResource();
+
+    ASSERT_NE(sam1, sam2);
+    ASSERT_NE(sam2, sam3);
+    ASSERT_NE(sam1, sam3);
+    ASSERT_EQ(pool->getAllocationsNumber(0), 1);
+    ASSERT_EQ(pool->getAllocationsNumber(1), 1);
+    ASSERT_EQ(pool->getAllocationsNumber(2), 1);
+}
+
+TEST(LoadBalancedSamResourcePoolTest, allocateSamResource_whenAllSamsAreAllocated_shouldReturnNull)
+{
+    auto pool = createPool(2, 0);
+
+    const auto sam1 = pool->allocateSamResource();
+    const auto sam2 = pool->allocateSamResource();
+
+    ASSERT_EQ(pool->allocateSamResource(), nullptr);
+
+    pool->releaseSamResource(sam2, std::chrono::microseconds(0), false);
+
+    ASSERT_EQ(pool->allocateSamResource(), sam2);
+    ASSERT_EQ(pool->getAllocationsNumber(0), 1);
+}
+
+TEST(LoadBalancedSamResourcePoolTest, allocateSamResource_shouldPreferLowestBusyTime)
+{
+    auto pool = createPool(2, 0);
+
+    pool->releaseSamResource(pool->allocateSamResource(), std::chrono::microseconds(500), false);
+    const auto sam = pool->allocateSamResource();
+
+    ASSERT_EQ(sam->getCalypsoSam()->getSerialNumber()[3], 1);
+    ASSERT_EQ(pool->getBusyTime(0), std::chrono::microseconds(500));
+}
+
+TEST(LoadBalancedSamResourcePoolTest, releaseSamResource_whenFailed_shouldQuarantineSam)
+{
+    auto pool = createPool(2, 60000);
+
+    pool->releaseSamResource(pool->allocateSamResource(), std::chrono::microseconds(0), true);
+
+    const auto sam = pool->allocateSamResource();
+    ASSERT_EQ(sam->getCalypsoSam()->getSerialNumber()[3], 1);
+    ASSERT_EQ(pool->allocateSamResource(), nullptr);
+    ASSERT_EQ(pool->getFailuresNumber(0), 1);
+}
+
+TEST(LoadBalancedSamResourcePoolTest, releaseSamResource_whenAllFailed_shouldReturnNull)
+{
+    auto pool = createPool(1, 60000);
+
+    pool->releaseSamResource(pool->allocateSamResource(), std::chrono::microseconds(0), true);
+
+    ASSERT_EQ(pool->allocateSamResource(), nullptr);
+}
+
+TEST(LoadBalancedSamResourcePoolTest, releaseSamResource_whenNotAllocated_shouldThrowIAE)
+{
+    auto pool = createPool(1, 0);
+    auto other = createPool(1, 0);
+
+    EXPECT_THROW(pool->releaseSamResource(other->allocateSamResource(),
+                                          std::chrono::microseconds(0),
+                                          false),
+                 IllegalArgumentException);
+}
+
+TEST(LoadBalancedSamResourcePoolTest, getBusyTime_whenIndexIsOutOfRange_shouldThrowIOOBE)
+{
+    EXPECT_THROW(createPool(1, 0)->getBusyTime(1), IndexOutOfBoundsException);
+}
@@ -0,0 +1,72 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include <cstdint>
+#include <memory>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+/* Calypsonet Terminal Calypso */
+#include "ArenaAllocator.h"
+#include "MonotonicArena.h"
+
+using namespace testing;
+
+using namespace calypsonet::terminal::calypso;
+
+TEST(MonotonicArenaTest, allocate_shouldReturnAlignedBlocks)
+{
+    MonotonicArena arena(128);
+
+    arena.allocate(1, 1);
+    void* const block = arena.allocate(8, 8);
+
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(block) % 8, 0);
+}
+
+TEST(MonotonicArenaTest, allocate_whenBlockIsFull_shouldAddBlock)
+{
+    MonotonicArena arena(64);
+
+    arena.allocate(48, 1);
+    arena.allocate(48, 1);
+
+    ASSERT_GT(arena.getCapacity(), 64);
+}
+
+TEST(MonotonicArenaTest, reset_shouldReuseMemoryWithoutGrowing)
+{
+    MonotonicArena arena(64);
+    void* const first = arena.allocate(32, 8);
+    arena.allocate(200, 8);
+    const std::size_t capacity = arena.getCapacity();
+
+    arena.reset();
+
+    ASSERT_EQ(arena.allocate(32, 8), first);
+    arena.allocate(200, 8);
+    ASSERT_EQ(arena.getCapacity(), capacity);
+}
+
+TEST(MonotonicArenaTest, allocateShared_shouldPlaceObjectInArena)
+{
+    MonotonicArena arena(256);
+    const uint8_t* const begin = static_cast<uint8_t*>(arena.allocate(1, 1));
+
+    std::shared_ptr<int> value = std::allocate_shared<int>(ArenaAllocator<int>(arena), 42);
+
+    const uint8_t* const address = reinterpret_cast<const uint8_t*>(value.get());
+    ASSERT_EQ(*value, 42);
+    ASSERT_GT(address, begin);
+    ASSERT_LT(address, begin + 256);
+}
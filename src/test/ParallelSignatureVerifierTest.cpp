@@ -0,0 +1,512 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include <map>
+#include <mutex>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+/* Calypsonet Terminal Calypso */
+#include "ParallelSignatureVerifier.h"
+#include "SamRevokedException.h"
+
+/* Keyple Core Util */
+#include "UnsupportedOperationException.h"
+
+using namespace testing;
+
+using namespace calypsonet::terminal::calypso::sam;
+using namespace calypsonet::terminal::calypso::spi;
+using namespace calypsonet::terminal::calypso::transaction;
+using namespace keyple::core::util::cpp::exception;
+
+/* Signature whose validity and signing SAM are known in advance */
+class PSVT_SignatureData final : public TraceableSignatureVerificationData {
+public:
+    PSVT_SignatureData(const uint8_t samNumber, const bool isCorrect)
+    : samSerialNumber({0x00, 0x00, 0x00, samNumber}), isCorrect(isCorrect) {}
+
+    TraceableSignatureVerificationData& setData(const std::vector<uint8_t>& data,
+                                                const std::vector<uint8_t>& signature,
+                                                const uint8_t kif,
+                                                const uint8_t kvc) override
+    {
+        (void)data;
+        (void)signature;
+        (void)kif;
+        (void)kvc;
+
+        return *this;
+    }
+
+    TraceableSignatureVerificationData& setKeyDiversifier(
+        const std::vector<uint8_t>& diversifier) override
+    {
+        (void)diversifier;
+
+        return *this;
+    }
+
+    bool isSignatureValid() const override
+    {
+        if (!isProcessed) {
+            throw IllegalStateException("The command has not yet been processed");
+        }
+
+        return isCorrect;
+    }
+
+    TraceableSignatureVerificationData& withSamTraceabilityMode(
+        const int offset,
+        const bool isPartialSamSerialNumber,
+        const bool checkSamRevocationStatus) override
+    {
+        (void)offset;
+        (void)isPartialSamSerialNumber;
+        isRevocationChecked = checkSamRevocationStatus;
+
+        return *this;
+    }
+
+    TraceableSignatureVerificationData& withoutBusyMode() override { return *this; }
+
+    const std::vector<uint8_t> samSerialNumber;
+    const bool isCorrect;
+    bool isRevocationChecked = false;
+    bool isProcessed = false;
+};
+
+class PSVT_SamResource final : public SamResourcePoolSpi::SamResource {
+public:
+    const std::shared_ptr<CardReader> getSamReader() const override { return nullptr; }
+    const std::shared_ptr<CalypsoSam> getCalypsoSam() const override { return nullptr; }
+};
+
+/* Allocates the SAMs in turn, or a new SAM at each allocation if none is registered */
+class PSVT_SamResourcePool final : public SamResourcePoolSpi {
+public:
+    explicit PSVT_SamResourcePool(const int samsNumber)
+    {
+        for (int i = 0; i < samsNumber; i++) {
+            sams.push_back(std::make_shared<PSVT_SamResource>());
+        }
+    }
+
+    const std::shared_ptr<SamResource> allocateSamResource() override
+    {
+        if (isFailing) {
+            throw IllegalStateException("Pool failure");
+        }
+
+        if (sams.empty()) {
+            return std::make_shared<PSVT_SamResource>();
+        }
+
+        return sams[allocationsNumber++ % sams.size()];
+    }
+
+    void releaseSamResource(const std::shared_ptr<SamResource> samResource,
+                            const std::chrono::microseconds communicationTime,
+                            const bool isFailed) override
+    {
+        (void)samResource;
+        (void)communicationTime;
+
+        if (isFailed) {
+            failedReleasesNumber++;
+        }
+    }
+
+    std::vector<std::shared_ptr<SamResource>> sams;
+    size_t allocationsNumber = 0;
+    int failedReleasesNumber = 0;
+    bool isFailing = false;
+};
+
+/*
+ * Verifies the prepared signatures in order, stopping at the first invalid one. The first
+ * processCommands() of the manager fails with the provided error if any, and the n-th prepared
+ * command fails with a SamIOException if requested.
+ */
+class PSVT_SamTransactionManager final : public SamTransactionManager {
+public:
+    PSVT_SamTransactionManager(const std::shared_ptr<SamRevocationServiceSpi> revocationService,
+                               const std::exception_ptr processError,
+                               const int failingPrepareNumber)
+    : mRevocationService(revocationService),
+      mProcessError(processError),
+      mFailingPrepareNumber(failingPrepareNumber) {}
+
+    const std::shared_ptr<CommonSecuritySetting> getSecuritySetting() const override
+    {
+        return nullptr;
+    }
+
+    const std::vector<std::vector<uint8_t>>& getTransactionAuditData() const override
+    {
+        return mAuditData;
+    }
+
+    SamTransactionManager& setTransactionObserver(
+        const std::shared_ptr<TransactionObserverSpi> observer) override
+    {
+        (void)observer;
+
+        return *this;
+    }
+
+    SamTransactionManager& prepareComputeSignature(const any data) override
+    {
+        (void)data;
+
+        throw UnsupportedOperationException("prepareComputeSignature");
+    }
+
+    SamTransactionManager& prepareComputeBasicSignature(
+        const std::shared_ptr<BasicSignatureComputationData> data) override
+    {
+        (void)data;
+
+        throw UnsupportedOperationException("prepareComputeBasicSignature");
+    }
+
+    SamTransactionManager& prepareComputeTraceableSignature(
+        const std::shared_ptr<TraceableSignatureComputationData> data) override
+    {
+        (void)data;
+
+        throw UnsupportedOperationException("prepareComputeTraceableSignature");
+    }
+
+    SamTransactionManager& prepareVerifySignature(const any data) override
+    {
+        (void)data;
+
+        throw UnsupportedOperationException("prepareVerifySignature");
+    }
+
+    SamTransactionManager& prepareVerifyBasicSignature(
+        const std::shared_ptr<BasicSignatureVerificationData> data) override
+    {
+        (void)data;
+
+        throw UnsupportedOperationException("prepareVerifyBasicSignature");
+    }
+
+    SamTransactionManager& prepareVerifyTraceableSignature(
+        const std::shared_ptr<TraceableSignatureVerificationData> data) override
+    {
+        const auto request = std::dynamic_pointer_cast<PSVT_SignatureData>(data);
+
+        if (++mPrepareNumber == mFailingPrepareNumber) {
+            throw SamIOException("SAM failure");
+        }
+
+        if (request->isRevocationChecked &&
+            mRevocationService->isSamRevoked(request->samSerialNumber, 1)) {
+            throw SamRevokedException("The SAM is revoked");
+        }
+
+        request->isProcessed = false;
+        mPrepared.push_back(request);
+
+        return *this;
+    }
+
+    SamTransactionManager& processCommands() override
+    {
+        std::vector<std::shared_ptr<PSVT_SignatureData>> prepared;
+        prepared.swap(mPrepared);
+
+        if (mProcessError != nullptr) {
+            const std::exception_ptr error = mProcessError;
+            mProcessError = nullptr;
+            std::rethrow_exception(error);
+        }
+
+        for (const auto& request : prepared) {
+            request->isProcessed = true;
+            if (!request->isCorrect) {
+                throw InvalidSignatureException("Invalid signature");
+            }
+        }
+
+        return *this;
+    }
+
+    const std::shared_ptr<CardReader> getSamReader() const override { return nullptr; }
+    const std::shared_ptr<CalypsoSam> getCalypsoSam() const override { return nullptr; }
+
+    SamTransactionManager& prepareComputeSignatures(
+        const std::vector<std::shared_ptr<BasicSignatureComputationData>>& data,
+        SignatureBatchOutput& output) override
+    {
+        (void)data;
+        (void)output;
+
+        throw UnsupportedOperationException("prepareComputeSignatures");
+    }
+
+    SamTransactionManager& prepareComputeSignatures(
+        const std::vector<std::shared_ptr<TraceableSignatureComputationData>>& data,
+        SignatureBatchOutput& output) override
+    {
+        (void)data;
+        (void)output;
+
+        throw UnsupportedOperationException("prepareComputeSignatures");
+    }
+
+    SamTransactionManager& areSamsRevoked(
+        const std::vector<SamRevocationServiceSpi::RevocationQuery>& queries,
+        std::vector<bool>& revoked) override
+    {
+        mRevocationService->areSamsRevoked(queries, revoked);
+
+        return *this;
+    }
+
+private:
+    const std::shared_ptr<SamRevocationServiceSpi> mRevocationService;
+    std::exception_ptr mProcessError;
+    const int mFailingPrepareNumber;
+    int mPrepareNumber = 0;
+    const std::vector<std::vector<uint8_t>> mAuditData;
+    std::vector<std::shared_ptr<PSVT_SignatureData>> mPrepared;
+};
+
+/* Keeps no reference to the SAM resources; the first manager created fails as requested */
+class PSVT_SamTransactionManagerFactory final : public SamTransactionManagerFactorySpi {
+public:
+    std::shared_ptr<SamTransactionManager> createSamTransactionManager(
+        const std::shared_ptr<SamResourcePoolSpi::SamResource> samResource,
+        const std::shared_ptr<SamRevocationServiceSpi> samRevocationService) override
+    {
+        (void)samResource;
+
+        const bool isFirst = createdNumber++ == 0;
+
+        return std::make_shared<PSVT_SamTransactionManager>(
+            samRevocationService,
+            isFirst ? firstManagerProcessError : nullptr,
+            isFirst ? firstManagerFailingPrepareNumber : 0);
+    }
+
+    std::exception_ptr firstManagerProcessError;
+    int firstManagerFailingPrepareNumber = 0;
+    int createdNumber = 0;
+};
+
+/* The SAMs whose number is odd are revoked */
+class PSVT_SamRevocationService final : public SamRevocationServiceSpi {
+public:
+    bool isSamRevoked(const std::vector<uint8_t>& serialNumber) const override
+    {
+        return isSamRevoked(serialNumber, 0);
+    }
+
+    bool isSamRevoked(const std::vector<uint8_t>& serialNumber, const int counterValue)
+        const override
+    {
+        (void)counterValue;
+        lookupsNumber++;
+
+        return (serialNumber.back() & 1) != 0;
+    }
+
+    mutable int lookupsNumber = 0;
+};
+
+class PSVT_Listener final : public SignatureVerificationListenerSpi {
+public:
+    void onSignatureVerified(const int index, const bool isSignatureValid) override
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        results[index] = isSignatureValid ? "valid" : "invalid";
+        reportsNumber++;
+    }
+
+    void onSignatureVerificationFailure(const int index, const std::exception_ptr error) override
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        reportsNumber++;
+
+        try {
+            std::rethrow_exception(error);
+        } catch (const SamIOException&) {
+            results[index] = "SamIOException";
+        } catch (const SamRevokedException&) {
+            results[index] = "SamRevokedException";
+        } catch (...) {
+            results[index] = "failure";
+        }
+    }
+
+    std::map<int, std::string> results;
+    int reportsNumber = 0;
+
+private:
+    std::mutex mMutex;
+};
+
+static std::vector<std::shared_ptr<TraceableSignatureVerificationData>> createRequests(
+    const std::vector<bool>& areCorrect)
+{
+    std::vector<std::shared_ptr<TraceableSignatureVerificationData>> requests;
+
+    for (size_t i = 0; i < areCorrect.size(); i++) {
+        requests.push_back(std::make_shared<PSVT_SignatureData>(static_cast<uint8_t>(i % 4),
+                                                                areCorrect[i]));
+    }
+
+    return requests;
+}
+
+TEST(ParallelSignatureVerifierTest, verify_whenSamIOException_shouldRetryOnAnotherSam)
+{
+    auto pool = std::make_shared<PSVT_SamResourcePool>(2);
+    auto factory = std::make_shared<PSVT_SamTransactionManagerFactory>();
+    factory->firstManagerProcessError = std::make_exception_ptr(SamIOException("SAM failure"));
+    ParallelSignatureVerifier verifier(pool, factory, nullptr, 1, 3, std::chrono::milliseconds(0));
+    PSVT_Listener listener;
+
+    verifier.verify(createRequests({true, true, true}), listener);
+
+    ASSERT_EQ(listener.results,
+              (std::map<int, std::string>({{0, "valid"}, {1, "valid"}, {2, "valid"}})));
+    ASSERT_EQ(pool->failedReleasesNumber, 1);
+    ASSERT_EQ(pool->allocationsNumber, 2u);
+    ASSERT_EQ(factory->createdNumber, 2);
+}
+
+TEST(ParallelSignatureVerifierTest, verify_whenSignatureIsInvalid_shouldReportAllResults)
+{
+    auto pool = std::make_shared<PSVT_SamResourcePool>(1);
+    ParallelSignatureVerifier verifier(pool,
+                                       std::make_shared<PSVT_SamTransactionManagerFactory>(),
+                                       nullptr,
+                                       1,
+                                       4,
+                                       std::chrono::milliseconds(0));
+    PSVT_Listener listener;
+
+    verifier.verify(createRequests({true, false, true, false}), listener);
+
+    ASSERT_EQ(listener.results,
+              (std::map<int, std::string>(
+                  {{0, "valid"}, {1, "invalid"}, {2, "valid"}, {3, "invalid"}})));
+    ASSERT_EQ(pool->failedReleasesNumber, 0);
+}
+
+TEST(ParallelSignatureVerifierTest, verify_whenSamIsCheckedSeveralTimes_shouldLookItUpOnce)
+{
+    auto revocationService = std::make_shared<PSVT_SamRevocationService>();
+    ParallelSignatureVerifier verifier(std::make_shared<PSVT_SamResourcePool>(1),
+                                       std::make_shared<PSVT_SamTransactionManagerFactory>(),
+                                       revocationService,
+                                       1,
+                                       3,
+                                       std::chrono::milliseconds(0));
+    PSVT_Listener listener;
+    const auto requests = createRequests({true, true, true, true, true, true, true, true});
+    for (const auto& request : requests) {
+        request->withSamTraceabilityMode(0, false, true);
+    }
+
+    verifier.verify(requests, listener);
+
+    ASSERT_EQ(listener.results.size(), 8u);
+    ASSERT_EQ(listener.results[0], "valid");
+    ASSERT_EQ(listener.results[1], "SamRevokedException");
+    ASSERT_EQ(listener.results[4], "valid");
+    ASSERT_EQ(listener.results[7], "SamRevokedException");
+    ASSERT_EQ(verifier.getRevocationChecksNumber(), 8);
+    ASSERT_EQ(verifier.getRevocationLookupsNumber(), 4);
+    ASSERT_EQ(revocationService->lookupsNumber, 4);
+}
+
+TEST(ParallelSignatureVerifierTest, verify_whenPoolRecreatesSams_shouldNotReuseManagers)
+{
+    auto pool = std::make_shared<PSVT_SamResourcePool>(0);
+    auto factory = std::make_shared<PSVT_SamTransactionManagerFactory>();
+    ParallelSignatureVerifier verifier(pool, factory, nullptr, 1, 1, std::chrono::milliseconds(0));
+    PSVT_Listener listener;
+
+    verifier.verify(createRequests({true, true, true}), listener);
+
+    ASSERT_EQ(listener.results.size(), 3u);
+    ASSERT_EQ(factory->createdNumber, 3);
+}
+
+TEST(ParallelSignatureVerifierTest, verify_whenPoolFails_shouldReportFailures)
+{
+    auto pool = std::make_shared<PSVT_SamResourcePool>(1);
+    pool->isFailing = true;
+    ParallelSignatureVerifier verifier(pool,
+                                       std::make_shared<PSVT_SamTransactionManagerFactory>(),
+                                       nullptr,
+                                       2,
+                                       1,
+                                       std::chrono::milliseconds(0));
+    PSVT_Listener listener;
+
+    verifier.verify(createRequests({true, true}), listener);
+
+    ASSERT_EQ(listener.results,
+              (std::map<int, std::string>({{0, "failure"}, {1, "failure"}})));
+}
+
+TEST(ParallelSignatureVerifierTest, verify_whenProcessingFails_shouldReportEachRequestOnce)
+{
+    auto factory = std::make_shared<PSVT_SamTransactionManagerFactory>();
+    factory->firstManagerProcessError =
+        std::make_exception_ptr(IllegalStateException("Unexpected status word"));
+    ParallelSignatureVerifier verifier(std::make_shared<PSVT_SamResourcePool>(1),
+                                       factory,
+                                       nullptr,
+                                       1,
+                                       3,
+                                       std::chrono::milliseconds(0));
+    PSVT_Listener listener;
+
+    verifier.verify(createRequests({true, true, true}), listener);
+
+    ASSERT_EQ(listener.results,
+              (std::map<int, std::string>({{0, "failure"}, {1, "failure"}, {2, "failure"}})));
+    ASSERT_EQ(listener.reportsNumber, 3);
+}
+
+TEST(ParallelSignatureVerifierTest, verify_whenSamIOExceptionWhilePreparing_shouldNotReportTwice)
+{
+    auto factory = std::make_shared<PSVT_SamTransactionManagerFactory>();
+    factory->firstManagerFailingPrepareNumber = 3;
+    ParallelSignatureVerifier verifier(std::make_shared<PSVT_SamResourcePool>(2),
+                                       factory,
+                                       std::make_shared<PSVT_SamRevocationService>(),
+                                       1,
+                                       3,
+                                       std::chrono::milliseconds(0));
+    PSVT_Listener listener;
+    const auto requests = createRequests({true, true, true});
+    for (const auto& request : requests) {
+        request->withSamTraceabilityMode(0, false, true);
+    }
+
+    verifier.verify(requests, listener);
+
+    ASSERT_EQ(listener.results,
+              (std::map<int, std::string>(
+                  {{0, "valid"}, {1, "SamRevokedException"}, {2, "valid"}})));
+    ASSERT_EQ(listener.reportsNumber, 3);
+    ASSERT_EQ(factory->createdNumber, 2);
+}
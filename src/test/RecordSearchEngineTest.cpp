@@ -0,0 +1,119 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+/* Calypsonet Terminal Calypso */
+#include "RecordSearchEngine.h"
+
+using namespace testing;
+
+using namespace calypsonet::terminal::calypso::card;
+
+static RecordStore createStore()
+{
+    RecordStore store(4, 12);
+
+    store.setRecord(1, std::vector<uint8_t>({0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+                                             0x09, 0x0A, 0x0B, 0x0C}));
+    store.setRecord(2, std::vector<uint8_t>({0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                                             0x00, 0x0A, 0x0B, 0x0C}));
+    store.setRecord(3, std::vector<uint8_t>({0x01, 0x02, 0x33, 0x04, 0x05, 0x06, 0x07, 0x08,
+                                             0x09, 0x0A, 0x0B, 0x0C}));
+    store.setRecord(4, std::vector<uint8_t>({0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                                             0xFF, 0xFF, 0xFF, 0xFF}));
+
+    return store;
+}
+
+TEST(RecordSearchEngineTest, constructor_whenMaskIsLongerThanData_shouldThrowIAE)
+{
+    EXPECT_THROW(RecordSearchEngine({0x01}, {0xFF, 0xFF}), IllegalArgumentException);
+}
+
+TEST(RecordSearchEngineTest, search_atOffset_shouldReturnMatchingRecords)
+{
+    const RecordSearchEngine engine({0x0A, 0x0B, 0x0C}, {});
+    std::vector<uint8_t> result;
+
+    ASSERT_TRUE(engine.search(createStore(), 4, 12, 1, 9, false, result));
+    ASSERT_EQ(result, std::vector<uint8_t>({1, 2, 3}));
+}
+
+TEST(RecordSearchEngineTest, search_withMask_shouldIgnoreMaskedBits)
+{
+    const RecordSearchEngine engine({0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09},
+                                    {0xFF, 0xFF, 0x0F});
+    std::vector<uint8_t> result;
+
+    ASSERT_TRUE(engine.search(createStore(), 4, 12, 1, 0, false, result));
+    ASSERT_EQ(result, std::vector<uint8_t>({1, 3}));
+}
+
+TEST(RecordSearchEngineTest, search_withRepeatedOffset_shouldFindDataAtAnyFollowingOffset)
+{
+    const RecordSearchEngine engine({0x0B, 0x0C}, {});
+    std::vector<uint8_t> result;
+
+    ASSERT_TRUE(engine.search(createStore(), 4, 12, 2, 1, true, result));
+    ASSERT_EQ(result, std::vector<uint8_t>({2, 3}));
+}
+
+TEST(RecordSearchEngineTest, search_whenRecordIsMissing_shouldReturnFalse)
+{
+    const RecordSearchEngine engine({0x0B}, {});
+    RecordStore store(2, 4);
+    store.setRecord(1, std::vector<uint8_t>({0x0B}));
+    std::vector<uint8_t> result;
+
+    ASSERT_FALSE(engine.search(store, 2, 4, 1, 0, false, result));
+}
+
+TEST(RecordSearchEngineTest, search_whenStoreDoesNotCoverAllRecords_shouldReturnFalse)
+{
+    const RecordSearchEngine engine({0x0B}, {});
+    RecordStore store;
+    store.setRecord(1, std::vector<uint8_t>({0x00, 0x00, 0x00, 0x00}));
+    store.setRecord(2, std::vector<uint8_t>({0x00, 0x00, 0x00, 0x00}));
+    std::vector<uint8_t> result;
+
+    /* Records 3 to 10 of the EF have not been read */
+    ASSERT_FALSE(engine.search(store, 10, 4, 1, 0, false, result));
+    ASSERT_TRUE(engine.search(store, 2, 4, 1, 0, false, result));
+    ASSERT_TRUE(result.empty());
+}
+
+TEST(RecordSearchEngineTest, search_whenRangeIsNotRead_shouldReturnFalse)
+{
+    const RecordSearchEngine engine({0x00}, {});
+    RecordStore store(1, 12);
+    store.setRecordPart(1, 9, std::vector<uint8_t>({0x0A, 0x0B, 0x0C}));
+    std::vector<uint8_t> result;
+
+    /* The bytes before offset 9 are set to 0 but have not been read */
+    ASSERT_FALSE(engine.search(store, 1, 12, 1, 0, false, result));
+    ASSERT_FALSE(engine.search(store, 1, 12, 1, 8, true, result));
+    ASSERT_TRUE(result.empty());
+}
+
+TEST(RecordSearchEngineTest, search_whenRangeIsRead_shouldAnalyzePartialRecord)
+{
+    const RecordSearchEngine engine({0x0B}, {});
+    RecordStore store(1, 12);
+    store.setRecordPart(1, 9, std::vector<uint8_t>({0x0A, 0x0B}));
+    std::vector<uint8_t> result;
+
+    ASSERT_TRUE(engine.search(store, 1, 12, 1, 10, false, result));
+    ASSERT_EQ(result, std::vector<uint8_t>({1}));
+    ASSERT_FALSE(engine.search(store, 1, 12, 1, 9, true, result));
+}
@@ -0,0 +1,156 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+/* Calypsonet Terminal Calypso */
+#include "RecordStore.h"
+
+using namespace testing;
+
+using namespace calypsonet::terminal::calypso::card;
+
+static const std::vector<uint8_t> RECORD_1 = {0x11, 0x12, 0x13};
+static const std::vector<uint8_t> RECORD_2 = {0x21, 0x22};
+
+TEST(RecordStoreTest, getRecord_whenNotSet_shouldReturnEmptyView)
+{
+    const RecordStore store(3, 4);
+
+    ASSERT_FALSE(store.hasRecord(1));
+    ASSERT_TRUE(store.getRecord(1).empty());
+    ASSERT_TRUE(store.getRecord(0).empty());
+    ASSERT_TRUE(store.getRecord(4).empty());
+}
+
+TEST(RecordStoreTest, setRecord_shouldStoreRecordsInSlotsOfOneBuffer)
+{
+    RecordStore store(3, 4);
+
+    store.setRecord(1, RECORD_1);
+    store.setRecord(2, RECORD_2);
+
+    ASSERT_EQ(store.getRecord(1).toVector(), RECORD_1);
+    ASSERT_EQ(store.getRecord(2).toVector(), RECORD_2);
+    ASSERT_EQ(store.getRecord(2).data(), store.getRecord(1).data() + 4);
+}
+
+TEST(RecordStoreTest, setRecord_whenOutOfDimensions_shouldGrowAndKeepContent)
+{
+    RecordStore store;
+
+    store.setRecord(1, RECORD_2);
+    store.setRecord(3, RECORD_1);
+
+    ASSERT_EQ(store.getRecordsNumber(), 3);
+    ASSERT_EQ(store.getRecordSize(), 3);
+    ASSERT_EQ(store.getRecord(1).toVector(), RECORD_2);
+    ASSERT_FALSE(store.hasRecord(2));
+    ASSERT_EQ(store.getRecord(3).toVector(), RECORD_1);
+}
+
+TEST(RecordStoreTest, setRecord_whenNumRecordIsZero_shouldThrowIAE)
+{
+    RecordStore store(1, 1);
+
+    EXPECT_THROW(store.setRecord(0, RECORD_1), IllegalArgumentException);
+}
+
+TEST(RecordStoreTest, setRecordPart_shouldPadUnknownBytesAndExtendLength)
+{
+    RecordStore store(1, 5);
+
+    store.setRecordPart(1, 2, RECORD_2);
+
+    ASSERT_EQ(store.getRecord(1).toVector(), std::vector<uint8_t>({0x00, 0x00, 0x21, 0x22}));
+    ASSERT_EQ(store.getKnownOffset(1), 2);
+}
+
+TEST(RecordStoreTest, setRecordPart_whenContiguous_shouldExtendKnownRange)
+{
+    RecordStore store(1, 8);
+    store.setRecordPart(1, 2, RECORD_2);
+
+    store.setRecordPart(1, 4, RECORD_1);
+    store.setRecordPart(1, 1, RECORD_2);
+
+    ASSERT_EQ(store.getKnownOffset(1), 1);
+    ASSERT_EQ(store.getRecord(1).toVector(),
+              std::vector<uint8_t>({0x00, 0x21, 0x22, 0x22, 0x11, 0x12, 0x13}));
+}
+
+TEST(RecordStoreTest, setRecordPart_whenNotContiguous_shouldOnlyKeepNewPart)
+{
+    RecordStore store(1, 8);
+    store.setRecordPart(1, 0, RECORD_2);
+
+    store.setRecordPart(1, 5, RECORD_1);
+
+    ASSERT_EQ(store.getKnownOffset(1), 5);
+    ASSERT_EQ(store.getRecord(1).toVector(),
+              std::vector<uint8_t>({0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x12, 0x13}));
+
+    store.setRecord(1, RECORD_1);
+
+    ASSERT_EQ(store.getKnownOffset(1), 0);
+}
+
+TEST(RecordStoreTest, appendRecord_shouldShiftRecordsAndDropOldest)
+{
+    RecordStore store(2, 3);
+    store.setRecord(1, RECORD_1);
+
+    store.appendRecord(RECORD_2);
+    store.appendRecord(RECORD_2);
+
+    ASSERT_EQ(store.getRecord(1).toVector(), RECORD_2);
+    ASSERT_EQ(store.getRecord(2).toVector(), RECORD_2);
+}
+
+TEST(RecordStoreTest, appendRecord_whenNotSized_shouldGrowAndKeepAllRecords)
+{
+    RecordStore store;
+
+    store.appendRecord(RECORD_1);
+    store.appendRecord(RECORD_2);
+
+    ASSERT_EQ(store.getRecordsNumber(), 2);
+    ASSERT_EQ(store.getRecord(1).toVector(), RECORD_2);
+    ASSERT_EQ(store.getRecord(2).toVector(), RECORD_1);
+}
+
+TEST(RecordStoreTest, resize_whenRecordNoLongerFits_shouldUnsetIt)
+{
+    RecordStore store(3, 4);
+    store.setRecord(1, RECORD_1);
+    store.setRecord(2, RECORD_2);
+    store.setRecordPart(3, 1, std::vector<uint8_t>({0x31}));
+
+    store.resize(3, 2);
+
+    ASSERT_FALSE(store.hasRecord(1));
+    ASSERT_EQ(store.getRecord(2).toVector(), RECORD_2);
+    ASSERT_EQ(store.getRecord(3).toVector(), std::vector<uint8_t>({0x00, 0x31}));
+    ASSERT_EQ(store.getKnownOffset(3), 1);
+}
+
+TEST(RecordStoreTest, clear_shouldUnsetAllRecords)
+{
+    RecordStore store(2, 3);
+    store.setRecord(2, RECORD_1);
+
+    store.clear();
+
+    ASSERT_FALSE(store.hasRecord(2));
+    ASSERT_EQ(store.getRecordsNumber(), 2);
+}
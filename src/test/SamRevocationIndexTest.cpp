@@ -0,0 +1,220 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+
+#include <type_traits>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+/* Calypsonet Terminal Calypso */
+#include "HotSwapSamRevocationService.h"
+#include "SamRevocationIndex.h"
+
+using namespace testing;
+
+using namespace calypsonet::terminal::calypso::transaction;
+
+static const std::vector<uint8_t> SAM_1 = {0x11, 0x22, 0x33, 0x44};
+static const std::vector<uint8_t> SAM_2 = {0x55, 0x22, 0x33, 0x44};
+static const std::vector<uint8_t> SAM_3 = {0x00, 0x00, 0x00, 0x01};
+static const std::vector<uint8_t> SAM_NOT_REVOKED = {0x11, 0x22, 0x33, 0x45};
+
+/* Service only implementing the mandatory methods: a SAM is revoked from counter 10 */
+class SamRevocationServiceStub final : public SamRevocationServiceSpi {
+public:
+    bool isSamRevoked(const std::vector<uint8_t>& serialNumber) const override
+    {
+        return serialNumber.back() == 0x44;
+    }
+
+    bool isSamRevoked(const std::vector<uint8_t>& serialNumber, const int counterValue)
+        const override
+    {
+        return isSamRevoked(serialNumber) && counterValue >= 10;
+    }
+};
+
+static std::shared_ptr<SamRevocationIndex> createIndex()
+{
+    return std::make_shared<SamRevocationIndex>(SamRevocationIndex::Builder()
+                                                     .addRevokedSam(SAM_1, 0)
+                                                     .addRevokedSam(SAM_2, 0x100)
+                                                     .addRevokedSam(SAM_3, 0x200)
+                                                     .addRevokedSam(SAM_3, 0x50)
+                                                     .build());
+}
+
+TEST(SamRevocationIndexTest, addRevokedSam_whenSerialNumberIsPartial_shouldThrowIAE)
+{
+    EXPECT_THROW(SamRevocationIndex::Builder().addRevokedSam({0x22, 0x33, 0x44}, 0),
+                 IllegalArgumentException);
+}
+
+TEST(SamRevocationIndexTest, constructor_whenImageIsInvalid_shouldThrowIAE)
+{
+    std::vector<uint8_t> image = SamRevocationIndex::Builder().addRevokedSam(SAM_1, 0).build();
+    image.pop_back();
+
+    EXPECT_THROW(SamRevocationIndex(ByteView(image)), IllegalArgumentException);
+    EXPECT_THROW(SamRevocationIndex(ByteView(nullptr, 0)), IllegalArgumentException);
+}
+
+TEST(SamRevocationIndexTest, isSamRevoked_whenSerialNumberIsNotListed_shouldReturnFalse)
+{
+    const auto index = createIndex();
+
+    ASSERT_EQ(index->getEntriesNumber(), 3);
+    ASSERT_FALSE(index->isSamRevoked(SAM_NOT_REVOKED));
+    ASSERT_FALSE(index->isSamRevoked(SAM_NOT_REVOKED, 0xFFFFFF));
+}
+
+TEST(SamRevocationIndexTest, isSamRevoked_withCounter_shouldApplyLowestThreshold)
+{
+    const auto index = createIndex();
+
+    ASSERT_TRUE(index->isSamRevoked(SAM_1, 0));
+    ASSERT_FALSE(index->isSamRevoked(SAM_2, 0xFF));
+    ASSERT_TRUE(index->isSamRevoked(SAM_2, 0x100));
+    ASSERT_FALSE(index->isSamRevoked(SAM_3, 0x4F));
+    ASSERT_TRUE(index->isSamRevoked(SAM_3, 0x50));
+    ASSERT_TRUE(index->isSamRevoked(SAM_3));
+}
+
+TEST(SamRevocationIndexTest, isSamRevoked_whenSerialNumberIsPartial_shouldMatchAllEntries)
+{
+    const auto index = createIndex();
+    const std::vector<uint8_t> partial = {0x22, 0x33, 0x44};
+
+    ASSERT_TRUE(index->isSamRevoked(partial));
+    ASSERT_TRUE(index->isSamRevoked(partial, 0));
+    ASSERT_FALSE(index->isSamRevoked(std::vector<uint8_t>({0x22, 0x33, 0x45})));
+    EXPECT_THROW(index->isSamRevoked(std::vector<uint8_t>({0x33, 0x44})),
+                 IllegalArgumentException);
+}
+
+TEST(SamRevocationIndexTest, isSamRevoked_withArray_shouldMatchVectorForm)
+{
+    const auto index = createIndex();
+
+    ASSERT_TRUE(index->isSamRevokedBySerial4({{0x55, 0x22, 0x33, 0x44}}, 0x100));
+    ASSERT_FALSE(index->isSamRevokedBySerial4({{0x55, 0x22, 0x33, 0x44}}, 0xFF));
+    ASSERT_TRUE(index->isSamRevokedBySerial3(
+        {{0x22, 0x33, 0x44}}, SamRevocationServiceSpi::RevocationQuery::NO_COUNTER));
+    ASSERT_FALSE(index->isSamRevokedBySerial3({{0x22, 0x33, 0x45}}, 0));
+}
+
+TEST(SamRevocationIndexTest, constructor_withExternalImage_shouldNotCopyIt)
+{
+    const std::vector<uint8_t> image = SamRevocationIndex::Builder()
+                                           .addRevokedSam(SAM_1, 0)
+                                           .build();
+    const SamRevocationIndex index((ByteView(image)));
+
+    ASSERT_EQ(index.getImage().data(), image.data());
+    ASSERT_TRUE(index.isSamRevoked(SAM_1));
+}
+
+TEST(SamRevocationIndexTest, isSamRevoked_withManyEntries_shouldFindEachOfThem)
+{
+    SamRevocationIndex::Builder builder;
+    for (int i = 0; i < 10000; i++) {
+        builder.addRevokedSam({static_cast<uint8_t>(i), 0x00, static_cast<uint8_t>(i >> 8),
+                               static_cast<uint8_t>(i * 2)}, i + 1);
+    }
+    const SamRevocationIndex index(builder.build());
+
+    for (int i = 0; i < 10000; i++) {
+        const std::vector<uint8_t> serialNumber = {static_cast<uint8_t>(i), 0x00,
+                                                   static_cast<uint8_t>(i >> 8),
+                                                   static_cast<uint8_t>(i * 2)};
+        ASSERT_TRUE(index.isSamRevoked(serialNumber, i + 1));
+        ASSERT_FALSE(index.isSamRevoked(serialNumber, i));
+    }
+}
+
+TEST(SamRevocationIndexTest, swap_shouldApplyNewListToFollowingChecks)
+{
+    HotSwapSamRevocationService service(createIndex());
+
+    ASSERT_TRUE(service.isSamRevoked(SAM_1));
+
+    const auto previous = service.swap(std::make_shared<SamRevocationIndex>(
+                              SamRevocationIndex::Builder().addRevokedSam(SAM_NOT_REVOKED, 0)
+                                                           .build()));
+
+    ASSERT_TRUE(previous->isSamRevoked(SAM_1));
+    ASSERT_FALSE(service.isSamRevoked(SAM_1));
+    ASSERT_TRUE(service.isSamRevoked(SAM_NOT_REVOKED));
+}
+
+TEST(SamRevocationIndexTest, areSamsRevoked_shouldMatchSingleChecks)
+{
+    const auto index = createIndex();
+    const std::vector<SamRevocationServiceSpi::RevocationQuery> queries = {
+        {std::array<uint8_t, 4>({{0x55, 0x22, 0x33, 0x44}}), 0xFF},
+        {std::array<uint8_t, 4>({{0x55, 0x22, 0x33, 0x44}}), 0x100},
+        {std::array<uint8_t, 3>({{0x22, 0x33, 0x44}}), 0},
+        {std::array<uint8_t, 4>({{0x11, 0x22, 0x33, 0x45}}),
+         SamRevocationServiceSpi::RevocationQuery::NO_COUNTER},
+        {std::array<uint8_t, 4>({{0x00, 0x00, 0x00, 0x01}}),
+         SamRevocationServiceSpi::RevocationQuery::NO_COUNTER}};
+    std::vector<bool> revoked(1, true);
+
+    index->areSamsRevoked(queries, revoked);
+
+    ASSERT_EQ(revoked, std::vector<bool>({false, true, true, false, true}));
+}
+
+TEST(SamRevocationIndexTest, constructor_shouldNotAcceptAnLvalueVector)
+{
+    ASSERT_FALSE((std::is_constructible<SamRevocationIndex, std::vector<uint8_t>&>::value));
+    ASSERT_FALSE((std::is_constructible<SamRevocationIndex, const std::vector<uint8_t>&>::value));
+    ASSERT_TRUE((std::is_constructible<SamRevocationIndex, std::vector<uint8_t>&&>::value));
+    ASSERT_TRUE((std::is_constructible<SamRevocationIndex, ByteView>::value));
+}
+
+TEST(SamRevocationIndexTest, isSamRevokedBySerial_whenNotOverridden_shouldForwardTheCheck)
+{
+    const SamRevocationServiceStub service;
+
+    ASSERT_TRUE(service.isSamRevoked({0x11, 0x22, 0x33, 0x44}));
+    ASSERT_TRUE(service.isSamRevokedBySerial4(
+        {{0x11, 0x22, 0x33, 0x44}}, SamRevocationServiceSpi::RevocationQuery::NO_COUNTER));
+    ASSERT_FALSE(service.isSamRevokedBySerial4({{0x11, 0x22, 0x33, 0x44}}, 9));
+    ASSERT_TRUE(service.isSamRevokedBySerial3({{0x22, 0x33, 0x44}}, 10));
+}
+
+TEST(SamRevocationIndexTest, areSamsRevoked_whenNotOverridden_shouldForwardEachQuery)
+{
+    const std::vector<SamRevocationServiceSpi::RevocationQuery> queries = {
+        {std::array<uint8_t, 3>({{0x22, 0x33, 0x44}}), 9},
+        {std::array<uint8_t, 3>({{0x22, 0x33, 0x44}}), 10},
+        {std::array<uint8_t, 4>({{0x11, 0x22, 0x33, 0x45}}), 10}};
+    std::vector<bool> revoked;
+
+    SamRevocationServiceStub().areSamsRevoked(queries, revoked);
+
+    ASSERT_EQ(revoked, std::vector<bool>({false, true, false}));
+}
+
+TEST(SamRevocationIndexTest, areSamsRevoked_throughHotSwap_shouldUseCurrentIndex)
+{
+    HotSwapSamRevocationService service(createIndex());
+    const std::vector<SamRevocationServiceSpi::RevocationQuery> queries = {
+        {std::array<uint8_t, 4>({{0x11, 0x22, 0x33, 0x44}}), 0}};
+    std::vector<bool> revoked;
+
+    service.areSamsRevoked(queries, revoked);
+
+    ASSERT_EQ(revoked, std::vector<bool>({true}));
+}
@@ -0,0 +1,79 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+/* Calypsonet Terminal Calypso */
+#include "SignatureBatchOutput.h"
+
+using namespace testing;
+
+using namespace calypsonet::terminal::calypso::transaction;
+
+static const uint8_t SIGNATURE[] = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88};
+static const uint8_t DATA[] = {0xA1, 0xA2, 0xA3};
+
+TEST(SignatureBatchOutputTest, constructor_whenCapacityIsZero_shouldThrowIAE)
+{
+    EXPECT_THROW(SignatureBatchOutput(0, 0), IllegalArgumentException);
+}
+
+TEST(SignatureBatchOutputTest, reset_whenSizeExceedsCapacity_shouldThrowIAE)
+{
+    SignatureBatchOutput output(2, 0);
+
+    EXPECT_THROW(output.reset(3), IllegalArgumentException);
+}
+
+TEST(SignatureBatchOutputTest, getSignature_whenNotComputed_shouldThrowIOOBE)
+{
+    SignatureBatchOutput output(2, 0);
+    output.reset(2);
+
+    EXPECT_THROW(output.getSignature(0), IndexOutOfBoundsException);
+    EXPECT_THROW(output.getSignature(2), IndexOutOfBoundsException);
+}
+
+TEST(SignatureBatchOutputTest, setResult_shouldStoreSignatureAndSignedDataAtIndex)
+{
+    SignatureBatchOutput output(4, 3);
+    output.reset(2);
+
+    output.setResult(1, ByteView(SIGNATURE, 4), ByteView(DATA, 3));
+
+    ASSERT_EQ(output.getSize(), 2);
+    ASSERT_EQ(output.getSignature(1).toVector(), ByteView(SIGNATURE, 4).toVector());
+    ASSERT_EQ(output.getSignedData(1).toVector(), ByteView(DATA, 3).toVector());
+    ASSERT_TRUE(output.getSignedData(0).empty());
+}
+
+TEST(SignatureBatchOutputTest, setResult_whenResultDoesNotFit_shouldThrowIAE)
+{
+    SignatureBatchOutput output(1, 2);
+    output.reset(1);
+
+    EXPECT_THROW(output.setResult(0, ByteView(), ByteView()), IllegalArgumentException);
+    EXPECT_THROW(output.setResult(0, ByteView(SIGNATURE, 4), ByteView(DATA, 3)),
+                 IllegalArgumentException);
+}
+
+TEST(SignatureBatchOutputTest, reset_shouldClearPreviousResults)
+{
+    SignatureBatchOutput output(1, 0);
+    output.reset(1);
+    output.setResult(0, ByteView(SIGNATURE, 8), ByteView());
+
+    output.reset(1);
+
+    EXPECT_THROW(output.getSignature(0), IndexOutOfBoundsException);
+}
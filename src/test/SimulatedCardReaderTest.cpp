@@ -0,0 +1,282 @@
+/**************************************************************************************************
+ * Copyright (c) 2026 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+/* Calypsonet Terminal Calypso */
+#include "CalypsoCardSimulator.h"
+#include "CalypsoSamSimulator.h"
+#include "SimulatedCardReader.h"
+
+using namespace testing;
+
+using namespace calypsonet::terminal::calypso;
+using namespace calypsonet::terminal::calypso::card;
+using namespace calypsonet::terminal::calypso::sim;
+using namespace calypsonet::terminal::card;
+using namespace calypsonet::terminal::card::spi;
+
+static const uint64_t MASTER_KEY = 0x0123456789ABCDEFULL;
+static const std::vector<uint8_t> DF_NAME = {0xA0, 0x00, 0x00, 0x04, 0x04, 0x01, 0x25, 0x09, 0x01};
+static const std::vector<uint8_t> SERIAL_NUMBER = {0, 0, 0, 0, 0x12, 0x34, 0x56, 0x78};
+
+class SCRT_DirectoryHeader final : public DirectoryHeader {
+public:
+    uint16_t getLid() const override { return 0x3F00; }
+    uint8_t getDfStatus() const override { return 0x00; }
+    const std::vector<uint8_t>& getAccessConditions() const override { return mBytes; }
+    const std::vector<uint8_t>& getKeyIndexes() const override { return mBytes; }
+    uint8_t getKif(const WriteAccessLevel level) const override
+    {
+        return level == WriteAccessLevel::DEBIT ? 0x30 : 0x27;
+    }
+    uint8_t getKvc(const WriteAccessLevel level) const override
+    {
+        return level == WriteAccessLevel::DEBIT ? 0x79 : 0x78;
+    }
+
+private:
+    const std::vector<uint8_t> mBytes = {0x10, 0x10, 0x10, 0x10};
+};
+
+class SCRT_FileHeader final : public FileHeader {
+public:
+    uint16_t getLid() const override { return 0x2001; }
+    const std::shared_ptr<uint8_t> getDfStatus() const override { return nullptr; }
+    ElementaryFile::Type getEfType() const override { return ElementaryFile::Type::LINEAR; }
+    int getRecordsNumber() const override { return 4; }
+    int getRecordSize() const override { return 29; }
+    const std::vector<uint8_t>& getAccessConditions() const override { return mBytes; }
+    const std::vector<uint8_t>& getKeyIndexes() const override { return mBytes; }
+    const std::shared_ptr<uint16_t> getSharedReference() const override { return nullptr; }
+
+private:
+    const std::vector<uint8_t> mBytes = {0x1F, 0x1F, 0x1F, 0x1F};
+};
+
+class SCRT_ApduRequest final : public ApduRequestSpi {
+public:
+    explicit SCRT_ApduRequest(const std::vector<uint8_t>& apdu) : mApdu(apdu) {}
+
+    const std::vector<uint8_t>& getApdu() const override { return mApdu; }
+    const std::vector<int>& getSuccessfulStatusWords() const override { return mStatusWords; }
+    const std::string& getInfo() const override { return mInfo; }
+
+private:
+    const std::vector<uint8_t> mApdu;
+    const std::vector<int> mStatusWords = {0x9000};
+    const std::string mInfo;
+};
+
+class SCRT_CardRequest final : public CardRequestSpi {
+public:
+    SCRT_CardRequest& add(const std::vector<uint8_t>& apdu)
+    {
+        mApduRequests.push_back(std::make_shared<SCRT_ApduRequest>(apdu));
+
+        return *this;
+    }
+
+    const std::vector<std::shared_ptr<ApduRequestSpi>>& getApduRequests() const override
+    {
+        return mApduRequests;
+    }
+
+    bool stopOnUnsuccessfulStatusWord() const override { return true; }
+
+private:
+    std::vector<std::shared_ptr<ApduRequestSpi>> mApduRequests;
+};
+
+/*
+ * Plays the role of the card transaction manager of the Calypso extension: it only knows the
+ * CardReader objects provided by the application, gets their ProxyReaderApi and exchanges card
+ * requests, the APDUs of the card being digested by the SAM.
+ */
+class SCRT_Transaction {
+public:
+    SCRT_Transaction(const std::shared_ptr<CardReader> cardReader,
+                     const std::shared_ptr<CardReader> samReader)
+    : mCardReader(std::dynamic_pointer_cast<ProxyReaderApi>(cardReader)),
+      mSamReader(std::dynamic_pointer_cast<ProxyReaderApi>(samReader)) {}
+
+    bool isProxyReader() const
+    {
+        return mCardReader != nullptr && mSamReader != nullptr;
+    }
+
+    void processOpening()
+    {
+        std::vector<uint8_t> selectDiversifier = {0x80, 0x14, 0x00, 0x00, 0x08};
+        selectDiversifier.insert(selectDiversifier.end(),
+                                 SERIAL_NUMBER.begin(),
+                                 SERIAL_NUMBER.end());
+        const std::vector<uint8_t> challenge =
+            toSam(SCRT_CardRequest().add(selectDiversifier).add({0x80, 0x84, 0x00, 0x00, 0x04}))
+                .back();
+
+        std::vector<uint8_t> open = {0x00, 0x8A, 0x0B, 0x39, 0x05, 0x00};
+        open.insert(open.end(), challenge.begin(), challenge.begin() + 4);
+        open.push_back(0x00);
+        const std::vector<uint8_t> response =
+            toCard(SCRT_CardRequest().add(open), ChannelControl::KEEP_OPEN).back();
+
+        std::vector<uint8_t> digestInit = {0x80, 0x8A, 0x00, 0xFF,
+                                           static_cast<uint8_t>(response.size()), 0x30, 0x79};
+        digestInit.insert(digestInit.end(), response.begin(), response.end() - 2);
+        mDigest.add(digestInit);
+    }
+
+    std::vector<std::vector<uint8_t>> processCommands(const SCRT_CardRequest& cardRequest)
+    {
+        const std::vector<std::vector<uint8_t>> responses =
+            toCard(cardRequest, ChannelControl::KEEP_OPEN);
+
+        for (std::size_t i = 0; i < responses.size(); i++) {
+            digestUpdate(cardRequest.getApduRequests()[i]->getApdu());
+            digestUpdate(responses[i]);
+        }
+
+        return responses;
+    }
+
+    std::vector<uint8_t> processClosing()
+    {
+        const std::vector<uint8_t> signature =
+            toSam(mDigest.add({0x80, 0x8E, 0x00, 0x00, 0x04})).back();
+
+        std::vector<uint8_t> close = {0x00, 0x8E, 0x00, 0x00, 0x04};
+        close.insert(close.end(), signature.begin(), signature.begin() + 4);
+        close.push_back(0x04);
+
+        return toCard(SCRT_CardRequest().add(close), ChannelControl::CLOSE_AFTER).back();
+    }
+
+    std::shared_ptr<CardResponseApi> lastCardResponse;
+
+private:
+    void digestUpdate(const std::vector<uint8_t>& data)
+    {
+        std::vector<uint8_t> apdu = {0x80, 0x8C, 0x00, 0x00, static_cast<uint8_t>(data.size())};
+        apdu.insert(apdu.end(), data.begin(), data.end());
+        mDigest.add(apdu);
+    }
+
+    std::vector<std::vector<uint8_t>> toCard(const SCRT_CardRequest& cardRequest,
+                                             const ChannelControl channelControl)
+    {
+        lastCardResponse = mCardReader->transmitCardRequest(
+                               std::make_shared<SCRT_CardRequest>(cardRequest), channelControl);
+
+        return toApdus(lastCardResponse);
+    }
+
+    std::vector<std::vector<uint8_t>> toSam(const SCRT_CardRequest& cardRequest)
+    {
+        return toApdus(mSamReader->transmitCardRequest(
+                           std::make_shared<SCRT_CardRequest>(cardRequest),
+                           ChannelControl::KEEP_OPEN));
+    }
+
+    static std::vector<std::vector<uint8_t>> toApdus(
+        const std::shared_ptr<CardResponseApi> cardResponse)
+    {
+        std::vector<std::vector<uint8_t>> apdus;
+        for (const auto& apduResponse : cardResponse->getApduResponses()) {
+            apdus.push_back(apduResponse->getApdu());
+        }
+
+        return apdus;
+    }
+
+    const std::shared_ptr<ProxyReaderApi> mCardReader;
+    const std::shared_ptr<ProxyReaderApi> mSamReader;
+    SCRT_CardRequest mDigest;
+};
+
+class SimulatedCardReaderTest : public Test {
+protected:
+    void SetUp() override
+    {
+        card = std::make_shared<CalypsoCardSimulator>(DF_NAME,
+                                                      SERIAL_NUMBER,
+                                                      std::make_shared<SCRT_DirectoryHeader>(),
+                                                      MASTER_KEY);
+        card->addFile(0x07, std::make_shared<SCRT_FileHeader>());
+
+        cardReader = std::make_shared<SimulatedCardReader>("card", true);
+        cardReader->insertCard(card);
+        samReader = std::make_shared<SimulatedCardReader>("sam", false);
+        samReader->insertCard(
+            std::make_shared<CalypsoSamSimulator>(std::vector<uint8_t>({0xAA, 0xBB, 0xCC, 0xDD}),
+                                                  MASTER_KEY));
+    }
+
+    std::shared_ptr<CalypsoCardSimulator> card;
+    std::shared_ptr<SimulatedCardReader> cardReader;
+    std::shared_ptr<SimulatedCardReader> samReader;
+};
+
+TEST_F(SimulatedCardReaderTest, transmitCardRequest_whenSecureSession_shouldCommitModifications)
+{
+    SCRT_Transaction transaction(cardReader, samReader);
+    ASSERT_TRUE(transaction.isProxyReader());
+    const int transactionCounter = card->getTransactionCounter();
+
+    transaction.processOpening();
+    const std::vector<std::vector<uint8_t>> responses = transaction.processCommands(
+        SCRT_CardRequest().add({0x00, 0xDC, 0x01, 0x3C, 0x02, 0x55, 0x66})
+                          .add({0x00, 0xB2, 0x01, 0x3C, 0x00}));
+    const std::vector<uint8_t> closeResponse = transaction.processClosing();
+
+    ASSERT_EQ(responses.size(), 2u);
+    ASSERT_EQ(responses[1].size(), 29u + 2);
+    ASSERT_EQ(responses[1][1], 0x66);
+    ASSERT_EQ(closeResponse.size(), 6u);
+    ASSERT_EQ(closeResponse[4], 0x90);
+    ASSERT_FALSE(transaction.lastCardResponse->isLogicalChannelOpen());
+    ASSERT_FALSE(cardReader->isLogicalChannelOpen());
+    ASSERT_EQ(card->getRecord(0x07, 1)[0], 0x55);
+    ASSERT_EQ(card->getTransactionCounter(), transactionCounter - 1);
+}
+
+TEST_F(SimulatedCardReaderTest, transmitCardRequest_whenStatusWordIsUnexpected_shouldStop)
+{
+    auto cardRequest = std::make_shared<SCRT_CardRequest>();
+    cardRequest->add({0x00, 0xA4, 0x04, 0x00, 0x05, 0xA0, 0x00, 0x00, 0x04, 0x04, 0x00})
+                .add({0x00, 0xB2, 0x05, 0x3C, 0x00})
+                .add({0x00, 0xB2, 0x01, 0x3C, 0x00});
+
+    try {
+        cardReader->transmitCardRequest(cardRequest, ChannelControl::KEEP_OPEN);
+        FAIL();
+    } catch (const UnexpectedStatusWordException& e) {
+        ASSERT_FALSE(e.isCardResponseComplete());
+        ASSERT_EQ(e.getCardResponse()->getApduResponses().size(), 2u);
+        ASSERT_EQ(e.getCardResponse()->getApduResponses()[1]->getStatusWord(), 0x6A83);
+    }
+
+    ASSERT_EQ(cardReader->getApdusNumber(), 2);
+    ASSERT_TRUE(cardReader->isLogicalChannelOpen());
+}
+
+TEST_F(SimulatedCardReaderTest, transmitCardRequest_whenNoCard_shouldThrowCBCE)
+{
+    auto cardRequest = std::make_shared<SCRT_CardRequest>();
+    cardRequest->add({0x00, 0xB2, 0x01, 0x3C, 0x00});
+    cardReader->removeCard();
+
+    EXPECT_THROW(cardReader->transmitCardRequest(cardRequest, ChannelControl::KEEP_OPEN),
+                 CardBrokenCommunicationException);
+    ASSERT_EQ(cardReader->getApdusNumber(), 0);
+}